@@ -0,0 +1,80 @@
+#include <1chipml.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Number of multiply-adds done for each length. The number of repetitions is
+// adapted so that every length does the same amount of work.
+#define OPERATIONS_PER_LENGTH (1u << 24)
+
+/**
+ * @brief Times the DFT, which computes its roots of unity with cos and sin,
+ * against the DFT with the roots of unity of a workspace.
+ */
+static int benchmarkLength(const unsigned length) {
+
+  dft_real* reals = malloc(length * sizeof(dft_real));
+  dft_real* imgs = malloc(length * sizeof(dft_real));
+  dft_real* workspace = malloc(DFT_WORKSPACE_SIZE(length) * sizeof(dft_real));
+  if (reals == NULL || imgs == NULL || workspace == NULL) {
+    free(reals);
+    free(imgs);
+    free(workspace);
+    return 1;
+  }
+
+  for (unsigned i = 0; i < length; ++i) {
+    reals[i] = linear_congruential_random_generator();
+    imgs[i] = linear_congruential_random_generator();
+  }
+
+  unsigned repetitions = OPERATIONS_PER_LENGTH / (length * length);
+  if (repetitions == 0) {
+    repetitions = 1;
+  }
+
+  clock_t start = clock();
+  for (unsigned i = 0; i < repetitions; ++i) {
+    DFT(length, reals, imgs, 1);
+    DFT(length, reals, imgs, -1);
+  }
+  clock_t end = clock();
+  const double dftTime = (double)(end - start) / CLOCKS_PER_SEC;
+
+  // The roots of unity are computed once for every repetition
+  start = clock();
+  dftWorkspaceInit(length, workspace);
+  for (unsigned i = 0; i < repetitions; ++i) {
+    DFTWorkspace(length, reals, imgs, 1, workspace);
+    DFTWorkspace(length, reals, imgs, -1, workspace);
+  }
+  end = clock();
+  const double workspaceTime = (double)(end - start) / CLOCKS_PER_SEC;
+
+  // Time per transform, in microseconds
+  const double transforms = 2.0 * repetitions;
+  printf("%8u %12.3f %12.3f %8.2fx\n", length, 1e6 * dftTime / transforms,
+         1e6 * workspaceTime / transforms,
+         workspaceTime > 0.0 ? dftTime / workspaceTime : 0.0);
+
+  free(reals);
+  free(imgs);
+  free(workspace);
+  return 0;
+}
+
+int main() {
+
+  set_linear_congruential_generator_seed(1);
+
+  printf("Time per transform (us)\n");
+  printf("%8s %12s %12s %9s\n", "length", "DFT", "workspace", "speedup");
+
+  int returnCode = 0;
+  const unsigned lengths[] = {7, 15, 31, 45, 63, 127, 255, 511};
+  for (unsigned i = 0; i < sizeof(lengths) / sizeof(lengths[0]); ++i) {
+    returnCode |= benchmarkLength(lengths[i]);
+  }
+
+  return returnCode;
+}
@@ -0,0 +1,487 @@
+#include <1chipml.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// The FFT function uses the butterflies selected with FFT_RADIX, while the
+// plans can switch between radix 2 and radix 4 at runtime.
+
+// Number of complex samples transformed for each length. The number of
+// repetitions is adapted so that every length does the same amount of work.
+#define SAMPLES_PER_LENGTH (1u << 22)
+
+/**
+ * @brief Returns the maximum absolute difference between two complex vectors
+ */
+static double maxDifference(const unsigned length, const fft_real* reals1,
+                            const fft_real* imgs1, const fft_real* reals2,
+                            const fft_real* imgs2) {
+  double maxDiff = 0.0;
+  for (unsigned i = 0; i < length; ++i) {
+    maxDiff = fmax(maxDiff, fabs(reals1[i] - reals2[i]));
+    maxDiff = fmax(maxDiff, fabs(imgs1[i] - imgs2[i]));
+  }
+  return maxDiff;
+}
+
+/**
+ * @brief Times the FFT function and the plan execution for a given length.
+ * Both methods compute a forward and an inverse transform at each repetition,
+ * so the vectors stay bounded and the round-trip error can be reported.
+ */
+static int benchmarkLength(const unsigned length) {
+
+  fft_real* inputReals = malloc(length * sizeof(fft_real));
+  fft_real* inputImgs = malloc(length * sizeof(fft_real));
+  fft_real* reals = malloc(length * sizeof(fft_real));
+  fft_real* imgs = malloc(length * sizeof(fft_real));
+  fft_plan* plan = fftPlanCreate(length);
+  if (inputReals == NULL || inputImgs == NULL || reals == NULL ||
+      imgs == NULL || plan == NULL) {
+    free(inputReals);
+    free(inputImgs);
+    free(reals);
+    free(imgs);
+    fftPlanDestroy(plan);
+    return 1;
+  }
+
+  for (unsigned i = 0; i < length; ++i) {
+    inputReals[i] = linear_congruential_random_generator();
+    inputImgs[i] = linear_congruential_random_generator();
+  }
+
+  unsigned repetitions = SAMPLES_PER_LENGTH / length;
+  if (repetitions == 0) {
+    repetitions = 1;
+  }
+
+  // FFT function
+  memcpy(reals, inputReals, length * sizeof(fft_real));
+  memcpy(imgs, inputImgs, length * sizeof(fft_real));
+  clock_t start = clock();
+  for (unsigned i = 0; i < repetitions; ++i) {
+    FFT(length, reals, imgs, 1);
+    FFT(length, reals, imgs, -1);
+  }
+  clock_t end = clock();
+  const double fftTime = (double)(end - start) / CLOCKS_PER_SEC;
+  const double fftError =
+      maxDifference(length, reals, imgs, inputReals, inputImgs);
+
+  // Plan execution
+  memcpy(reals, inputReals, length * sizeof(fft_real));
+  memcpy(imgs, inputImgs, length * sizeof(fft_real));
+  start = clock();
+  for (unsigned i = 0; i < repetitions; ++i) {
+    fftPlanExecute(plan, reals, imgs, 1);
+    fftPlanExecute(plan, reals, imgs, -1);
+  }
+  end = clock();
+  const double planTime = (double)(end - start) / CLOCKS_PER_SEC;
+  const double planError =
+      maxDifference(length, reals, imgs, inputReals, inputImgs);
+
+  // Time per transform, in microseconds
+  const double transforms = 2.0 * repetitions;
+  printf("%8u %12.3f %12.3f %8.2fx %12.3e %12.3e\n", length,
+         1e6 * fftTime / transforms, 1e6 * planTime / transforms,
+         planTime > 0.0 ? fftTime / planTime : 0.0, fftError, planError);
+
+  free(inputReals);
+  free(inputImgs);
+  free(reals);
+  free(imgs);
+  fftPlanDestroy(plan);
+  return 0;
+}
+
+/**
+ * @brief Times the complex plan, with a zeroed imaginary part, against the
+ * real plan for a given length.
+ */
+static int benchmarkRealLength(const unsigned length) {
+
+  const unsigned nbBins = length / 2 + 1;
+  fft_real* input = malloc(length * sizeof(fft_real));
+  fft_real* reals = malloc(length * sizeof(fft_real));
+  fft_real* imgs = malloc(length * sizeof(fft_real));
+  fft_real* binReals = malloc(nbBins * sizeof(fft_real));
+  fft_real* binImgs = malloc(nbBins * sizeof(fft_real));
+  fft_plan* plan = fftPlanCreate(length);
+  if (input == NULL || reals == NULL || imgs == NULL || binReals == NULL ||
+      binImgs == NULL || plan == NULL) {
+    free(input);
+    free(reals);
+    free(imgs);
+    free(binReals);
+    free(binImgs);
+    fftPlanDestroy(plan);
+    return 1;
+  }
+
+  for (unsigned i = 0; i < length; ++i) {
+    input[i] = linear_congruential_random_generator();
+  }
+
+  unsigned repetitions = SAMPLES_PER_LENGTH / length;
+  if (repetitions == 0) {
+    repetitions = 1;
+  }
+
+  // Complex plan, the input is copied at each repetition like a caller would
+  clock_t start = clock();
+  for (unsigned i = 0; i < repetitions; ++i) {
+    memcpy(reals, input, length * sizeof(fft_real));
+    memset(imgs, 0, length * sizeof(fft_real));
+    fftPlanExecute(plan, reals, imgs, 1);
+  }
+  clock_t end = clock();
+  const double complexTime = (double)(end - start) / CLOCKS_PER_SEC;
+
+  // Real plan
+  start = clock();
+  for (unsigned i = 0; i < repetitions; ++i) {
+    fftPlanExecuteReal(plan, input, binReals, binImgs);
+  }
+  end = clock();
+  const double realTime = (double)(end - start) / CLOCKS_PER_SEC;
+
+  // Both results must match on the non-redundant bins
+  const double error = maxDifference(nbBins, reals, imgs, binReals, binImgs);
+
+  printf("%8u %12.3f %12.3f %8.2fx %12.3e\n", length,
+         1e6 * complexTime / repetitions, 1e6 * realTime / repetitions,
+         realTime > 0.0 ? complexTime / realTime : 0.0, error);
+
+  free(input);
+  free(reals);
+  free(imgs);
+  free(binReals);
+  free(binImgs);
+  fftPlanDestroy(plan);
+  return 0;
+}
+
+/**
+ * @brief Times the plan with radix-2 butterflies against the plan with radix-4
+ * butterflies for a given length.
+ */
+static int benchmarkRadixLength(const unsigned length) {
+
+  fft_real* reals = malloc(length * sizeof(fft_real));
+  fft_real* imgs = malloc(length * sizeof(fft_real));
+  fft_plan* plan = fftPlanCreate(length);
+  if (reals == NULL || imgs == NULL || plan == NULL) {
+    free(reals);
+    free(imgs);
+    fftPlanDestroy(plan);
+    return 1;
+  }
+
+  for (unsigned i = 0; i < length; ++i) {
+    reals[i] = linear_congruential_random_generator();
+    imgs[i] = linear_congruential_random_generator();
+  }
+
+  unsigned repetitions = SAMPLES_PER_LENGTH / length;
+  if (repetitions == 0) {
+    repetitions = 1;
+  }
+
+  double times[2];
+  const unsigned radices[2] = {2, 4};
+  for (unsigned r = 0; r < 2; ++r) {
+    plan->radix = radices[r];
+    clock_t start = clock();
+    for (unsigned i = 0; i < repetitions; ++i) {
+      fftPlanExecute(plan, reals, imgs, 1);
+      fftPlanExecute(plan, reals, imgs, -1);
+    }
+    clock_t end = clock();
+    times[r] = (double)(end - start) / CLOCKS_PER_SEC;
+  }
+
+  const double transforms = 2.0 * repetitions;
+  printf("%8u %12.3f %12.3f %8.2fx\n", length, 1e6 * times[0] / transforms,
+         1e6 * times[1] / transforms,
+         times[1] > 0.0 ? times[0] / times[1] : 0.0);
+
+  free(reals);
+  free(imgs);
+  fftPlanDestroy(plan);
+  return 0;
+}
+
+/**
+ * @brief Times the plan of a length that is not a power of 2 against the plan
+ * of the next power of 2, used with zero padding, and against the DFT.
+ */
+static int benchmarkAnyLength(const unsigned length) {
+
+  unsigned paddedLength = 1;
+  while (paddedLength < length) {
+    paddedLength <<= 1;
+  }
+
+  fft_real* reals = calloc(paddedLength, sizeof(fft_real));
+  fft_real* imgs = calloc(paddedLength, sizeof(fft_real));
+  fft_plan* plan = fftPlanCreate(length);
+  fft_plan* paddedPlan = fftPlanCreate(paddedLength);
+  if (reals == NULL || imgs == NULL || plan == NULL || paddedPlan == NULL) {
+    free(reals);
+    free(imgs);
+    fftPlanDestroy(plan);
+    fftPlanDestroy(paddedPlan);
+    return 1;
+  }
+
+  for (unsigned i = 0; i < length; ++i) {
+    reals[i] = linear_congruential_random_generator();
+    imgs[i] = linear_congruential_random_generator();
+  }
+
+  unsigned repetitions = SAMPLES_PER_LENGTH / paddedLength;
+  if (repetitions == 0) {
+    repetitions = 1;
+  }
+
+  clock_t start = clock();
+  for (unsigned i = 0; i < repetitions; ++i) {
+    fftPlanExecute(plan, reals, imgs, 1);
+    fftPlanExecute(plan, reals, imgs, -1);
+  }
+  clock_t end = clock();
+  const double planTime = (double)(end - start) / CLOCKS_PER_SEC;
+
+  start = clock();
+  for (unsigned i = 0; i < repetitions; ++i) {
+    fftPlanExecute(paddedPlan, reals, imgs, 1);
+    fftPlanExecute(paddedPlan, reals, imgs, -1);
+  }
+  end = clock();
+  const double paddedTime = (double)(end - start) / CLOCKS_PER_SEC;
+
+  // The DFT is only timed on a few repetitions, as it is O(n^2)
+  const unsigned dftRepetitions = 2;
+  start = clock();
+  for (unsigned i = 0; i < dftRepetitions; ++i) {
+    DFT(length, reals, imgs, 1);
+  }
+  end = clock();
+  const double dftTime = (double)(end - start) / CLOCKS_PER_SEC;
+
+  const char* algorithm = plan->convolutionPlan != NULL ? "Bluestein"
+                          : plan->bitReversal != NULL   ? "power of 2"
+                                                        : "mixed radix";
+  const double transforms = 2.0 * repetitions;
+  printf("%8u %12s %12.3f %12.3f %12.3f\n", length, algorithm,
+         1e6 * planTime / transforms, 1e6 * paddedTime / transforms,
+         1e6 * dftTime / dftRepetitions);
+
+  free(reals);
+  free(imgs);
+  fftPlanDestroy(plan);
+  fftPlanDestroy(paddedPlan);
+  return 0;
+}
+
+/**
+ * @brief Times the column pass of a square row-major matrix. Each column is
+ * either copied to a contiguous vector and transformed, or the whole pass is
+ * done with a single batched call on the strided columns.
+ */
+static int benchmarkColumnLength(const unsigned length) {
+
+  const unsigned size = length * length;
+  fft_real* reals = malloc(size * sizeof(fft_real));
+  fft_real* imgs = malloc(size * sizeof(fft_real));
+  fft_real* columnReals = malloc(length * sizeof(fft_real));
+  fft_real* columnImgs = malloc(length * sizeof(fft_real));
+  fft_plan* plan = fftPlanCreate(length);
+  if (reals == NULL || imgs == NULL || columnReals == NULL ||
+      columnImgs == NULL || plan == NULL) {
+    free(reals);
+    free(imgs);
+    free(columnReals);
+    free(columnImgs);
+    fftPlanDestroy(plan);
+    return 1;
+  }
+
+  for (unsigned i = 0; i < size; ++i) {
+    reals[i] = linear_congruential_random_generator();
+    imgs[i] = linear_congruential_random_generator();
+  }
+
+  unsigned repetitions = SAMPLES_PER_LENGTH / size;
+  if (repetitions == 0) {
+    repetitions = 1;
+  }
+
+  // One vector at a time, through a contiguous copy of the column
+  clock_t start = clock();
+  for (unsigned r = 0; r < 2 * repetitions; ++r) {
+    const int dir = (r & 1) ? -1 : 1;
+    for (unsigned column = 0; column < length; ++column) {
+      for (unsigned i = 0; i < length; ++i) {
+        columnReals[i] = reals[i * length + column];
+        columnImgs[i] = imgs[i * length + column];
+      }
+      fftPlanExecute(plan, columnReals, columnImgs, dir);
+      for (unsigned i = 0; i < length; ++i) {
+        reals[i * length + column] = columnReals[i];
+        imgs[i * length + column] = columnImgs[i];
+      }
+    }
+  }
+  clock_t end = clock();
+  const double copyTime = (double)(end - start) / CLOCKS_PER_SEC;
+
+  // Batched call on the strided columns
+  start = clock();
+  for (unsigned r = 0; r < 2 * repetitions; ++r) {
+    const int dir = (r & 1) ? -1 : 1;
+    fftPlanExecuteBatch(plan, reals, imgs, length, length, 1, dir);
+  }
+  end = clock();
+  const double batchTime = (double)(end - start) / CLOCKS_PER_SEC;
+
+  // Time per column pass, in microseconds
+  const double passes = 2.0 * repetitions;
+  printf("%8u %12.3f %12.3f %8.2fx\n", length, 1e6 * copyTime / passes,
+         1e6 * batchTime / passes,
+         batchTime > 0.0 ? copyTime / batchTime : 0.0);
+
+  free(reals);
+  free(imgs);
+  free(columnReals);
+  free(columnImgs);
+  fftPlanDestroy(plan);
+  return 0;
+}
+
+/**
+ * @brief Times the 2D FFT of a square matrix, with the columns copied to a
+ * contiguous vector one at a time, and with FFT2D.
+ */
+static int benchmark2DLength(const unsigned length) {
+
+  const unsigned size = length * length;
+  fft_real* reals = malloc(size * sizeof(fft_real));
+  fft_real* imgs = malloc(size * sizeof(fft_real));
+  fft_real* columnReals = malloc(length * sizeof(fft_real));
+  fft_real* columnImgs = malloc(length * sizeof(fft_real));
+  fft_plan* plan = fftPlanCreate(length);
+  if (reals == NULL || imgs == NULL || columnReals == NULL ||
+      columnImgs == NULL || plan == NULL) {
+    free(reals);
+    free(imgs);
+    free(columnReals);
+    free(columnImgs);
+    fftPlanDestroy(plan);
+    return 1;
+  }
+
+  for (unsigned i = 0; i < size; ++i) {
+    reals[i] = linear_congruential_random_generator();
+    imgs[i] = linear_congruential_random_generator();
+  }
+
+  unsigned repetitions = SAMPLES_PER_LENGTH / size;
+  if (repetitions == 0) {
+    repetitions = 1;
+  }
+
+  clock_t start = clock();
+  for (unsigned r = 0; r < 2 * repetitions; ++r) {
+    const int dir = (r & 1) ? -1 : 1;
+    for (unsigned row = 0; row < length; ++row) {
+      fftPlanExecute(plan, reals + row * length, imgs + row * length, dir);
+    }
+    for (unsigned column = 0; column < length; ++column) {
+      for (unsigned i = 0; i < length; ++i) {
+        columnReals[i] = reals[i * length + column];
+        columnImgs[i] = imgs[i * length + column];
+      }
+      fftPlanExecute(plan, columnReals, columnImgs, dir);
+      for (unsigned i = 0; i < length; ++i) {
+        reals[i * length + column] = columnReals[i];
+        imgs[i * length + column] = columnImgs[i];
+      }
+    }
+  }
+  clock_t end = clock();
+  const double copyTime = (double)(end - start) / CLOCKS_PER_SEC;
+
+  start = clock();
+  for (unsigned r = 0; r < 2 * repetitions; ++r) {
+    FFT2D(length, length, reals, imgs, (r & 1) ? -1 : 1);
+  }
+  end = clock();
+  const double fft2DTime = (double)(end - start) / CLOCKS_PER_SEC;
+
+  const double transforms = 2.0 * repetitions;
+  printf("%8u %12.3f %12.3f %8.2fx\n", length, 1e6 * copyTime / transforms,
+         1e6 * fft2DTime / transforms,
+         fft2DTime > 0.0 ? copyTime / fft2DTime : 0.0);
+
+  free(reals);
+  free(imgs);
+  free(columnReals);
+  free(columnImgs);
+  fftPlanDestroy(plan);
+  return 0;
+}
+
+int main() {
+
+  set_linear_congruential_generator_seed(1);
+
+  printf("Time per transform (us) and round-trip error\n");
+  printf("%8s %12s %12s %9s %12s %12s\n", "length", "FFT", "plan", "speedup",
+         "FFT error", "plan error");
+
+  int returnCode = 0;
+  for (unsigned length = 64; length <= 65536; length <<= 1) {
+    returnCode |= benchmarkLength(length);
+  }
+
+  printf("\nTime per transform of the plan (us), by radix\n");
+  printf("%8s %12s %12s %9s\n", "length", "radix 2", "radix 4", "speedup");
+  for (unsigned length = 64; length <= 65536; length <<= 1) {
+    returnCode |= benchmarkRadixLength(length);
+  }
+
+  printf("\nTime per transform of any length (us)\n");
+  printf("%8s %12s %12s %12s %12s\n", "length", "algorithm", "plan",
+         "padded plan", "DFT");
+  const unsigned anyLengths[] = {60, 100, 127, 360, 1000, 1009, 1920, 4095};
+  for (unsigned i = 0; i < sizeof(anyLengths) / sizeof(anyLengths[0]); ++i) {
+    returnCode |= benchmarkAnyLength(anyLengths[i]);
+  }
+
+  printf("\nTime per transform of a real vector (us)\n");
+  printf("%8s %12s %12s %9s %12s\n", "length", "complex", "real", "speedup",
+         "difference");
+  for (unsigned length = 64; length <= 65536; length <<= 1) {
+    returnCode |= benchmarkRealLength(length);
+  }
+
+  printf("\nTime per column pass of a square matrix (us)\n");
+  printf("%8s %12s %12s %9s\n", "length", "copy", "batch", "speedup");
+  for (unsigned length = 64; length <= 1024; length <<= 1) {
+    returnCode |= benchmarkColumnLength(length);
+  }
+
+  printf("\nTime per 2D transform of a square matrix (us)\n");
+  printf("%8s %12s %12s %9s\n", "length", "copy", "FFT2D", "speedup");
+  const unsigned lengths2D[] = {64, 100, 128, 256, 360, 512, 1000, 1024};
+  for (unsigned i = 0; i < sizeof(lengths2D) / sizeof(lengths2D[0]); ++i) {
+    returnCode |= benchmark2DLength(lengths2D[i]);
+  }
+
+  return returnCode;
+}
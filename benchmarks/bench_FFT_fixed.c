@@ -0,0 +1,124 @@
+#include <1chipml.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// On a host with an FPU, the double FFT is expected to be as fast or faster
+// than the fixed-point ones. The fixed-point FFTs are meant for targets where
+// floating point operations are emulated in software.
+
+// Number of complex samples transformed for each length. The number of
+// repetitions is adapted so that every length does the same amount of work.
+#define SAMPLES_PER_LENGTH (1u << 22)
+
+/**
+ * @brief Times the double plan, the Q15 FFT and the Q31 FFT for a given
+ * length. The vectors are refilled before each transform, as the fixed-point
+ * FFTs scale their results.
+ */
+static int benchmarkLength(const unsigned length) {
+
+  fft_real* reals = malloc(length * sizeof(fft_real));
+  fft_real* imgs = malloc(length * sizeof(fft_real));
+  fft_q15* reals15 = malloc(length * sizeof(fft_q15));
+  fft_q15* imgs15 = malloc(length * sizeof(fft_q15));
+  fft_q15* twiddleReals15 = malloc(length / 2 * sizeof(fft_q15));
+  fft_q15* twiddleImgs15 = malloc(length / 2 * sizeof(fft_q15));
+  fft_q31* reals31 = malloc(length * sizeof(fft_q31));
+  fft_q31* imgs31 = malloc(length * sizeof(fft_q31));
+  fft_q31* twiddleReals31 = malloc(length / 2 * sizeof(fft_q31));
+  fft_q31* twiddleImgs31 = malloc(length / 2 * sizeof(fft_q31));
+  fft_plan* plan = fftPlanCreate(length);
+
+  int returnCode = 0;
+  if (reals == NULL || imgs == NULL || reals15 == NULL || imgs15 == NULL ||
+      twiddleReals15 == NULL || twiddleImgs15 == NULL || reals31 == NULL ||
+      imgs31 == NULL || twiddleReals31 == NULL || twiddleImgs31 == NULL ||
+      plan == NULL) {
+    returnCode = 1;
+  } else {
+    fftQ15Twiddles(length, twiddleReals15, twiddleImgs15);
+    fftQ31Twiddles(length, twiddleReals31, twiddleImgs31);
+
+    unsigned repetitions = SAMPLES_PER_LENGTH / length;
+    if (repetitions == 0) {
+      repetitions = 1;
+    }
+
+    // Double plan
+    clock_t start = clock();
+    for (unsigned r = 0; r < repetitions; ++r) {
+      for (unsigned i = 0; i < length; ++i) {
+        reals[i] = (i & 7) * 0.0625;
+        imgs[i] = 0.0;
+      }
+      fftPlanExecute(plan, reals, imgs, 1);
+    }
+    clock_t end = clock();
+    const double doubleTime = (double)(end - start) / CLOCKS_PER_SEC;
+
+    // Q15
+    int exponent = 0;
+    start = clock();
+    for (unsigned r = 0; r < repetitions; ++r) {
+      for (unsigned i = 0; i < length; ++i) {
+        reals15[i] = (i & 7) << 11;
+        imgs15[i] = 0;
+      }
+      fftQ15(length, reals15, imgs15, twiddleReals15, twiddleImgs15, 1,
+             &exponent);
+    }
+    end = clock();
+    const double q15Time = (double)(end - start) / CLOCKS_PER_SEC;
+
+    // Q31
+    start = clock();
+    for (unsigned r = 0; r < repetitions; ++r) {
+      for (unsigned i = 0; i < length; ++i) {
+        reals31[i] = (int32_t)(i & 7) << 27;
+        imgs31[i] = 0;
+      }
+      fftQ31(length, reals31, imgs31, twiddleReals31, twiddleImgs31, 1,
+             &exponent);
+    }
+    end = clock();
+    const double q31Time = (double)(end - start) / CLOCKS_PER_SEC;
+
+    // Time per transform, in microseconds, and throughput in millions of
+    // complex samples per second
+    printf("%8u %12.3f %12.3f %12.3f %10.1f %10.1f %10.1f\n", length,
+           1e6 * doubleTime / repetitions, 1e6 * q15Time / repetitions,
+           1e6 * q31Time / repetitions,
+           doubleTime > 0.0 ? 1e-6 * SAMPLES_PER_LENGTH / doubleTime : 0.0,
+           q15Time > 0.0 ? 1e-6 * SAMPLES_PER_LENGTH / q15Time : 0.0,
+           q31Time > 0.0 ? 1e-6 * SAMPLES_PER_LENGTH / q31Time : 0.0);
+  }
+
+  free(reals);
+  free(imgs);
+  free(reals15);
+  free(imgs15);
+  free(twiddleReals15);
+  free(twiddleImgs15);
+  free(reals31);
+  free(imgs31);
+  free(twiddleReals31);
+  free(twiddleImgs31);
+  fftPlanDestroy(plan);
+  return returnCode;
+}
+
+int main() {
+
+  printf("Time per transform (us) and throughput (Msamples/s)\n");
+  printf("%8s %12s %12s %12s %10s %10s %10s\n", "length", "double", "Q15",
+         "Q31", "double", "Q15", "Q31");
+
+  int returnCode = 0;
+  for (unsigned length = 64; length <= 16384; length <<= 1) {
+    returnCode |= benchmarkLength(length);
+  }
+
+  return returnCode;
+}
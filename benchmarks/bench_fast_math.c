@@ -0,0 +1,84 @@
+#include <1chipml.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Number of values, small enough to stay in the cache, and number of times
+// each function is evaluated on them
+#define NB_VALUES 4096
+#define REPETITIONS 1000
+
+/**
+ * @brief Returns the time per call, in nanoseconds, since start
+ */
+static double nanosecondsPerCall(const clock_t start) {
+  return 1e9 * (double)(clock() - start) / CLOCKS_PER_SEC /
+         ((double)NB_VALUES * REPETITIONS);
+}
+
+// Times one function over all the values. The results are summed so that no
+// loop is optimized away.
+#define TIME_CALLS(result, call)                                               \
+  do {                                                                         \
+    const clock_t start = clock();                                             \
+    for (unsigned r = 0; r < REPETITIONS; ++r) {                               \
+      for (unsigned i = 0; i < NB_VALUES; ++i) {                               \
+        outputs[i] = (call);                                                   \
+      }                                                                        \
+      checksum += outputs[r % NB_VALUES];                                      \
+    }                                                                          \
+    result = nanosecondsPerCall(start);                                        \
+  } while (0)
+
+int main() {
+
+  fast_math_real* xs = malloc(NB_VALUES * sizeof(fast_math_real));
+  fast_math_real* ys = malloc(NB_VALUES * sizeof(fast_math_real));
+  fast_math_real* outputs = malloc(NB_VALUES * sizeof(fast_math_real));
+  if (xs == NULL || ys == NULL || outputs == NULL) {
+    free(xs);
+    free(ys);
+    free(outputs);
+    return 1;
+  }
+
+  // Positive values spanning several orders of magnitude, and signed values
+  // for atan2
+  for (unsigned i = 0; i < NB_VALUES; ++i) {
+    xs[i] = pow(10.0, 6.0 * rand() / RAND_MAX - 3.0);
+    ys[i] = 2.0 * rand() / RAND_MAX - 1.0;
+  }
+
+  fast_math_real checksum = 0.0;
+  double expTime, logTime, powTime, sqrtTime, atan2Time;
+
+  printf("Time per call (ns)\n");
+  printf("%6s %8s %8s %8s %8s %8s\n", "degree", "exp", "log", "pow", "sqrt",
+         "atan2");
+
+  TIME_CALLS(expTime, exp(ys[i] * 10.0));
+  TIME_CALLS(logTime, log(xs[i]));
+  TIME_CALLS(powTime, pow(xs[i], ys[i]));
+  TIME_CALLS(sqrtTime, sqrt(xs[i]));
+  TIME_CALLS(atan2Time, atan2(ys[i], xs[i] - 1.0));
+  printf("%6s %8.2f %8.2f %8.2f %8.2f %8.2f\n", "libm", expTime, logTime,
+         powTime, sqrtTime, atan2Time);
+
+  const int degrees[] = {1, 2, 3, 5, 7};
+  for (unsigned d = 0; d < sizeof(degrees) / sizeof(degrees[0]); ++d) {
+    const int degree = degrees[d];
+    TIME_CALLS(expTime, fastExp(ys[i] * 10.0, degree));
+    TIME_CALLS(logTime, fastLog(xs[i], degree));
+    TIME_CALLS(powTime, fastPow(xs[i], ys[i], degree));
+    TIME_CALLS(sqrtTime, fastSqrt(xs[i], degree));
+    TIME_CALLS(atan2Time, fastAtan2(ys[i], xs[i] - 1.0, degree));
+    printf("%6d %8.2f %8.2f %8.2f %8.2f %8.2f\n", degree, expTime, logTime,
+           powTime, sqrtTime, atan2Time);
+  }
+
+  free(xs);
+  free(ys);
+  free(outputs);
+  return checksum != checksum; // NaN
+}
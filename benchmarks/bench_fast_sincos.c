@@ -0,0 +1,152 @@
+#include <1chipml.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Number of angles per array, small enough to stay in the cache, and number of
+// times each array is evaluated
+#define NB_ANGLES 4096
+#define REPETITIONS 2000
+
+// Range of the angles, in radians
+#define MAX_ANGLE 10.0
+
+/**
+ * @brief Returns the time per angle, in nanoseconds, since start
+ */
+static double nanosecondsPerAngle(const clock_t start) {
+  return 1e9 * (double)(clock() - start) / CLOCKS_PER_SEC /
+         ((double)NB_ANGLES * REPETITIONS);
+}
+
+/**
+ * @brief Times libm, the scalar functions and the array functions for a given
+ * degree. The sum of the results is kept so that no loop is optimized away.
+ */
+static int benchmarkDegree(const int degree, const fast_sincos_real* angles,
+                           fast_sincos_real* sines,
+                           fast_sincos_real* cosines) {
+  fast_sincos_real checksum = 0.0;
+
+  // Sine only
+  clock_t start = clock();
+  for (unsigned r = 0; r < REPETITIONS; ++r) {
+    for (unsigned i = 0; i < NB_ANGLES; ++i) {
+      sines[i] = sin(angles[i]);
+    }
+    checksum += sines[r % NB_ANGLES];
+  }
+  const double libmSin = nanosecondsPerAngle(start);
+
+  start = clock();
+  for (unsigned r = 0; r < REPETITIONS; ++r) {
+    for (unsigned i = 0; i < NB_ANGLES; ++i) {
+      sines[i] = fastSin(angles[i], degree);
+    }
+    checksum += sines[r % NB_ANGLES];
+  }
+  const double scalarSin = nanosecondsPerAngle(start);
+
+  start = clock();
+  for (unsigned r = 0; r < REPETITIONS; ++r) {
+    fastSinArray(NB_ANGLES, angles, sines, degree);
+    checksum += sines[r % NB_ANGLES];
+  }
+  const double arraySin = nanosecondsPerAngle(start);
+
+  // Sine and cosine
+  start = clock();
+  for (unsigned r = 0; r < REPETITIONS; ++r) {
+    for (unsigned i = 0; i < NB_ANGLES; ++i) {
+      sines[i] = sin(angles[i]);
+      cosines[i] = cos(angles[i]);
+    }
+    checksum += sines[r % NB_ANGLES] + cosines[r % NB_ANGLES];
+  }
+  const double libmSinCos = nanosecondsPerAngle(start);
+
+  start = clock();
+  for (unsigned r = 0; r < REPETITIONS; ++r) {
+    for (unsigned i = 0; i < NB_ANGLES; ++i) {
+      sines[i] = fastSin(angles[i], degree);
+      cosines[i] = fastCos(angles[i], degree);
+    }
+    checksum += sines[r % NB_ANGLES] + cosines[r % NB_ANGLES];
+  }
+  const double scalarSinCos = nanosecondsPerAngle(start);
+
+  start = clock();
+  for (unsigned r = 0; r < REPETITIONS; ++r) {
+    for (unsigned i = 0; i < NB_ANGLES; ++i) {
+      fastSinCos(angles[i], degree, sines + i, cosines + i);
+    }
+    checksum += sines[r % NB_ANGLES] + cosines[r % NB_ANGLES];
+  }
+  const double fusedSinCos = nanosecondsPerAngle(start);
+
+  start = clock();
+  for (unsigned r = 0; r < REPETITIONS; ++r) {
+    fastSinCosArray(NB_ANGLES, angles, sines, cosines, degree);
+    checksum += sines[r % NB_ANGLES] + cosines[r % NB_ANGLES];
+  }
+  const double arraySinCos = nanosecondsPerAngle(start);
+
+  // Accuracy of the array functions against libm
+  double maxError = 0.0;
+  for (unsigned i = 0; i < NB_ANGLES; ++i) {
+    maxError = fmax(maxError, fabs(sines[i] - sin(angles[i])));
+    maxError = fmax(maxError, fabs(cosines[i] - cos(angles[i])));
+  }
+
+  printf("%6d %8.2f %8.2f %8.2f %9.2f %9.2f %10.2f %9.2f %8.1e\n", degree,
+         libmSin, scalarSin, arraySin, libmSinCos, scalarSinCos, fusedSinCos,
+         arraySinCos, maxError);
+
+  return checksum != checksum; // NaN
+}
+
+int main() {
+
+  fast_sincos_real* angles = malloc(NB_ANGLES * sizeof(fast_sincos_real));
+  fast_sincos_real* sines = malloc(NB_ANGLES * sizeof(fast_sincos_real));
+  fast_sincos_real* cosines = malloc(NB_ANGLES * sizeof(fast_sincos_real));
+  if (angles == NULL || sines == NULL || cosines == NULL) {
+    free(angles);
+    free(sines);
+    free(cosines);
+    return 1;
+  }
+
+  for (unsigned i = 0; i < NB_ANGLES; ++i) {
+    angles[i] = MAX_ANGLE * (2.0 * rand() / RAND_MAX - 1.0);
+  }
+
+#if defined(FAST_SINCOS_NO_SIMD)
+  printf("Array functions built without vector extensions\n");
+#elif defined(__AVX2__)
+  printf("Array functions built with AVX2\n");
+#elif defined(__SSE2__)
+  printf("Array functions built with SSE2\n");
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  printf("Array functions built with NEON\n");
+#else
+  printf("Array functions built without vector extensions\n");
+#endif
+  printf("Time per angle (ns) and max error of the array functions\n");
+  printf("%6s %8s %8s %8s %9s %9s %10s %9s %8s\n", "degree", "sin", "fastSin",
+         "array", "sin+cos", "fastSin+", "fastSinCos", "sinCos", "error");
+  printf("%6s %8s %8s %8s %9s %9s %10s %9s %8s\n", "", "", "", "", "",
+         "fastCos", "", "array", "");
+
+  int returnCode = 0;
+  const int degrees[] = {1, 2, 3, 5, 7};
+  for (unsigned d = 0; d < sizeof(degrees) / sizeof(degrees[0]); ++d) {
+    returnCode |= benchmarkDegree(degrees[d], angles, sines, cosines);
+  }
+
+  free(angles);
+  free(sines);
+  free(cosines);
+  return returnCode;
+}
@@ -0,0 +1,119 @@
+#include <1chipml.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Square sizes from MIN_SIZE to MAX_SIZE, doubling each time. The serial
+// versions are slower, and are only timed up to MAX_CLASSICAL_SIZE and
+// MAX_CYCLIC_SIZE.
+#define MIN_SIZE 8
+#define MAX_SIZE 512
+#define MAX_CLASSICAL_SIZE 256
+#define MAX_CYCLIC_SIZE 256
+
+// Minimum time spent on each measure, in seconds
+#define MIN_SECONDS 0.2
+
+// An eigensolver, run until convergence on a symmetric matrix
+typedef void (*eigen_solver)(real_number* matrix, vec_size size,
+                             real_number* eigenVectors);
+
+static void classicalJacobi(real_number* matrix, vec_size size,
+                            real_number* eigenVectors) {
+  jacobi(matrix, size, eigenVectors, -1, 0);
+}
+
+static void cyclicJacobi(real_number* matrix, vec_size size,
+                         real_number* eigenVectors) {
+  jacobi(matrix, size, eigenVectors, -1, 1);
+}
+
+static void parallelJacobi(real_number* matrix, vec_size size,
+                           real_number* eigenVectors) {
+  jacobiParallel(matrix, size, eigenVectors, -1);
+}
+
+// Householder reduction followed by QL, eigenVectors receives the eigenvalues
+static void householderQL(real_number* matrix, vec_size size,
+                          real_number* eigenVectors) {
+  symmetricEigen(matrix, size, eigenVectors);
+}
+
+/**
+ * @brief Returns the time of one call to solver, in milliseconds, on a copy
+ * of a symmetric matrix.
+ */
+static double milliseconds(const real_number* matrix, const vec_size size,
+                           real_number* work, real_number* eigenVectors,
+                           eigen_solver solver) {
+  unsigned repetitions = 0;
+  const clock_t start = clock();
+  clock_t elapsed;
+  do {
+    memcpy(work, matrix, (size_t)size * size * sizeof(real_number));
+    solver(work, size, eigenVectors);
+    ++repetitions;
+    elapsed = clock() - start;
+  } while (elapsed < MIN_SECONDS * CLOCKS_PER_SEC);
+
+  return 1e3 * elapsed / CLOCKS_PER_SEC / repetitions;
+}
+
+int main() {
+
+  const size_t elements = (size_t)MAX_SIZE * MAX_SIZE;
+  real_number* matrix = malloc(elements * sizeof(real_number));
+  real_number* work = malloc(elements * sizeof(real_number));
+  real_number* eigenVectors = malloc(elements * sizeof(real_number));
+  if (matrix == NULL || work == NULL || eigenVectors == NULL) {
+    free(matrix);
+    free(work);
+    free(eigenVectors);
+    return 1;
+  }
+
+  printf("Time of jacobi until convergence, and of the Householder reduction "
+         "followed by QL, on random symmetric matrices (ms)\n");
+#ifdef _OPENMP
+  printf("jacobiParallel uses %d threads\n", omp_get_max_threads());
+#endif
+  printf("%6s %10s %10s %10s %10s\n", "size", "classical", "cyclic",
+         "parallel", "QL");
+
+  for (vec_size size = MIN_SIZE; size <= MAX_SIZE; size *= 2) {
+    for (vec_size i = 0; i < size; ++i) {
+      for (vec_size j = 0; j <= i; ++j) {
+        matrix[i * size + j] = 2.0 * rand() / RAND_MAX - 1.0;
+        matrix[j * size + i] = matrix[i * size + j];
+      }
+    }
+
+    printf("%6u", size);
+    if (size <= MAX_CLASSICAL_SIZE) {
+      printf(" %10.3f",
+             milliseconds(matrix, size, work, eigenVectors, classicalJacobi));
+    } else {
+      printf(" %10s", "-");
+    }
+    if (size <= MAX_CYCLIC_SIZE) {
+      printf(" %10.3f",
+             milliseconds(matrix, size, work, eigenVectors, cyclicJacobi));
+    } else {
+      printf(" %10s", "-");
+    }
+    printf(" %10.3f",
+           milliseconds(matrix, size, work, eigenVectors, parallelJacobi));
+    printf(" %10.3f\n",
+           milliseconds(matrix, size, work, eigenVectors, householderQL));
+  }
+
+  free(matrix);
+  free(work);
+  free(eigenVectors);
+  return 0;
+}
@@ -0,0 +1,125 @@
+#include <1chipml.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Square sizes from MIN_SIZE to MAX_SIZE, doubling each time. The full
+// symmetricEigen is only timed up to MAX_DENSE_SIZE.
+#define MIN_SIZE 128
+#define MAX_SIZE 2048
+#define MAX_DENSE_SIZE 1024
+
+// Minimum time spent on each measure, in seconds
+#define MIN_SECONDS 0.2
+
+/**
+ * Dense kernel matrix, with the number of products
+ */
+typedef struct {
+  const matrix_real_number* matrix;
+  size_t nbProducts;
+} kernel_matrix;
+
+/**
+ * @brief Product of the kernel matrix by a vector
+ */
+static void kernelMultiply(void* context, const lanczos_real* vector,
+                           size_t dim, lanczos_real* output) {
+  kernel_matrix* data = context;
+  matrixVectorMultiply(data->matrix, vector, dim, dim, output, 0);
+  ++data->nbProducts;
+}
+
+/**
+ * @brief Returns the time of one call to lanczosTopEigen, in milliseconds,
+ * and the number of products of the last call
+ */
+static double topMilliseconds(kernel_matrix* data, const size_t size,
+                              const size_t nbWanted, lanczos_real* eigenValues,
+                              lanczos_real* eigenVectors) {
+  unsigned repetitions = 0;
+  const clock_t start = clock();
+  clock_t elapsed;
+  do {
+    data->nbProducts = 0;
+    lanczosTopEigen(kernelMultiply, data, size, nbWanted, 3 * nbWanted,
+                    1000, 1e-10, NULL, eigenValues, eigenVectors);
+    ++repetitions;
+    elapsed = clock() - start;
+  } while (elapsed < MIN_SECONDS * CLOCKS_PER_SEC);
+
+  return 1e3 * elapsed / CLOCKS_PER_SEC / repetitions;
+}
+
+/**
+ * @brief Returns the time of one call to symmetricEigen, in milliseconds, on
+ * a copy of the matrix
+ */
+static double denseMilliseconds(const matrix_real_number* matrix,
+                                const size_t size, matrix_real_number* work,
+                                matrix_real_number* eigenValues) {
+  unsigned repetitions = 0;
+  const clock_t start = clock();
+  clock_t elapsed;
+  do {
+    memcpy(work, matrix, size * size * sizeof(matrix_real_number));
+    symmetricEigen(work, size, eigenValues);
+    ++repetitions;
+    elapsed = clock() - start;
+  } while (elapsed < MIN_SECONDS * CLOCKS_PER_SEC);
+
+  return 1e3 * elapsed / CLOCKS_PER_SEC / repetitions;
+}
+
+int main() {
+
+  const size_t nbWanted[] = {2, 10};
+  const size_t elements = (size_t)MAX_SIZE * MAX_SIZE;
+  matrix_real_number* matrix = malloc(elements * sizeof(matrix_real_number));
+  matrix_real_number* work = malloc(elements * sizeof(matrix_real_number));
+  matrix_real_number* eigenValues = malloc(MAX_SIZE * sizeof(lanczos_real));
+  if (matrix == NULL || work == NULL || eigenValues == NULL) {
+    free(matrix);
+    free(work);
+    free(eigenValues);
+    return 1;
+  }
+
+  printf("Time of the largest eigenpairs of Gaussian kernel covariance "
+         "matrices (ms)\n");
+  printf("%6s %8s %10s %10s %10s\n", "size", "wanted", "products",
+         "lanczos", "dense");
+
+  for (size_t size = MIN_SIZE; size <= MAX_SIZE; size *= 2) {
+    const double width = 0.05 * size;
+    for (size_t i = 0; i < size; ++i) {
+      for (size_t j = 0; j < size; ++j) {
+        const double distance = ((double)i - (double)j) / width;
+        matrix[i * size + j] = exp(-distance * distance);
+      }
+    }
+
+    const double dense = size <= MAX_DENSE_SIZE
+                             ? denseMilliseconds(matrix, size, work,
+                                                 eigenValues)
+                             : -1.0;
+    kernel_matrix data = {matrix, 0};
+    for (unsigned k = 0; k < sizeof(nbWanted) / sizeof(nbWanted[0]); ++k) {
+      const double top =
+          topMilliseconds(&data, size, nbWanted[k], eigenValues, work);
+      printf("%6zu %8zu %10zu %10.3f", size, nbWanted[k], data.nbProducts,
+             top);
+      if (dense >= 0.0) {
+        printf(" %10.3f\n", dense);
+      } else {
+        printf(" %10s\n", "-");
+      }
+    }
+  }
+
+  free(matrix);
+  free(work);
+  free(eigenValues);
+  return 0;
+}
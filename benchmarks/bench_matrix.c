@@ -0,0 +1,110 @@
+#include <1chipml.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Square sizes from MIN_SIZE to MAX_SIZE, doubling each time. The naive loop
+// is only timed up to MAX_NAIVE_SIZE, as it gets very slow.
+#define MIN_SIZE 8
+#define MAX_SIZE 1024
+#define MAX_NAIVE_SIZE 512
+
+// Minimum time spent on each measure, in seconds
+#define MIN_SECONDS 0.2
+
+/**
+ * @brief The triple loop matrixMultiply used before the blocked version
+ */
+static void naiveMultiply(const matrix_real_number* firstMatrix,
+                          const matrix_real_number* secondMatrix,
+                          const matrix_size size[3],
+                          matrix_real_number* output,
+                          const matrix_size transposeFirstMatrix) {
+  const matrix_size m = size[0];
+  const matrix_size n = size[1];
+  const matrix_size p = size[2];
+  for (matrix_size i = 0; i < m; ++i) {
+    for (matrix_size j = 0; j < p; ++j) {
+      matrix_real_number sum = 0.0;
+      for (matrix_size k = 0; k < n; ++k) {
+        sum += (transposeFirstMatrix ? firstMatrix[coordToIndex(k, i, n)]
+                                     : firstMatrix[coordToIndex(i, k, n)]) *
+               secondMatrix[coordToIndex(k, j, p)];
+      }
+      output[coordToIndex(i, j, p)] = sum;
+    }
+  }
+}
+
+/**
+ * @brief Returns the GFLOP/s of a multiplication function, on square matrices
+ */
+static double gigaflops(void (*multiply)(const matrix_real_number*,
+                                         const matrix_real_number*,
+                                         const matrix_size[3],
+                                         matrix_real_number*,
+                                         const matrix_size),
+                        const matrix_size size,
+                        const matrix_real_number* first,
+                        const matrix_real_number* second,
+                        matrix_real_number* output, const int transpose) {
+  const matrix_size sizes[3] = {size, size, size};
+  unsigned repetitions = 0;
+  const clock_t start = clock();
+  clock_t elapsed;
+  do {
+    multiply(first, second, sizes, output, transpose);
+    ++repetitions;
+    elapsed = clock() - start;
+  } while (elapsed < MIN_SECONDS * CLOCKS_PER_SEC);
+
+  const double seconds = (double)elapsed / CLOCKS_PER_SEC;
+  return 2.0 * size * size * size * repetitions / seconds * 1e-9;
+}
+
+int main() {
+
+  const size_t elements = (size_t)MAX_SIZE * MAX_SIZE;
+  matrix_real_number* first = malloc(elements * sizeof(matrix_real_number));
+  matrix_real_number* second = malloc(elements * sizeof(matrix_real_number));
+  matrix_real_number* output = malloc(elements * sizeof(matrix_real_number));
+  if (first == NULL || second == NULL || output == NULL) {
+    free(first);
+    free(second);
+    free(output);
+    return 1;
+  }
+
+  for (size_t i = 0; i < elements; ++i) {
+    first[i] = 2.0 * rand() / RAND_MAX - 1.0;
+    second[i] = 2.0 * rand() / RAND_MAX - 1.0;
+  }
+
+  printf("GFLOP/s of square matrix products\n");
+  printf("%6s %10s %10s %10s %10s\n", "size", "naive", "blocked", "naive",
+         "blocked");
+  printf("%6s %10s %10s %10s %10s\n", "", "", "", "transposed", "transposed");
+
+  for (matrix_size size = MIN_SIZE; size <= MAX_SIZE; size *= 2) {
+    const double blocked =
+        gigaflops(matrixMultiply, size, first, second, output, 0);
+    const double blockedTransposed =
+        gigaflops(matrixMultiply, size, first, second, output, 1);
+    if (size <= MAX_NAIVE_SIZE) {
+      const double naive =
+          gigaflops(naiveMultiply, size, first, second, output, 0);
+      const double naiveTransposed =
+          gigaflops(naiveMultiply, size, first, second, output, 1);
+      printf("%6u %10.2f %10.2f %10.2f %10.2f\n", size, naive, blocked,
+             naiveTransposed, blockedTransposed);
+    } else {
+      printf("%6u %10s %10.2f %10s %10.2f\n", size, "-", blocked, "-",
+             blockedTransposed);
+    }
+  }
+
+  free(first);
+  free(second);
+  free(output);
+  return 0;
+}
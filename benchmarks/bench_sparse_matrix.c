@@ -0,0 +1,203 @@
+#include <1chipml.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Square matrices of these sizes are timed with each density, as long as they
+// have at most MAX_NON_ZEROS elements. The dense product is only timed up to
+// MAX_DENSE_SIZE.
+#define MAX_NON_ZEROS 4000000
+#define MAX_DENSE_SIZE 2000
+
+// Minimum time spent on each measure, in seconds
+#define MIN_SECONDS 0.2
+
+/**
+ * @brief Returns the GFLOP/s of sparseMatrixVectorMultiply
+ */
+static double sparseGigaflops(const sparse_matrix* matrix,
+                              const matrix_real_number* vector,
+                              matrix_real_number* output,
+                              const int transpose) {
+  unsigned repetitions = 0;
+  const clock_t start = clock();
+  clock_t elapsed;
+  do {
+    sparseMatrixVectorMultiply(matrix, vector, output, transpose);
+    ++repetitions;
+    elapsed = clock() - start;
+  } while (elapsed < MIN_SECONDS * CLOCKS_PER_SEC);
+
+  const double seconds = (double)elapsed / CLOCKS_PER_SEC;
+  return 2.0 * matrix->nbNonZeros * repetitions / seconds * 1e-9;
+}
+
+/**
+ * @brief Returns the GFLOP/s of matrixVectorMultiply on the dense matrix, only
+ * counting the operations on non-zero elements, as the sparse product does
+ */
+static double denseGigaflops(const matrix_real_number* matrix,
+                             const matrix_size size,
+                             const matrix_size nbNonZeros,
+                             const matrix_real_number* vector,
+                             matrix_real_number* output) {
+  unsigned repetitions = 0;
+  const clock_t start = clock();
+  clock_t elapsed;
+  do {
+    matrixVectorMultiply(matrix, vector, size, size, output, 0);
+    ++repetitions;
+    elapsed = clock() - start;
+  } while (elapsed < MIN_SECONDS * CLOCKS_PER_SEC);
+
+  const double seconds = (double)elapsed / CLOCKS_PER_SEC;
+  return 2.0 * nbNonZeros * repetitions / seconds * 1e-9;
+}
+
+/**
+ * @brief Times the products of one matrix and prints a line of the table
+ */
+static void printLine(const char* name, sparse_matrix* matrix,
+                      const matrix_real_number* vector,
+                      matrix_real_number* output) {
+  if (matrix == NULL) {
+    printf("%-22s could not be allocated\n", name);
+    return;
+  }
+
+  const matrix_size size = matrix->nbRows;
+  const double sparse = sparseGigaflops(matrix, vector, output, 0);
+  const double sparseTransposed = sparseGigaflops(matrix, vector, output, 1);
+  matrix_real_number* dense = NULL;
+  if (size <= MAX_DENSE_SIZE) {
+    dense = calloc((size_t)size * size, sizeof(matrix_real_number));
+  }
+
+  if (dense != NULL) {
+    for (matrix_size i = 0; i < size; ++i) {
+      for (matrix_size k = matrix->rowOffsets[i];
+           k < matrix->rowOffsets[i + 1]; ++k) {
+        dense[coordToIndex(i, matrix->columns[k], size)] = matrix->values[k];
+      }
+    }
+    printf("%-22s %10u %10.2f %10.2f %10.2f\n", name, matrix->nbNonZeros,
+           denseGigaflops(dense, size, matrix->nbNonZeros, vector, output),
+           sparse, sparseTransposed);
+  } else {
+    printf("%-22s %10u %10s %10.2f %10.2f\n", name, matrix->nbNonZeros, "-",
+           sparse, sparseTransposed);
+  }
+  free(dense);
+}
+
+/**
+ * @brief Random square matrix with about density * size * size elements
+ */
+static sparse_matrix* createRandomMatrix(const matrix_size size,
+                                         const double density,
+                                         matrix_size* rows, matrix_size* cols,
+                                         matrix_real_number* values) {
+  const matrix_size nbPerRow = density * size < 1 ? 1 : density * size;
+  matrix_size nbEntries = 0;
+  for (matrix_size i = 0; i < size; ++i) {
+    for (matrix_size k = 0; k < nbPerRow; ++k) {
+      rows[nbEntries] = i;
+      cols[nbEntries] = rand() % size;
+      values[nbEntries++] = 2.0 * rand() / RAND_MAX - 1.0;
+    }
+  }
+  return sparseMatrixCreate(size, size, nbEntries, rows, cols, values);
+}
+
+/**
+ * @brief Laplacian of a 2D grid of side * side points, with the 5-point
+ * stencil
+ */
+static sparse_matrix* createLaplacian(const matrix_size side,
+                                      matrix_size* rows, matrix_size* cols,
+                                      matrix_real_number* values) {
+  matrix_size nbEntries = 0;
+  for (matrix_size y = 0; y < side; ++y) {
+    for (matrix_size x = 0; x < side; ++x) {
+      const matrix_size i = y * side + x;
+      const matrix_size neighbours[4] = {y > 0 ? i - side : i,
+                                         x > 0 ? i - 1 : i,
+                                         x + 1 < side ? i + 1 : i,
+                                         y + 1 < side ? i + side : i};
+      rows[nbEntries] = i;
+      cols[nbEntries] = i;
+      values[nbEntries++] = 4.0;
+      for (unsigned n = 0; n < 4; ++n) {
+        if (neighbours[n] != i) {
+          rows[nbEntries] = i;
+          cols[nbEntries] = neighbours[n];
+          values[nbEntries++] = -1.0;
+        }
+      }
+    }
+  }
+  return sparseMatrixCreate(side * side, side * side, nbEntries, rows, cols,
+                            values);
+}
+
+int main() {
+
+  const matrix_size sizes[] = {1000, 2000, 10000, 100000};
+  const double densities[] = {0.0001, 0.001, 0.01, 0.1};
+  const matrix_size sides[] = {30, 100, 316};
+  const matrix_size maxSize = 100000;
+
+  matrix_size* rows = malloc(MAX_NON_ZEROS * sizeof(matrix_size));
+  matrix_size* cols = malloc(MAX_NON_ZEROS * sizeof(matrix_size));
+  matrix_real_number* values =
+      malloc(MAX_NON_ZEROS * sizeof(matrix_real_number));
+  matrix_real_number* vector = malloc(maxSize * sizeof(matrix_real_number));
+  matrix_real_number* output = malloc(maxSize * sizeof(matrix_real_number));
+  if (rows == NULL || cols == NULL || values == NULL || vector == NULL ||
+      output == NULL) {
+    free(rows);
+    free(cols);
+    free(values);
+    free(vector);
+    free(output);
+    return 1;
+  }
+
+  for (matrix_size i = 0; i < maxSize; ++i) {
+    vector[i] = 2.0 * rand() / RAND_MAX - 1.0;
+  }
+
+  printf("GFLOP/s of matrix-vector products, counting the non-zero elements "
+         "only\n");
+  printf("%-22s %10s %10s %10s %10s\n", "matrix", "non-zeros", "dense", "CSR",
+         "CSR");
+  printf("%-22s %10s %10s %10s %10s\n", "", "", "", "", "transposed");
+
+  char name[32];
+  for (unsigned s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+    for (unsigned d = 0; d < sizeof(densities) / sizeof(densities[0]); ++d) {
+      if (densities[d] * sizes[s] * sizes[s] > MAX_NON_ZEROS) {
+        continue;
+      }
+      sparse_matrix* matrix =
+          createRandomMatrix(sizes[s], densities[d], rows, cols, values);
+      snprintf(name, sizeof(name), "%u, %.2f%%", sizes[s], 100 * densities[d]);
+      printLine(name, matrix, vector, output);
+      sparseMatrixDestroy(matrix);
+    }
+  }
+
+  for (unsigned s = 0; s < sizeof(sides) / sizeof(sides[0]); ++s) {
+    sparse_matrix* matrix = createLaplacian(sides[s], rows, cols, values);
+    snprintf(name, sizeof(name), "Laplacian %u x %u", sides[s], sides[s]);
+    printLine(name, matrix, vector, output);
+    sparseMatrixDestroy(matrix);
+  }
+
+  free(rows);
+  free(cols);
+  free(values);
+  free(vector);
+  free(output);
+  return 0;
+}
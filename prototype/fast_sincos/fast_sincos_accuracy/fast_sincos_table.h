@@ -0,0 +1 @@
+../../../src/fast_sincos_table.h
\ No newline at end of file
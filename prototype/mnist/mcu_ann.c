@@ -5,6 +5,11 @@
 #include <string.h>
 #include <math.h>
 
+/* Define MCU_ANN_FAST_MATH to the degree of fastExp to use in the softmax. */
+#ifdef MCU_ANN_FAST_MATH
+#include "fast_math.h"
+#endif
+
 /*
  * Load NN model from network_weights.h. 
  */
@@ -83,7 +88,11 @@ void activation_func(layer *layer) {
   } else if (layer->act_function == softmax) {
     double sum = 0.;
     for (unsigned int n = 0; n < layer->num_of_neurons; n++) {
+#ifdef MCU_ANN_FAST_MATH
+      layer->output[n] = fastExp(layer->output[n], MCU_ANN_FAST_MATH);
+#else
       layer->output[n] = exp(layer->output[n]);
+#endif
       sum += layer->output[n];
     }
     for (unsigned int n = 0; n < layer->num_of_neurons; n++) {
@@ -0,0 +1 @@
+../../../src/matrix.c
\ No newline at end of file
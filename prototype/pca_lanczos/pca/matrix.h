@@ -0,0 +1 @@
+../../../src/matrix.h
\ No newline at end of file
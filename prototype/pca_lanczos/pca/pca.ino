@@ -13,6 +13,7 @@
 
 #include "lanczos.h"
 #include "jacobi.h"
+#include "matrix.h"
 #include "arduino_serial_port.hpp"
 
 /**
@@ -37,8 +38,8 @@ double findMean(uint8_t* ptr, uint16_t nbValues, uint16_t offset, uint8_t stride
 * @param A pointer to the dataset
 * @param the number of columns in the dataset
 * @param the number of rows in the dataset
-* @param A pointer to store the covariance matrix
-* The size must be nbElemsCov * nbElemsCov
+* @param A pointer to store the covariance matrix in packed storage
+* The size must be nbElemsCov * (nbElemsCov + 1) / 2
 **/
 void computeCovarianceMatrix(uint8_t* ptr, uint8_t nbElemsCov, uint8_t nbElems, double* output)
 {
@@ -48,18 +49,16 @@ void computeCovarianceMatrix(uint8_t* ptr, uint8_t nbElemsCov, uint8_t nbElems,
     means[i] = findMean(ptr, nbElems, i, nbElemsCov);
   }
 
-  for(uint8_t j = 0; j < nbElemsCov; ++j)
+  // Only the upper triangle is accumulated, one centered sample at a time
+  memset(output, 0, symmetricPackedSize(nbElemsCov) * sizeof(double));
+  double centered[nbElemsCov];
+  for(uint16_t i = 0; i < nbElems; ++i)
   {
-    for(uint8_t k = 0; k < nbElemsCov; ++k)
+    for(uint8_t j = 0; j < nbElemsCov; ++j)
     {
-      double tmp = 0;
-      for(uint16_t i = 0; i < nbElems; ++i)
-      {
-        tmp += ((ptr[i * nbElemsCov + j] - means[j]) * (ptr[i * nbElemsCov + k] - means[k]));
-      }
-      tmp /= (nbElems - 1);
-      output[j * nbElemsCov + k] = tmp; 
+      centered[j] = ptr[i * nbElemsCov + j] - means[j];
     }
+    symmetricRank1Update(output, nbElemsCov, 1.0 / (nbElems - 1), centered);
   }
 }
 
@@ -131,7 +130,8 @@ void loop()
     // This is because all values are using the same scale and no normalization is needed
     // Normalizing the values would require to store them using float which would quadruple the memory usage
     // And we would need 1.6kB to store the sample rather than 400 bytes.
-    double covarianceMatrix[nbCaracteristicPerEntries * nbCaracteristicPerEntries];
+    // The matrix is symmetric, so only its upper triangle is stored.
+    double covarianceMatrix[symmetricPackedSize(nbCaracteristicPerEntries)];
     computeCovarianceMatrix(sample, nbCaracteristicPerEntries, nbValues, covarianceMatrix);
 
     //////////// Call Lanczos to simplify eigen vectors/values calculation ///////////
@@ -139,7 +139,7 @@ void loop()
     memset(tMatrix, 0, nbCaracteristicPerEntries * nbCaracteristicPerEntries * sizeof(double));
 
     double vMatrix[nbCaracteristicPerEntries * nbCaracteristicPerEntries];
-    lanczos(covarianceMatrix, nbCaracteristicPerEntries, nbCaracteristicPerEntries, NULL, tMatrix, vMatrix);
+    lanczosPacked(covarianceMatrix, nbCaracteristicPerEntries, nbCaracteristicPerEntries, NULL, tMatrix, vMatrix);
     
     //////////// Call jacobi to find eigenVectors and eigenValues ///////////
     double eigenVectors[nbCaracteristicPerEntries * nbCaracteristicPerEntries];
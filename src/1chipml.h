@@ -17,6 +17,9 @@
 /* Include 1chipML methods below */
 #include "./DFT.h"
 #include "./FFT.h"
+#include "./FFT2D.h"
+#include "./FFT_fixed.h"
+#include "./fast_math.h"
 #include "./fast_sincos.h"
 #include "./finite_difference.h"
 #include "./gauss_elimination.h"
@@ -24,9 +27,14 @@
 #include "./gradient_descent.h"
 #include "./jacobi.h"
 #include "./lanczos.h"
+#include "./lanczos_top_eigen.h"
 #include "./linear_congruential_random_generator.h"
 #include "./lu_decomposition.h"
+#include "./matrix.h"
 #include "./poly_interpolation.h"
+#include "./sparse_matrix.h"
+#include "./stft.h"
 #include "./stats.h"
+#include "./symmetric_eigen.h"
 
 /* -- End of file -- */
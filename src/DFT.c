@@ -46,3 +46,243 @@ void DFT(const unsigned length, dft_real* realArray, dft_real* imaginaryArray,
   memcpy(realArray, outputReals, length * sizeof(dft_real));
   memcpy(imaginaryArray, outputImaginaries, length * sizeof(dft_real));
 }
+
+/**
+ * @brief Computes the roots of unity used by DFTWorkspace.
+ * The workspace can then be used by any number of DFTs of the same length.
+ * @param length The length of the DFT
+ * @param workspace Array of DFT_WORKSPACE_SIZE(length) elements. Its first
+ * 2 * length elements receive cos(2 * pi * k / length) and
+ * sin(2 * pi * k / length)
+ */
+void dftWorkspaceInit(const unsigned length, dft_real* workspace) {
+  dft_real* rootReals = workspace;
+  dft_real* rootImgs = workspace + length;
+  for (unsigned k = 0; k < length; ++k) {
+    const dft_real angle = 2.0 * M_PI * k / length;
+    rootReals[k] = cos(angle);
+    rootImgs[k] = sin(angle);
+  }
+}
+
+/**
+ * @brief Computes the DFT with precomputed roots of unity.
+ * Same as DFT, but the root of unity of the element k of the bin i is read
+ * from the workspace at the index (i * k) mod length. No trigonometric
+ * function is called and no memory is allocated on the stack.
+ * @param length The length of the input vectors.
+ * @param realArray 1D array containing the real part of the incoming vector.
+ * This array will contain the end result of the real part of the DFT
+ * @param imaginaryArray 1D array containing the imaginary part of the incoming
+ * vector. This array will contain the end result of the imaginary part of the
+ * DFT
+ * @param dir Direction of the DFT. 1 for the DFT, -1 for the inverse DFT
+ * @param workspace Array of DFT_WORKSPACE_SIZE(length) elements, initialized
+ * with dftWorkspaceInit for this length
+ */
+void DFTWorkspace(const unsigned length, dft_real* realArray,
+                  dft_real* imaginaryArray, const int dir,
+                  dft_real* workspace) {
+
+  const dft_real* rootReals = workspace;
+  const dft_real* rootImgs = workspace + length;
+  dft_real* outputReals = workspace + 2 * length;
+  dft_real* outputImaginaries = workspace + 3 * length;
+
+  const dft_real thetaFactor = dir < 0 ? 1.0 : -1.0;
+
+  for (unsigned i = 0; i < length; ++i) {
+    dft_real real = 0.0;
+    dft_real imaginary = 0.0;
+
+    // (i * k) mod length, updated without multiplication nor modulus
+    unsigned rootIndex = 0;
+    for (unsigned k = 0; k < length; ++k) {
+      const dft_real wCos = rootReals[rootIndex];              // real part
+      const dft_real wSin = thetaFactor * rootImgs[rootIndex]; // imaginary part
+      real += realArray[k] * wCos - imaginaryArray[k] * wSin;
+      imaginary += realArray[k] * wSin + imaginaryArray[k] * wCos;
+
+      rootIndex += i;
+      if (rootIndex >= length) {
+        rootIndex -= length;
+      }
+    }
+
+    outputReals[i] = real;
+    outputImaginaries[i] = imaginary;
+  }
+
+  // inverse DFT
+  if (dir < 0) {
+    const dft_real inverseLength = 1.0 / length;
+    for (unsigned i = 0; i < length; ++i) {
+      outputReals[i] *= inverseLength;
+      outputImaginaries[i] *= inverseLength;
+    }
+  }
+
+  // place result in arrays
+  memcpy(realArray, outputReals, length * sizeof(dft_real));
+  memcpy(imaginaryArray, outputImaginaries, length * sizeof(dft_real));
+}
+
+/**
+ * Computes one bin of the DFT of a real vector with the Goertzel algorithm.
+ * The recurrence s[n] = x[n] + 2 * cos(w) * s[n - 1] - s[n - 2] is run for
+ * every sample, then once more with a null sample, after which
+ * s[length] - exp(-i * w) * s[length - 1] is the bin.
+ * @param length The length of the vector
+ * @param input The real vector, read as a circular buffer
+ * @param start The position of the first sample in input
+ * @param wReal cos(w), where w = 2 * pi * k / length for the bin k
+ * @param wImaginary sin(w)
+ * @param outputReal Receives the real part of the bin
+ * @param outputImg Receives the imaginary part of the bin
+ */
+static void goertzelBin(const unsigned length, const dft_real* input,
+                        unsigned start, const dft_real wReal,
+                        const dft_real wImaginary, dft_real* outputReal,
+                        dft_real* outputImg) {
+
+  const dft_real coefficient = 2.0 * wReal;
+  dft_real s1 = 0.0; // s[n - 1]
+  dft_real s2 = 0.0; // s[n - 2]
+  for (unsigned n = 0; n < length; ++n) {
+    const dft_real s0 = input[start] + coefficient * s1 - s2;
+    s2 = s1;
+    s1 = s0;
+    if (++start == length) {
+      start = 0;
+    }
+  }
+  const dft_real last = coefficient * s1 - s2;
+
+  *outputReal = last - wReal * s1;
+  *outputImg = wImaginary * s1;
+}
+
+/**
+ * @brief Computes selected bins of the DFT with the Goertzel algorithm.
+ * Each bin costs one multiplication and two additions per sample, and a
+ * single cosine and sine. This is faster than the FFT when only a few bins
+ * are needed.
+ * @param length The length of the input vector
+ * @param realArray 1D array containing the real part of the incoming vector
+ * @param imaginaryArray 1D array containing the imaginary part of the incoming
+ * vector. NULL for a real vector
+ * @param nbBins The number of bins to compute
+ * @param bins The index of each bin, smaller than length
+ * @param outputReals Receives the real part of each bin
+ * @param outputImgs Receives the imaginary part of each bin
+ */
+void goertzel(const unsigned length, const dft_real* realArray,
+              const dft_real* imaginaryArray, const unsigned nbBins,
+              const unsigned* bins, dft_real* outputReals,
+              dft_real* outputImgs) {
+
+  for (unsigned b = 0; b < nbBins; ++b) {
+    const dft_real angle = 2.0 * M_PI * bins[b] / length;
+    const dft_real wReal = cos(angle);
+    const dft_real wImaginary = sin(angle);
+
+    dft_real real;
+    dft_real imaginary;
+    goertzelBin(length, realArray, 0, wReal, wImaginary, &real, &imaginary);
+
+    // The DFT is linear: X = DFT(real part) + i * DFT(imaginary part)
+    if (imaginaryArray != NULL) {
+      dft_real imaginaryReal;
+      dft_real imaginaryImaginary;
+      goertzelBin(length, imaginaryArray, 0, wReal, wImaginary,
+                  &imaginaryReal, &imaginaryImaginary);
+      real -= imaginaryImaginary;
+      imaginary += imaginaryReal;
+    }
+
+    outputReals[b] = real;
+    outputImgs[b] = imaginary;
+  }
+}
+
+/**
+ * @brief Initializes a sliding DFT. The history starts with length null
+ * samples, so every bin starts at 0.
+ * @param transform The sliding DFT to initialize
+ * @param length The number of samples of the window
+ * @param nbBins The number of bins to compute
+ * @param bins The index of each bin, smaller than length
+ * @param memory Array of SLIDING_DFT_MEMORY_SIZE(length, nbBins) elements,
+ * which must stay valid while the sliding DFT is used
+ * @return 1 if an error occured, 0 otherwise
+ */
+int slidingDFTInit(sliding_dft* transform, const unsigned length,
+                   const unsigned nbBins, const unsigned* bins,
+                   dft_real* memory) {
+  if (transform == NULL || length == 0 || bins == NULL || memory == NULL) {
+    return 1;
+  }
+
+  transform->length = length;
+  transform->nbBins = nbBins;
+  transform->oldest = 0;
+  transform->history = memory;
+  transform->twiddleReals = memory + length;
+  transform->twiddleImgs = transform->twiddleReals + nbBins;
+  transform->binReals = transform->twiddleImgs + nbBins;
+  transform->binImgs = transform->binReals + nbBins;
+
+  memset(transform->history, 0, length * sizeof(dft_real));
+  for (unsigned b = 0; b < nbBins; ++b) {
+    const dft_real angle = 2.0 * M_PI * bins[b] / length;
+    transform->twiddleReals[b] = cos(angle);
+    transform->twiddleImgs[b] = sin(angle);
+    transform->binReals[b] = 0.0;
+    transform->binImgs[b] = 0.0;
+  }
+  return 0;
+}
+
+/**
+ * @brief Pushes a sample to a sliding DFT and updates its bins.
+ * The oldest sample leaves the window and each bin is updated with
+ * X = (X + newSample - oldSample) * exp(2 * pi * i * k / length), which costs
+ * a complex multiplication. The rounding errors of this recurrence accumulate,
+ * so each bin is recomputed from the history with the Goertzel algorithm
+ * once every length samples. The recomputations are spread over the window:
+ * a push recomputes at most ceil(nbBins / length) bins, each costing a
+ * multiplication and two additions per sample of the window. On average,
+ * this adds a multiplication and two additions per bin and sample.
+ * @param transform The sliding DFT
+ * @param sample The new sample
+ */
+void slidingDFTPush(sliding_dft* transform, const dft_real sample) {
+
+  const unsigned nbBins = transform->nbBins;
+  const dft_real difference = sample - transform->history[transform->oldest];
+  transform->history[transform->oldest] = sample;
+  if (++transform->oldest == transform->length) {
+    transform->oldest = 0;
+  }
+
+  for (unsigned b = 0; b < nbBins; ++b) {
+    const dft_real real = transform->binReals[b] + difference;
+    const dft_real imaginary = transform->binImgs[b];
+    const dft_real wReal = transform->twiddleReals[b];
+    const dft_real wImaginary = transform->twiddleImgs[b];
+    transform->binReals[b] = real * wReal - imaginary * wImaginary;
+    transform->binImgs[b] = real * wImaginary + imaginary * wReal;
+  }
+
+  // Recomputes the bins b with floor(b * length / nbBins) == oldest, so each
+  // bin is recomputed once per window. The oldest sample is the first one
+  const unsigned oldest = transform->oldest;
+  const unsigned length = transform->length;
+  const unsigned first = ((size_t)oldest * nbBins + length - 1) / length;
+  const unsigned end = ((size_t)(oldest + 1) * nbBins + length - 1) / length;
+  for (unsigned b = first; b < end; ++b) {
+    goertzelBin(length, transform->history, oldest, transform->twiddleReals[b],
+                transform->twiddleImgs[b], &transform->binReals[b],
+                &transform->binImgs[b]);
+  }
+}
@@ -9,13 +9,50 @@
 #define M_PI 3.14159265358979323846
 #endif
 
+// Number of dft_real elements of the workspace given to DFTWorkspace
+#define DFT_WORKSPACE_SIZE(length) (4 * (length))
+
+// Number of dft_real elements of the memory given to slidingDFTInit
+#define SLIDING_DFT_MEMORY_SIZE(length, nbBins) ((length) + 4 * (nbBins))
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * Sliding DFT of a real stream. After each sample, the selected bins are the
+ * DFT of the last length samples, the oldest one being the first.
+ * The memory is provided by the caller, see slidingDFTInit.
+ */
+typedef struct sliding_dft {
+  unsigned length;        // Number of samples of the window
+  unsigned nbBins;        // Number of computed bins
+  unsigned oldest;        // Position of the oldest sample in the history
+  dft_real* history;      // Last length samples
+  dft_real* twiddleReals; // cos(2 * pi * k / length) for each bin k
+  dft_real* twiddleImgs;  // sin(2 * pi * k / length) for each bin k
+  dft_real* binReals;     // Real part of each bin
+  dft_real* binImgs;      // Imaginary part of each bin
+} sliding_dft;
+
 void DFT(const unsigned length, dft_real* realArray, dft_real* imaginaryArray,
          const int dir);
 
+void dftWorkspaceInit(const unsigned length, dft_real* workspace);
+void DFTWorkspace(const unsigned length, dft_real* realArray,
+                  dft_real* imaginaryArray, const int dir,
+                  dft_real* workspace);
+
+void goertzel(const unsigned length, const dft_real* realArray,
+              const dft_real* imaginaryArray, const unsigned nbBins,
+              const unsigned* bins, dft_real* outputReals,
+              dft_real* outputImgs);
+
+int slidingDFTInit(sliding_dft* transform, const unsigned length,
+                   const unsigned nbBins, const unsigned* bins,
+                   dft_real* memory);
+void slidingDFTPush(sliding_dft* transform, const dft_real sample);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,6 +1,7 @@
 #include "FFT.h"
 #include <math.h>
 #include <stdlib.h>
+#include <string.h>
 
 /**
  * This method implements bit reversal needed by the FFT.
@@ -41,26 +42,88 @@ static inline int isPowerOfTwo(const unsigned value) {
 }
 
 /**
+ * Scales the result of an inverse FFT by 1 / length
+ * @param length The length of the input vectors.
+ * @param realArray 1D array containing the real part of the vector.
+ * @param imaginaryArray 1D array containing the imaginary part of the vector.
+ */
+static void scaleInverse(const unsigned length, fft_real* realArray,
+                         fft_real* imaginaryArray) {
+  const fft_real inverseLength = 1.0 / length;
+  for (unsigned i = 0; i < length; ++i) {
+    realArray[i] *= inverseLength;
+    imaginaryArray[i] *= inverseLength;
+  }
+}
+
+/**
+ * Radix-2 butterfly on the elements i0 and i1, with the twiddle factor w.
+ */
+static inline void radix2Butterfly(fft_real* realArray,
+                                   fft_real* imaginaryArray,
+                                   const unsigned i0, const unsigned i1,
+                                   const fft_real wReal,
+                                   const fft_real wImaginary) {
+  fft_real realArrayi1 = realArray[i1];
+  fft_real imaginaryArrayi1 = imaginaryArray[i1];
+
+  fft_real tReal = wReal * realArrayi1 - wImaginary * imaginaryArrayi1;
+  fft_real tImaginary = wReal * imaginaryArrayi1 + wImaginary * realArrayi1;
+  realArray[i1] = realArray[i0] - tReal;
+  imaginaryArray[i1] = imaginaryArray[i0] - tImaginary;
+  realArray[i0] += tReal;
+  imaginaryArray[i0] += tImaginary;
+}
+
+/**
+ * Applies the radix-2 butterflies of one branch element, sharing the twiddle
+ * factor w, to the groups of a level from first up to end.
+ * Each butterfly is applied to a batch of vectors, where the element j of the
+ * vector b is at b * distance + j * stride. A single contiguous vector is
+ * count = 1, stride = 1 and distance = 0.
+ * @param realArray 1D array containing the real part of the vectors.
+ * @param imaginaryArray 1D array containing the imaginary part of the vectors.
+ * @param first Index of the branch element in the first group
+ * @param end Index where the groups end
+ * @param depth Length of the groups of the level
+ * @param nElements Distance between the two elements of a butterfly
+ * @param count The number of vectors
+ * @param stride The distance between two elements of a vector
+ * @param distance The distance between the first elements of two vectors
+ * @param wReal Real part of the twiddle factor
+ * @param wImaginary Imaginary part of the twiddle factor
+ */
+static inline void radix2BranchElement(
+    fft_real* realArray, fft_real* imaginaryArray, const unsigned first,
+    const unsigned end, const unsigned depth, const unsigned nElements,
+    const unsigned count, const unsigned stride, const unsigned distance,
+    const fft_real wReal, const fft_real wImaginary) {
+  for (unsigned branch = first; branch < end;
+       branch += depth) { // current group on depth level
+    const unsigned element0 = branch * stride;
+    const unsigned element1 = element0 + nElements * stride;
+    for (unsigned b = 0; b < count; ++b) { // vector of the batch
+      radix2Butterfly(realArray, imaginaryArray, b * distance + element0,
+                      b * distance + element1, wReal, wImaginary);
+    }
+  }
+}
+
+/**
+ * Computes every level of the FFT with radix-2 butterflies. The twiddle
+ * factors are updated using the trigonometric recurrence formula.
+ * The incoming vectors must already be in bit-reversed order.
  * @param length The length of the input vectors. Must be a power of 2
  * @param realArray 1D array containing the real part of the incoming vector.
- * This array will contain the end result of the real part of the FFT
  * @param imaginaryArray 1D array containing the imaginary part of the incoming
- * vector. This array will contain the end result of the imaginary part of the
- * FFT
+ * vector.
  * @param dir Direction of the FFT. 1 for the FFT, -1 for the inverse FFT
- * @return 1 if an error occured, 0 otherwise
- *
  */
-int FFT(const unsigned length, fft_real* realArray, fft_real* imaginaryArray,
-        const int dir) {
-  if (!isPowerOfTwo(length) || realArray == NULL || imaginaryArray == NULL) {
-    return 1;
-  }
+static void radix2Levels(const unsigned length, fft_real* realArray,
+                         fft_real* imaginaryArray, const int dir) {
 
   int thetaFactor = dir < 0 ? 1 : -1;
 
-  goldRaderBitReversal(length, realArray, imaginaryArray);
-
   unsigned depth = 1;
   for (unsigned n = 1; n < length; n <<= 1) { // for the levels
 
@@ -78,22 +141,189 @@ int FFT(const unsigned length, fft_real* realArray, fft_real* imaginaryArray,
     for (unsigned branchElement = 0; branchElement < nElements;
          ++branchElement) { // branch element
 
-      for (unsigned branch = branchElement; branch < length;
-           branch += depth) { // current group on depth level
-
-        // Complex multiplications, using a butterfly operation
-        unsigned i1 = branch + nElements;
-        fft_real realArrayi1 = realArray[i1];
-        fft_real imaginaryArrayi1 = imaginaryArray[i1];
-
-        fft_real tReal = wReal * realArrayi1 - wImaginary * imaginaryArrayi1;
-        fft_real tImaginary =
-            wReal * imaginaryArrayi1 + wImaginary * realArrayi1;
-        realArray[i1] = realArray[branch] - tReal;
-        imaginaryArray[i1] = imaginaryArray[branch] - tImaginary;
-        realArray[branch] += tReal;
-        imaginaryArray[branch] += tImaginary;
-      }
+      radix2BranchElement(realArray, imaginaryArray, branchElement, length,
+                          depth, nElements, 1, 1, 0, wReal, wImaginary);
+
+      // update twiddle factors using trigonometric recurrence formula
+      fft_real wtempReal = wReal;
+      wReal += wReal * wRealFactor - wImaginary * wImaginaryFactor;
+      wImaginary += wImaginary * wRealFactor + wtempReal * wImaginaryFactor;
+    }
+  }
+}
+
+/**
+ * Computes the first level of the FFT, whose butterflies do not need any
+ * twiddle factor. Used when the number of levels is odd, before the radix-4
+ * levels.
+ * The element j of the vector b is at b * distance + j * stride.
+ * @param length The length of the input vectors. Must be a power of 2
+ * @param realArray 1D array containing the real part of the incoming vectors.
+ * @param imaginaryArray 1D array containing the imaginary part of the incoming
+ * vectors.
+ * @param count The number of vectors
+ * @param stride The distance between two elements of a vector
+ * @param distance The distance between the first elements of two vectors
+ */
+static inline void radix2FirstLevel(const unsigned length, fft_real* realArray,
+                                    fft_real* imaginaryArray,
+                                    const unsigned count, const unsigned stride,
+                                    const unsigned distance) {
+  for (unsigned i = 0; i < length; i += 2) {
+    for (unsigned b = 0; b < count; ++b) { // vector of the batch
+      const unsigned i0 = b * distance + i * stride;
+      const unsigned i1 = i0 + stride;
+      fft_real tReal = realArray[i1];
+      fft_real tImaginary = imaginaryArray[i1];
+      realArray[i1] = realArray[i0] - tReal;
+      imaginaryArray[i1] = imaginaryArray[i0] - tImaginary;
+      realArray[i0] += tReal;
+      imaginaryArray[i0] += tImaginary;
+    }
+  }
+}
+
+/**
+ * Radix-4 butterfly, equivalent to two consecutive levels of radix-2
+ * butterflies. The four elements are at i0, i0 + nElements, i0 + 2 *
+ * nElements and i0 + 3 * nElements. It uses 3 complex multiplications instead
+ * of the 4 needed by the radix-2 butterflies.
+ * @param realArray 1D array containing the real part of the vector.
+ * @param imaginaryArray 1D array containing the imaginary part of the vector.
+ * @param i0 Index of the first element
+ * @param nElements Distance between the elements
+ * @param w1Real Real part of the twiddle factor w
+ * @param w1Imaginary Imaginary part of the twiddle factor w
+ * @param w2Real Real part of w^2
+ * @param w2Imaginary Imaginary part of w^2
+ * @param w3Real Real part of w^3
+ * @param w3Imaginary Imaginary part of w^3
+ * @param thetaFactor -1 for the FFT, 1 for the inverse FFT
+ */
+static inline void
+radix4Butterfly(fft_real* realArray, fft_real* imaginaryArray,
+                const unsigned i0, const unsigned nElements,
+                const fft_real w1Real, const fft_real w1Imaginary,
+                const fft_real w2Real, const fft_real w2Imaginary,
+                const fft_real w3Real, const fft_real w3Imaginary,
+                const fft_real thetaFactor) {
+  const unsigned i1 = i0 + nElements;
+  const unsigned i2 = i1 + nElements;
+  const unsigned i3 = i2 + nElements;
+
+  const fft_real aReal = realArray[i0];
+  const fft_real aImaginary = imaginaryArray[i0];
+  const fft_real bReal =
+      w2Real * realArray[i1] - w2Imaginary * imaginaryArray[i1];
+  const fft_real bImaginary =
+      w2Real * imaginaryArray[i1] + w2Imaginary * realArray[i1];
+  const fft_real cReal =
+      w1Real * realArray[i2] - w1Imaginary * imaginaryArray[i2];
+  const fft_real cImaginary =
+      w1Real * imaginaryArray[i2] + w1Imaginary * realArray[i2];
+  const fft_real dReal =
+      w3Real * realArray[i3] - w3Imaginary * imaginaryArray[i3];
+  const fft_real dImaginary =
+      w3Real * imaginaryArray[i3] + w3Imaginary * realArray[i3];
+
+  const fft_real sum1Real = aReal + bReal;
+  const fft_real sum1Imaginary = aImaginary + bImaginary;
+  const fft_real diff1Real = aReal - bReal;
+  const fft_real diff1Imaginary = aImaginary - bImaginary;
+  const fft_real sum2Real = cReal + dReal;
+  const fft_real sum2Imaginary = cImaginary + dImaginary;
+  // Multiplied by thetaFactor * i, which is the twiddle factor between the
+  // two radix-2 levels
+  const fft_real diff2Real = -thetaFactor * (cImaginary - dImaginary);
+  const fft_real diff2Imaginary = thetaFactor * (cReal - dReal);
+
+  realArray[i0] = sum1Real + sum2Real;
+  imaginaryArray[i0] = sum1Imaginary + sum2Imaginary;
+  realArray[i1] = diff1Real + diff2Real;
+  imaginaryArray[i1] = diff1Imaginary + diff2Imaginary;
+  realArray[i2] = sum1Real - sum2Real;
+  imaginaryArray[i2] = sum1Imaginary - sum2Imaginary;
+  realArray[i3] = diff1Real - diff2Real;
+  imaginaryArray[i3] = diff1Imaginary - diff2Imaginary;
+}
+
+/**
+ * Same as radix2BranchElement with radix-4 butterflies, sharing the twiddle
+ * factors w, w^2 and w^3.
+ * @param thetaFactor -1 for the FFT, 1 for the inverse FFT
+ */
+static inline void radix4BranchElement(
+    fft_real* realArray, fft_real* imaginaryArray, const unsigned first,
+    const unsigned end, const unsigned depth, const unsigned nElements,
+    const unsigned count, const unsigned stride, const unsigned distance,
+    const fft_real w1Real, const fft_real w1Imaginary, const fft_real w2Real,
+    const fft_real w2Imaginary, const fft_real w3Real,
+    const fft_real w3Imaginary, const fft_real thetaFactor) {
+  for (unsigned branch = first; branch < end;
+       branch += depth) { // current group on depth level
+    const unsigned element0 = branch * stride;
+    for (unsigned b = 0; b < count; ++b) { // vector of the batch
+      radix4Butterfly(realArray, imaginaryArray, b * distance + element0,
+                      nElements * stride, w1Real, w1Imaginary, w2Real,
+                      w2Imaginary, w3Real, w3Imaginary, thetaFactor);
+    }
+  }
+}
+
+/**
+ * Returns 1 if the number of levels of an FFT of the given length is odd.
+ * @param length The length of the FFT. Must be a power of 2
+ */
+static inline int hasOddLevels(const unsigned length) {
+  // Masks the odd powers of 2
+  return (length & 0xAAAAAAAAu) != 0;
+}
+
+/**
+ * Computes every level of the FFT with radix-4 butterflies. When the number of
+ * levels is odd, the first level is done with radix-2 butterflies. The twiddle
+ * factors are updated using the trigonometric recurrence formula.
+ * The incoming vectors must already be in bit-reversed order.
+ * @param length The length of the input vectors. Must be a power of 2
+ * @param realArray 1D array containing the real part of the incoming vector.
+ * @param imaginaryArray 1D array containing the imaginary part of the incoming
+ * vector.
+ * @param dir Direction of the FFT. 1 for the FFT, -1 for the inverse FFT
+ */
+static void radix4Levels(const unsigned length, fft_real* realArray,
+                         fft_real* imaginaryArray, const int dir) {
+
+  const fft_real thetaFactor = dir < 0 ? 1.0 : -1.0;
+
+  unsigned nElements = 1;
+  if (hasOddLevels(length)) {
+    radix2FirstLevel(length, realArray, imaginaryArray, 1, 1, 0);
+    nElements = 2;
+  }
+
+  for (; nElements < length; nElements <<= 2) { // two levels at a time
+
+    const unsigned depth = nElements << 2;
+
+    // factors for trigonometric recurrence formula
+    const fft_real piOverDepth = M_PI / depth;
+    fft_real wtempSin = sin(piOverDepth);
+    fft_real wRealFactor = -2.0 * wtempSin * wtempSin;
+    fft_real wImaginaryFactor = thetaFactor * sin(2.0 * piOverDepth);
+
+    fft_real wReal = 1.0;
+    fft_real wImaginary = 0.0;
+    for (unsigned branchElement = 0; branchElement < nElements;
+         ++branchElement) { // branch element
+
+      const fft_real w2Real = wReal * wReal - wImaginary * wImaginary;
+      const fft_real w2Imaginary = 2.0 * wReal * wImaginary;
+      const fft_real w3Real = w2Real * wReal - w2Imaginary * wImaginary;
+      const fft_real w3Imaginary = w2Real * wImaginary + w2Imaginary * wReal;
+
+      radix4BranchElement(realArray, imaginaryArray, branchElement, length,
+                          depth, nElements, 1, 1, 0, wReal, wImaginary, w2Real,
+                          w2Imaginary, w3Real, w3Imaginary, thetaFactor);
 
       // update twiddle factors using trigonometric recurrence formula
       fft_real wtempReal = wReal;
@@ -101,15 +331,1122 @@ int FFT(const unsigned length, fft_real* realArray, fft_real* imaginaryArray,
       wImaginary += wImaginary * wRealFactor + wtempReal * wImaginaryFactor;
     }
   }
+}
+
+/**
+ * @param length The length of the input vectors. Powers of 2 are computed in
+ * place without any allocation. Other lengths allocate a temporary plan, see
+ * fftPlanCreate to reuse it between calls.
+ * @param realArray 1D array containing the real part of the incoming vector.
+ * This array will contain the end result of the real part of the FFT
+ * @param imaginaryArray 1D array containing the imaginary part of the incoming
+ * vector. This array will contain the end result of the imaginary part of the
+ * FFT
+ * @param dir Direction of the FFT. 1 for the FFT, -1 for the inverse FFT
+ * @return 1 if an error occured, 0 otherwise
+ *
+ */
+int FFT(const unsigned length, fft_real* realArray, fft_real* imaginaryArray,
+        const int dir) {
+  if (length == 0 || realArray == NULL || imaginaryArray == NULL) {
+    return 1;
+  }
+
+  // Other lengths need precomputed tables and a work buffer
+  if (!isPowerOfTwo(length)) {
+    fft_plan* plan = fftPlanCreate(length);
+    int returnCode = fftPlanExecute(plan, realArray, imaginaryArray, dir);
+    fftPlanDestroy(plan);
+    return returnCode;
+  }
+
+  goldRaderBitReversal(length, realArray, imaginaryArray);
+
+  if (FFT_RADIX == 4) {
+    radix4Levels(length, realArray, imaginaryArray, dir);
+  } else {
+    radix2Levels(length, realArray, imaginaryArray, dir);
+  }
+
+  // inverse FFT
+  if (dir < 0) {
+    scaleInverse(length, realArray, imaginaryArray);
+  }
+
+  return 0;
+}
+
+/**
+ * Allocates the twiddle factors exp(2 * pi * i * k / length), for
+ * k < nbTwiddles. Each twiddle factor is computed directly, which avoids the
+ * error accumulated by the trigonometric recurrence on large lengths.
+ * @return 1 if the allocation failed, 0 otherwise
+ */
+static int initTwiddles(fft_plan* plan, const unsigned nbTwiddles) {
+  plan->twiddleReals = malloc(nbTwiddles * sizeof(fft_real));
+  plan->twiddleImgs = malloc(nbTwiddles * sizeof(fft_real));
+  if (plan->twiddleReals == NULL || plan->twiddleImgs == NULL) {
+    return 1;
+  }
+
+  for (unsigned k = 0; k < nbTwiddles; ++k) {
+    const fft_real theta = 2.0 * M_PI * k / plan->length;
+    plan->twiddleReals[k] = cos(theta);
+    plan->twiddleImgs[k] = sin(theta);
+  }
+  return 0;
+}
+
+/**
+ * Initializes a plan whose length is a power of 2.
+ * @return 1 if the allocation failed, 0 otherwise
+ */
+static int initPowerOfTwoPlan(fft_plan* plan) {
+  const unsigned length = plan->length;
+
+  // The radix-4 butterflies need w^3, hence the 3 / 4 of the circle
+  if (initTwiddles(plan, length - (length >> 2)) != 0) {
+    return 1;
+  }
+
+  plan->bitReversal = malloc(length * sizeof(unsigned));
+  if (plan->bitReversal == NULL) {
+    return 1;
+  }
+
+  // Same index arithmetic as goldRaderBitReversal, stored once
+  const unsigned N2 = length >> 1;
+  unsigned j = 0;
+  for (unsigned i = 0; i < length; ++i) {
+    plan->bitReversal[i] = j;
+
+    unsigned k = N2;
+    while (k >= 1 && k <= j) {
+      j -= k;
+      k >>= 1;
+    }
+
+    j += k;
+  }
+
+  return 0;
+}
+
+/**
+ * Splits the length of a plan into factors of 4, 2, 3 and 5.
+ * @return The part of the length that could not be factorized. The plan can
+ * use the mixed-radix butterflies only if this value is 1.
+ */
+static unsigned factorize(fft_plan* plan) {
+  const unsigned radices[] = {4, 2, 3, 5};
+  unsigned remainder = plan->length;
+  plan->nbFactors = 0;
+  for (unsigned i = 0; i < sizeof(radices) / sizeof(radices[0]); ++i) {
+    while (remainder % radices[i] == 0 && plan->nbFactors < FFT_MAX_FACTORS) {
+      plan->factors[plan->nbFactors++] = radices[i];
+      remainder /= radices[i];
+    }
+  }
+  return remainder;
+}
+
+/**
+ * Initializes a plan whose length only has 2, 3 and 5 as prime factors.
+ * The factors must already be computed.
+ * @return 1 if the allocation failed, 0 otherwise
+ */
+static int initMixedRadixPlan(fft_plan* plan) {
+  plan->workReals = malloc(plan->length * sizeof(fft_real));
+  plan->workImgs = malloc(plan->length * sizeof(fft_real));
+  if (plan->workReals == NULL || plan->workImgs == NULL) {
+    return 1;
+  }
+  return initTwiddles(plan, plan->length);
+}
+
+/**
+ * Initializes a plan using Bluestein's algorithm. The FFT is rewritten as a
+ * convolution with a chirp, computed with power of 2 FFTs.
+ * @return 1 if the allocation failed, 0 otherwise
+ */
+static int initBluesteinPlan(fft_plan* plan) {
+  const unsigned length = plan->length;
+
+  // The linear convolution of two vectors of this length needs
+  // 2 * length - 1 elements
+  unsigned convolutionLength = 1;
+  while (convolutionLength < 2 * length - 1) {
+    convolutionLength <<= 1;
+  }
+
+  plan->convolutionPlan = fftPlanCreate(convolutionLength);
+  plan->chirpReals = malloc(length * sizeof(fft_real));
+  plan->chirpImgs = malloc(length * sizeof(fft_real));
+  plan->filterReals = calloc(convolutionLength, sizeof(fft_real));
+  plan->filterImgs = calloc(convolutionLength, sizeof(fft_real));
+  plan->workReals = malloc(convolutionLength * sizeof(fft_real));
+  plan->workImgs = malloc(convolutionLength * sizeof(fft_real));
+  if (plan->convolutionPlan == NULL || plan->chirpReals == NULL ||
+      plan->chirpImgs == NULL || plan->filterReals == NULL ||
+      plan->filterImgs == NULL || plan->workReals == NULL ||
+      plan->workImgs == NULL) {
+    return 1;
+  }
+
+  // chirp = exp(pi * i * k^2 / length). k^2 is reduced modulo 2 * length
+  // first, so the angle stays accurate for large k
+  const unsigned long long doubleLength = 2ull * length;
+  for (unsigned k = 0; k < length; ++k) {
+    const unsigned long long kSquared = ((unsigned long long)k * k) %
+                                        doubleLength;
+    const fft_real theta = M_PI * kSquared / length;
+    plan->chirpReals[k] = cos(theta);
+    plan->chirpImgs[k] = sin(theta);
+  }
+
+  // The filter is the chirp, wrapped around for the circular convolution
+  for (unsigned k = 0; k < length; ++k) {
+    plan->filterReals[k] = plan->chirpReals[k];
+    plan->filterImgs[k] = plan->chirpImgs[k];
+    if (k != 0) {
+      plan->filterReals[convolutionLength - k] = plan->chirpReals[k];
+      plan->filterImgs[convolutionLength - k] = plan->chirpImgs[k];
+    }
+  }
+
+  return fftPlanExecute(plan->convolutionPlan, plan->filterReals,
+                        plan->filterImgs, 1);
+}
+
+/**
+ * @brief Creates a plan for FFTs of a given length.
+ * The twiddle factors and the bit-reversal permutation are computed once
+ * here, instead of at every transform.
+ * @param length The length of the transforms. Any length greater than 0 is
+ * accepted. Powers of 2 are the fastest, followed by lengths whose only prime
+ * factors are 2, 3 and 5.
+ * @return The plan, or NULL if the length is invalid or the allocation failed.
+ * The plan must be released with fftPlanDestroy.
+ */
+fft_plan* fftPlanCreate(const unsigned length) {
+  if (length == 0) {
+    return NULL;
+  }
+
+  fft_plan* plan = calloc(1, sizeof(fft_plan));
+  if (plan == NULL) {
+    return NULL;
+  }
+
+  plan->length = length;
+  plan->radix = FFT_RADIX;
+
+  int returnCode;
+  if (isPowerOfTwo(length)) {
+    returnCode = initPowerOfTwoPlan(plan);
+  } else if (factorize(plan) == 1) {
+    returnCode = initMixedRadixPlan(plan);
+  } else {
+    plan->nbFactors = 0;
+    returnCode = initBluesteinPlan(plan);
+  }
+
+  if (returnCode != 0) {
+    fftPlanDestroy(plan);
+    return NULL;
+  }
+
+  return plan;
+}
+
+/**
+ * Computes every level of the FFT with radix-2 butterflies, using the twiddle
+ * factors of a plan. The incoming vectors must already be in bit-reversed
+ * order.
+ * Each butterfly is applied to a batch of vectors, where the element j of the
+ * vector b is at b * distance + j * stride.
+ * With twiddleOuter, the twiddle factor of each branch element is loaded once
+ * for all the groups of its level. Otherwise the vectors are processed group
+ * after group, which keeps the accesses of long vectors within the cache.
+ * @param plan The plan holding the twiddle factors
+ * @param length The length of the transform
+ * @param realArray 1D array containing the real part of the incoming vectors.
+ * @param imaginaryArray 1D array containing the imaginary part of the incoming
+ * vectors.
+ * @param count The number of vectors
+ * @param stride The distance between two elements of a vector
+ * @param distance The distance between the first elements of two vectors
+ * @param twiddleOuter Whether the branch elements are the outer loop
+ * @param thetaFactor -1 for the FFT, 1 for the inverse FFT
+ */
+static inline void
+planRadix2Levels(const fft_plan* plan, const unsigned length,
+                 fft_real* realArray, fft_real* imaginaryArray,
+                 const unsigned count, const unsigned stride,
+                 const unsigned distance, const int twiddleOuter,
+                 const fft_real thetaFactor) {
+
+  const fft_real* twiddleReals = plan->twiddleReals;
+  const fft_real* twiddleImgs = plan->twiddleImgs;
+
+  for (unsigned depth = 2; depth <= length; depth <<= 1) { // for the levels
+
+    const unsigned nElements = depth >> 1;
+    const unsigned twiddleStride = plan->length / depth;
+
+    // Groups processed by each pass over the branch elements
+    const unsigned groupLength = twiddleOuter ? length : depth;
+    for (unsigned group = 0; group < length; group += groupLength) {
+      for (unsigned branchElement = 0; branchElement < nElements;
+           ++branchElement) { // branch element
+        const unsigned twiddleIndex = branchElement * twiddleStride;
+        radix2BranchElement(realArray, imaginaryArray, group + branchElement,
+                            group + groupLength, depth, nElements, count,
+                            stride, distance, twiddleReals[twiddleIndex],
+                            thetaFactor * twiddleImgs[twiddleIndex]);
+      }
+    }
+  }
+}
+
+/**
+ * Computes every level of the FFT with radix-4 butterflies, using the twiddle
+ * factors of a plan. When the number of levels is odd, the first level is done
+ * with radix-2 butterflies. The incoming vectors must already be in
+ * bit-reversed order.
+ * See planRadix2Levels for the parameters.
+ */
+static inline void
+planRadix4Levels(const fft_plan* plan, const unsigned length,
+                 fft_real* realArray, fft_real* imaginaryArray,
+                 const unsigned count, const unsigned stride,
+                 const unsigned distance, const int twiddleOuter,
+                 const fft_real thetaFactor) {
+
+  const fft_real* twiddleReals = plan->twiddleReals;
+  const fft_real* twiddleImgs = plan->twiddleImgs;
+
+  unsigned nElements = 1;
+  if (hasOddLevels(length)) {
+    radix2FirstLevel(length, realArray, imaginaryArray, count, stride,
+                     distance);
+    nElements = 2;
+  }
+
+  for (; nElements < length; nElements <<= 2) { // two levels at a time
+
+    const unsigned depth = nElements << 2;
+    const unsigned twiddleStride = plan->length / depth;
+
+    // Groups processed by each pass over the branch elements
+    const unsigned groupLength = twiddleOuter ? length : depth;
+    for (unsigned group = 0; group < length; group += groupLength) {
+      for (unsigned branchElement = 0; branchElement < nElements;
+           ++branchElement) { // branch element
+
+        const unsigned w1Index = branchElement * twiddleStride;
+        const unsigned w2Index = w1Index << 1;
+        const unsigned w3Index = w1Index + w2Index;
+        radix4BranchElement(
+            realArray, imaginaryArray, group + branchElement,
+            group + groupLength, depth, nElements, count, stride, distance,
+            twiddleReals[w1Index], thetaFactor * twiddleImgs[w1Index],
+            twiddleReals[w2Index], thetaFactor * twiddleImgs[w2Index],
+            twiddleReals[w3Index], thetaFactor * twiddleImgs[w3Index],
+            thetaFactor);
+      }
+    }
+  }
+}
+
+/**
+ * Computes a batch of power of 2 FFTs of the plan length with the tables of a
+ * plan. The element j of the vector b is at b * distance + j * stride.
+ * The vectors are processed group after group, every butterfly being applied
+ * to the whole batch.
+ * @param plan The plan holding the twiddle factors and the bit reversal
+ * @param realArray 1D array containing the real part of the incoming vectors.
+ * @param imaginaryArray 1D array containing the imaginary part of the incoming
+ * vectors.
+ * @param count The number of vectors
+ * @param stride The distance between two elements of a vector
+ * @param distance The distance between the first elements of two vectors
+ * @param dir Direction of the FFT. 1 for the FFT, -1 for the inverse FFT
+ */
+static void planBatchTransform(const fft_plan* plan, fft_real* realArray,
+                               fft_real* imaginaryArray, const unsigned count,
+                               const unsigned stride, const unsigned distance,
+                               const int dir) {
+
+  const unsigned length = plan->length;
+  const fft_real thetaFactor = dir < 0 ? 1.0 : -1.0;
+
+  for (unsigned i = 0; i < length; ++i) {
+    const unsigned j = plan->bitReversal[i];
+    if (i < j) {
+      for (unsigned b = 0; b < count; ++b) {
+        const unsigned iIndex = b * distance + i * stride;
+        const unsigned jIndex = b * distance + j * stride;
+        fft_real tmpReal = realArray[iIndex];
+        fft_real tmpImaginary = imaginaryArray[iIndex];
+        realArray[iIndex] = realArray[jIndex];
+        imaginaryArray[iIndex] = imaginaryArray[jIndex];
+        realArray[jIndex] = tmpReal;
+        imaginaryArray[jIndex] = tmpImaginary;
+      }
+    }
+  }
+
+  if (plan->radix == 4) {
+    planRadix4Levels(plan, length, realArray, imaginaryArray, count, stride,
+                     distance, 0, thetaFactor);
+  } else {
+    planRadix2Levels(plan, length, realArray, imaginaryArray, count, stride,
+                     distance, 0, thetaFactor);
+  }
 
   // inverse FFT
   if (dir < 0) {
     const fft_real inverseLength = 1.0 / length;
     for (unsigned i = 0; i < length; ++i) {
-      realArray[i] *= inverseLength;
-      imaginaryArray[i] *= inverseLength;
+      for (unsigned b = 0; b < count; ++b) {
+        const unsigned index = b * distance + i * stride;
+        realArray[index] *= inverseLength;
+        imaginaryArray[index] *= inverseLength;
+      }
+    }
+  }
+}
+
+/**
+ * Computes a power of 2 FFT of a single contiguous vector with the tables of a
+ * plan. Same as planBatchTransform with count = 1 and stride = 1, without the
+ * batch index arithmetic in the inner loops.
+ * Up to FFT_PLAN_TWIDDLE_OUTER_LENGTH, the twiddle factor of each branch
+ * element is loaded once for all the groups of its level.
+ * The transform length can be the plan length, or the plan length divided by
+ * a power of 2. In that case, every "step"th twiddle factor is used and the
+ * bit-reversed index of i is found at bitReversal[i * step].
+ * @param plan The plan holding the twiddle factors and the bit reversal
+ * @param length The length of the transform
+ * @param realArray 1D array containing the real part of the incoming vector.
+ * @param imaginaryArray 1D array containing the imaginary part of the incoming
+ * vector.
+ * @param dir Direction of the FFT. 1 for the FFT, -1 for the inverse FFT
+ */
+static void planTransform(const fft_plan* plan, const unsigned length,
+                          fft_real* realArray, fft_real* imaginaryArray,
+                          const int dir) {
+
+  const unsigned step = plan->length / length;
+  const unsigned* bitReversal = plan->bitReversal;
+  const fft_real thetaFactor = dir < 0 ? 1.0 : -1.0;
+  const int twiddleOuter = length <= FFT_PLAN_TWIDDLE_OUTER_LENGTH;
+
+  for (unsigned i = 0; i < length; ++i) {
+    const unsigned j = bitReversal[i * step];
+    if (i < j) {
+      fft_real tmpReal = realArray[i];
+      fft_real tmpImaginary = imaginaryArray[i];
+      realArray[i] = realArray[j];
+      imaginaryArray[i] = imaginaryArray[j];
+      realArray[j] = tmpReal;
+      imaginaryArray[j] = tmpImaginary;
+    }
+  }
+
+  if (plan->radix == 4) {
+    planRadix4Levels(plan, length, realArray, imaginaryArray, 1, 1, 0,
+                     twiddleOuter, thetaFactor);
+  } else {
+    planRadix2Levels(plan, length, realArray, imaginaryArray, 1, 1, 0,
+                     twiddleOuter, thetaFactor);
+  }
+
+  // inverse FFT
+  if (dir < 0) {
+    scaleInverse(length, realArray, imaginaryArray);
+  }
+}
+
+/**
+ * Computes a butterfly of radix 2, 3, 4 or 5 in place.
+ * @param radix The radix of the butterfly
+ * @param reals The real part of the radix elements
+ * @param imgs The imaginary part of the radix elements
+ * @param thetaFactor -1 for the FFT, 1 for the inverse FFT
+ */
+static inline void mixedRadixButterfly(const unsigned radix, fft_real* reals,
+                                       fft_real* imgs,
+                                       const fft_real thetaFactor) {
+  switch (radix) {
+  case 2: {
+    const fft_real tReal = reals[1];
+    const fft_real tImaginary = imgs[1];
+    reals[1] = reals[0] - tReal;
+    imgs[1] = imgs[0] - tImaginary;
+    reals[0] += tReal;
+    imgs[0] += tImaginary;
+    break;
+  }
+  case 3: {
+    const fft_real sin60 = 0.86602540378443864676; // sin(2 * pi / 3)
+    const fft_real sumReal = reals[1] + reals[2];
+    const fft_real sumImaginary = imgs[1] + imgs[2];
+    // difference multiplied by thetaFactor * i * sin(2 * pi / 3)
+    const fft_real diffReal = -thetaFactor * sin60 * (imgs[1] - imgs[2]);
+    const fft_real diffImaginary = thetaFactor * sin60 * (reals[1] - reals[2]);
+    const fft_real baseReal = reals[0] - 0.5 * sumReal;
+    const fft_real baseImaginary = imgs[0] - 0.5 * sumImaginary;
+    reals[0] += sumReal;
+    imgs[0] += sumImaginary;
+    reals[1] = baseReal + diffReal;
+    imgs[1] = baseImaginary + diffImaginary;
+    reals[2] = baseReal - diffReal;
+    imgs[2] = baseImaginary - diffImaginary;
+    break;
+  }
+  case 4: {
+    const fft_real sum1Real = reals[0] + reals[2];
+    const fft_real sum1Imaginary = imgs[0] + imgs[2];
+    const fft_real diff1Real = reals[0] - reals[2];
+    const fft_real diff1Imaginary = imgs[0] - imgs[2];
+    const fft_real sum2Real = reals[1] + reals[3];
+    const fft_real sum2Imaginary = imgs[1] + imgs[3];
+    // difference multiplied by thetaFactor * i
+    const fft_real diff2Real = -thetaFactor * (imgs[1] - imgs[3]);
+    const fft_real diff2Imaginary = thetaFactor * (reals[1] - reals[3]);
+    reals[0] = sum1Real + sum2Real;
+    imgs[0] = sum1Imaginary + sum2Imaginary;
+    reals[1] = diff1Real + diff2Real;
+    imgs[1] = diff1Imaginary + diff2Imaginary;
+    reals[2] = sum1Real - sum2Real;
+    imgs[2] = sum1Imaginary - sum2Imaginary;
+    reals[3] = diff1Real - diff2Real;
+    imgs[3] = diff1Imaginary - diff2Imaginary;
+    break;
+  }
+  case 5: {
+    const fft_real cos72 = 0.30901699437494742410;  // cos(2 * pi / 5)
+    const fft_real cos144 = -0.80901699437494742410; // cos(4 * pi / 5)
+    const fft_real sin72 = 0.95105651629515357212;  // sin(2 * pi / 5)
+    const fft_real sin144 = 0.58778525229247312917; // sin(4 * pi / 5)
+    const fft_real sum1Real = reals[1] + reals[4];
+    const fft_real sum1Imaginary = imgs[1] + imgs[4];
+    const fft_real sum2Real = reals[2] + reals[3];
+    const fft_real sum2Imaginary = imgs[2] + imgs[3];
+    const fft_real diff1Real = reals[1] - reals[4];
+    const fft_real diff1Imaginary = imgs[1] - imgs[4];
+    const fft_real diff2Real = reals[2] - reals[3];
+    const fft_real diff2Imaginary = imgs[2] - imgs[3];
+
+    const fft_real base1Real = reals[0] + cos72 * sum1Real + cos144 * sum2Real;
+    const fft_real base1Imaginary =
+        imgs[0] + cos72 * sum1Imaginary + cos144 * sum2Imaginary;
+    const fft_real base2Real = reals[0] + cos144 * sum1Real + cos72 * sum2Real;
+    const fft_real base2Imaginary =
+        imgs[0] + cos144 * sum1Imaginary + cos72 * sum2Imaginary;
+
+    // differences multiplied by thetaFactor * i
+    const fft_real rotated1Real =
+        -thetaFactor * (sin72 * diff1Imaginary + sin144 * diff2Imaginary);
+    const fft_real rotated1Imaginary =
+        thetaFactor * (sin72 * diff1Real + sin144 * diff2Real);
+    const fft_real rotated2Real =
+        -thetaFactor * (sin144 * diff1Imaginary - sin72 * diff2Imaginary);
+    const fft_real rotated2Imaginary =
+        thetaFactor * (sin144 * diff1Real - sin72 * diff2Real);
+
+    reals[0] += sum1Real + sum2Real;
+    imgs[0] += sum1Imaginary + sum2Imaginary;
+    reals[1] = base1Real + rotated1Real;
+    imgs[1] = base1Imaginary + rotated1Imaginary;
+    reals[4] = base1Real - rotated1Real;
+    imgs[4] = base1Imaginary - rotated1Imaginary;
+    reals[2] = base2Real + rotated2Real;
+    imgs[2] = base2Imaginary + rotated2Imaginary;
+    reals[3] = base2Real - rotated2Real;
+    imgs[3] = base2Imaginary - rotated2Imaginary;
+    break;
+  }
+  }
+}
+
+/**
+ * Computes one level of the Stockham autosort algorithm: the vectors of length
+ * subLength are split into radix vectors of length subLength / radix.
+ * The radix is passed as a constant by mixedRadixTransform, so that this
+ * function is specialized for each butterfly.
+ * @param plan The plan holding the twiddle factors
+ * @param radix The radix of the level
+ * @param subLength The length of the sub-transforms still to compute
+ * @param stride The number of interleaved sub-transforms
+ * @param inputReals The real part of the input of the level
+ * @param inputImgs The imaginary part of the input of the level
+ * @param outputReals The real part of the output of the level
+ * @param outputImgs The imaginary part of the output of the level
+ * @param thetaFactor -1 for the FFT, 1 for the inverse FFT
+ */
+static inline void
+mixedRadixLevel(const fft_plan* plan, const unsigned radix,
+                const unsigned subLength, const unsigned stride,
+                const fft_real* inputReals, const fft_real* inputImgs,
+                fft_real* outputReals, fft_real* outputImgs,
+                const fft_real thetaFactor) {
+
+  const unsigned nElements = subLength / radix;
+
+  for (unsigned branchElement = 0; branchElement < nElements;
+       ++branchElement) {
+
+    // twiddle factors exp(thetaFactor * 2 * pi * i * e * u / subLength)
+    fft_real wReals[5];
+    fft_real wImgs[5];
+    for (unsigned u = 0; u < radix; ++u) {
+      const unsigned twiddleIndex = branchElement * u * stride;
+      wReals[u] = plan->twiddleReals[twiddleIndex];
+      wImgs[u] = thetaFactor * plan->twiddleImgs[twiddleIndex];
+    }
+
+    for (unsigned q = 0; q < stride; ++q) {
+      fft_real reals[5];
+      fft_real imgs[5];
+      for (unsigned t = 0; t < radix; ++t) {
+        const unsigned index = q + stride * (branchElement + t * nElements);
+        reals[t] = inputReals[index];
+        imgs[t] = inputImgs[index];
+      }
+
+      mixedRadixButterfly(radix, reals, imgs, thetaFactor);
+
+      for (unsigned u = 0; u < radix; ++u) {
+        const unsigned index = q + stride * (radix * branchElement + u);
+        outputReals[index] = wReals[u] * reals[u] - wImgs[u] * imgs[u];
+        outputImgs[index] = wReals[u] * imgs[u] + wImgs[u] * reals[u];
+      }
+    }
+  }
+}
+
+/**
+ * Computes the FFT of a mixed-radix plan with the Stockham autosort
+ * algorithm. Each level reads from one buffer and writes to the other, so no
+ * bit-reversal permutation is needed.
+ * @param plan The plan holding the factors and the twiddle factors
+ * @param realArray 1D array containing the real part of the incoming vector.
+ * @param imaginaryArray 1D array containing the imaginary part of the incoming
+ * vector.
+ * @param dir Direction of the FFT. 1 for the FFT, -1 for the inverse FFT
+ */
+static void mixedRadixTransform(const fft_plan* plan, fft_real* realArray,
+                                fft_real* imaginaryArray, const int dir) {
+
+  const unsigned length = plan->length;
+  const fft_real thetaFactor = dir < 0 ? 1.0 : -1.0;
+
+  fft_real* inputReals = realArray;
+  fft_real* inputImgs = imaginaryArray;
+  fft_real* outputReals = plan->workReals;
+  fft_real* outputImgs = plan->workImgs;
+
+  unsigned subLength = length;
+  unsigned stride = 1;
+  for (unsigned f = 0; f < plan->nbFactors; ++f) {
+    const unsigned radix = plan->factors[f];
+    switch (radix) {
+    case 2:
+      mixedRadixLevel(plan, 2, subLength, stride, inputReals, inputImgs,
+                      outputReals, outputImgs, thetaFactor);
+      break;
+    case 3:
+      mixedRadixLevel(plan, 3, subLength, stride, inputReals, inputImgs,
+                      outputReals, outputImgs, thetaFactor);
+      break;
+    case 4:
+      mixedRadixLevel(plan, 4, subLength, stride, inputReals, inputImgs,
+                      outputReals, outputImgs, thetaFactor);
+      break;
+    default:
+      mixedRadixLevel(plan, 5, subLength, stride, inputReals, inputImgs,
+                      outputReals, outputImgs, thetaFactor);
+      break;
+    }
+
+    subLength /= radix;
+    stride *= radix;
+
+    // The output of this level is the input of the next one
+    fft_real* tmpReals = inputReals;
+    fft_real* tmpImgs = inputImgs;
+    inputReals = outputReals;
+    inputImgs = outputImgs;
+    outputReals = tmpReals;
+    outputImgs = tmpImgs;
+  }
+
+  if (inputReals != realArray) {
+    memcpy(realArray, inputReals, length * sizeof(fft_real));
+    memcpy(imaginaryArray, inputImgs, length * sizeof(fft_real));
+  }
+
+  // inverse FFT
+  if (dir < 0) {
+    scaleInverse(length, realArray, imaginaryArray);
+  }
+}
+
+/**
+ * Computes the FFT of a plan using Bluestein's algorithm.
+ * Since n * k = (n^2 + k^2 - (k - n)^2) / 2, the FFT is the convolution of the
+ * input multiplied by a chirp with the conjugated chirp. This convolution is
+ * computed with power of 2 FFTs.
+ * @param plan The plan holding the chirp and the FFT of the filter
+ * @param realArray 1D array containing the real part of the incoming vector.
+ * @param imaginaryArray 1D array containing the imaginary part of the incoming
+ * vector.
+ * @param dir Direction of the FFT. 1 for the FFT, -1 for the inverse FFT
+ */
+static void bluesteinTransform(const fft_plan* plan, fft_real* realArray,
+                               fft_real* imaginaryArray, const int dir) {
+
+  const unsigned length = plan->length;
+  const unsigned convolutionLength = plan->convolutionPlan->length;
+  fft_real* workReals = plan->workReals;
+  fft_real* workImgs = plan->workImgs;
+
+  // The inverse FFT is computed as conj(FFT(conj(x))) / length
+  const fft_real conjugateFactor = dir < 0 ? -1.0 : 1.0;
+
+  // Multiply the input by conj(chirp)
+  for (unsigned k = 0; k < length; ++k) {
+    const fft_real inputImaginary = conjugateFactor * imaginaryArray[k];
+    workReals[k] = realArray[k] * plan->chirpReals[k] +
+                   inputImaginary * plan->chirpImgs[k];
+    workImgs[k] = inputImaginary * plan->chirpReals[k] -
+                  realArray[k] * plan->chirpImgs[k];
+  }
+  memset(&workReals[length], 0,
+         (convolutionLength - length) * sizeof(fft_real));
+  memset(&workImgs[length], 0, (convolutionLength - length) * sizeof(fft_real));
+
+  // Convolution with the chirp
+  planTransform(plan->convolutionPlan, convolutionLength, workReals, workImgs,
+                1);
+  for (unsigned k = 0; k < convolutionLength; ++k) {
+    const fft_real tmpReal = workReals[k];
+    workReals[k] =
+        tmpReal * plan->filterReals[k] - workImgs[k] * plan->filterImgs[k];
+    workImgs[k] =
+        tmpReal * plan->filterImgs[k] + workImgs[k] * plan->filterReals[k];
+  }
+  planTransform(plan->convolutionPlan, convolutionLength, workReals, workImgs,
+                -1);
+
+  // Multiply the result by conj(chirp)
+  for (unsigned k = 0; k < length; ++k) {
+    realArray[k] =
+        workReals[k] * plan->chirpReals[k] + workImgs[k] * plan->chirpImgs[k];
+    imaginaryArray[k] =
+        conjugateFactor * (workImgs[k] * plan->chirpReals[k] -
+                           workReals[k] * plan->chirpImgs[k]);
+  }
+
+  // inverse FFT
+  if (dir < 0) {
+    scaleInverse(length, realArray, imaginaryArray);
+  }
+}
+
+/**
+ * @brief Computes the FFT using a plan.
+ * The result is the same as FFT(plan->length, realArray, imaginaryArray, dir).
+ * @param plan The plan created with fftPlanCreate
+ * @param realArray 1D array containing the real part of the incoming vector.
+ * This array will contain the end result of the real part of the FFT
+ * @param imaginaryArray 1D array containing the imaginary part of the incoming
+ * vector. This array will contain the end result of the imaginary part of the
+ * FFT
+ * @param dir Direction of the FFT. 1 for the FFT, -1 for the inverse FFT
+ * @return 1 if an error occured, 0 otherwise
+ */
+int fftPlanExecute(const fft_plan* plan, fft_real* realArray,
+                   fft_real* imaginaryArray, const int dir) {
+  if (plan == NULL || realArray == NULL || imaginaryArray == NULL) {
+    return 1;
+  }
+
+  if (plan->bitReversal != NULL) {
+    planTransform(plan, plan->length, realArray, imaginaryArray, dir);
+  } else if (plan->convolutionPlan != NULL) {
+    bluesteinTransform(plan, realArray, imaginaryArray, dir);
+  } else {
+    mixedRadixTransform(plan, realArray, imaginaryArray, dir);
+  }
+  return 0;
+}
+
+/**
+ * @brief Computes the FFT of a batch of vectors using a plan.
+ * The element j of the vector b is at index b * distance + j * stride of the
+ * arrays. For example, the rows of a row-major height x width matrix are
+ * transformed with (count = height, stride = 1, distance = width) and its
+ * columns with (count = width, stride = width, distance = 1).
+ * Contiguous vectors (stride = 1) are transformed one after the other. Power
+ * of 2 plans work directly on strided vectors, every butterfly being applied
+ * to the whole batch. The other plans copy each strided vector to a temporary
+ * buffer.
+ * @param plan The plan created with fftPlanCreate
+ * @param realArray 1D array containing the real part of the incoming vectors.
+ * This array will contain the end result of the real part of the FFTs
+ * @param imaginaryArray 1D array containing the imaginary part of the incoming
+ * vectors. This array will contain the end result of the imaginary part of the
+ * FFTs
+ * @param count The number of vectors
+ * @param stride The distance between two elements of a vector
+ * @param distance The distance between the first elements of two vectors
+ * @param dir Direction of the FFT. 1 for the FFT, -1 for the inverse FFT
+ * @return 1 if an error occured, 0 otherwise
+ */
+int fftPlanExecuteBatch(const fft_plan* plan, fft_real* realArray,
+                        fft_real* imaginaryArray, const unsigned count,
+                        const unsigned stride, const unsigned distance,
+                        const int dir) {
+  if (plan == NULL || realArray == NULL || imaginaryArray == NULL ||
+      stride == 0) {
+    return 1;
+  }
+
+  // Contiguous vectors are transformed one after the other, which keeps the
+  // accesses of each butterfly level within a single vector
+  if (stride == 1) {
+    for (unsigned b = 0; b < count; ++b) {
+      fftPlanExecute(plan, realArray + b * distance,
+                     imaginaryArray + b * distance, dir);
+    }
+    return 0;
+  }
+
+  if (plan->bitReversal != NULL) {
+    planBatchTransform(plan, realArray, imaginaryArray, count, stride, distance,
+                       dir);
+    return 0;
+  }
+
+  const unsigned length = plan->length;
+  fft_real* reals = malloc(2 * length * sizeof(fft_real));
+  if (reals == NULL) {
+    return 1;
+  }
+  fft_real* imgs = reals + length;
+
+  for (unsigned b = 0; b < count; ++b) {
+    fft_real* vectorReals = realArray + b * distance;
+    fft_real* vectorImgs = imaginaryArray + b * distance;
+    for (unsigned i = 0; i < length; ++i) {
+      reals[i] = vectorReals[i * stride];
+      imgs[i] = vectorImgs[i * stride];
+    }
+    fftPlanExecute(plan, reals, imgs, dir);
+    for (unsigned i = 0; i < length; ++i) {
+      vectorReals[i * stride] = reals[i];
+      vectorImgs[i * stride] = imgs[i];
     }
   }
 
+  free(reals);
   return 0;
 }
+
+/**
+ * Separates the FFT of the packed half-length vector into the bins k and
+ * halfLength - k of the real FFT. Both bins are computed in place.
+ * @param k The bin to compute, with 0 < k <= halfLength / 2
+ * @param halfLength Half of the length of the real vector
+ * @param reals The real part of the packed FFT
+ * @param imgs The imaginary part of the packed FFT
+ * @param wReal Real part of the twiddle factor exp(-2 * pi * i * k / length)
+ * @param wImaginary Imaginary part of the twiddle factor
+ */
+static inline void realSplitPair(const unsigned k, const unsigned halfLength,
+                                 fft_real* reals, fft_real* imgs,
+                                 const fft_real wReal,
+                                 const fft_real wImaginary) {
+  const unsigned mirror = halfLength - k;
+
+  // even part: (Z[k] + conj(Z[N/2 - k])) / 2
+  const fft_real evenReal = 0.5 * (reals[k] + reals[mirror]);
+  const fft_real evenImaginary = 0.5 * (imgs[k] - imgs[mirror]);
+  // odd part: -i * (Z[k] - conj(Z[N/2 - k])) / 2
+  const fft_real oddReal = 0.5 * (imgs[k] + imgs[mirror]);
+  const fft_real oddImaginary = -0.5 * (reals[k] - reals[mirror]);
+
+  const fft_real tReal = wReal * oddReal - wImaginary * oddImaginary;
+  const fft_real tImaginary = wReal * oddImaginary + wImaginary * oddReal;
+
+  // X[N/2 - k] = conj(even - w * odd)
+  reals[mirror] = evenReal - tReal;
+  imgs[mirror] = tImaginary - evenImaginary;
+  // X[k] = even + w * odd
+  reals[k] = evenReal + tReal;
+  imgs[k] = evenImaginary + tImaginary;
+}
+
+/**
+ * Inverse of realSplitPair. Rebuilds the bins k and halfLength - k of the
+ * packed half-length FFT from the bins of the real FFT, in place.
+ * @param k The bin to compute, with 0 < k <= halfLength / 2
+ * @param halfLength Half of the length of the real vector
+ * @param reals The real part of the real FFT
+ * @param imgs The imaginary part of the real FFT
+ * @param wReal Real part of the twiddle factor exp(-2 * pi * i * k / length)
+ * @param wImaginary Imaginary part of the twiddle factor
+ */
+static inline void realMergePair(const unsigned k, const unsigned halfLength,
+                                 fft_real* reals, fft_real* imgs,
+                                 const fft_real wReal,
+                                 const fft_real wImaginary) {
+  const unsigned mirror = halfLength - k;
+
+  // even part: (X[k] + conj(X[N/2 - k])) / 2
+  const fft_real evenReal = 0.5 * (reals[k] + reals[mirror]);
+  const fft_real evenImaginary = 0.5 * (imgs[k] - imgs[mirror]);
+  // w * odd part: (X[k] - conj(X[N/2 - k])) / 2
+  const fft_real tReal = 0.5 * (reals[k] - reals[mirror]);
+  const fft_real tImaginary = 0.5 * (imgs[k] + imgs[mirror]);
+
+  // odd part, multiplied by conj(w)
+  const fft_real oddReal = wReal * tReal + wImaginary * tImaginary;
+  const fft_real oddImaginary = wReal * tImaginary - wImaginary * tReal;
+
+  // Z[k] = even + i * odd and Z[N/2 - k] = conj(even) + i * conj(odd)
+  reals[mirror] = evenReal + oddImaginary;
+  imgs[mirror] = oddReal - evenImaginary;
+  reals[k] = evenReal - oddImaginary;
+  imgs[k] = evenImaginary + oddReal;
+}
+
+/**
+ * Packs the even and odd samples of a real vector as the real and imaginary
+ * parts of a half-length complex vector.
+ */
+static void realPack(const unsigned halfLength, const fft_real* input,
+                     fft_real* reals, fft_real* imgs) {
+  for (unsigned i = 0; i < halfLength; ++i) {
+    reals[i] = input[2 * i];
+    imgs[i] = input[2 * i + 1];
+  }
+}
+
+/**
+ * Inverse of realPack.
+ */
+static void realUnpack(const unsigned halfLength, const fft_real* reals,
+                       const fft_real* imgs, fft_real* output) {
+  for (unsigned i = 0; i < halfLength; ++i) {
+    output[2 * i] = reals[i];
+    output[2 * i + 1] = imgs[i];
+  }
+}
+
+/**
+ * Computes the bins 0 and halfLength of the real FFT from the first bin of
+ * the packed FFT.
+ */
+static inline void realSplitEdges(const unsigned halfLength, fft_real* reals,
+                                  fft_real* imgs) {
+  const fft_real firstReal = reals[0];
+  reals[0] = firstReal + imgs[0];
+  reals[halfLength] = firstReal - imgs[0];
+  imgs[0] = 0.0;
+  imgs[halfLength] = 0.0;
+}
+
+/**
+ * Inverse of realSplitEdges.
+ */
+static inline void realMergeEdges(const unsigned halfLength, fft_real* reals,
+                                  fft_real* imgs) {
+  const fft_real firstReal = reals[0];
+  reals[0] = 0.5 * (firstReal + reals[halfLength]);
+  imgs[0] = 0.5 * (firstReal - reals[halfLength]);
+}
+
+/**
+ * @brief Computes the FFT of a real vector.
+ * The N real samples are packed in a complex vector of length N / 2, whose FFT
+ * is then separated into the N / 2 + 1 non-redundant bins of the result. The
+ * remaining bins are the complex conjugates of these ones.
+ * @param length The length of the input vector. Must be a power of 2 greater
+ * than 1
+ * @param input 1D array containing the real input vector
+ * @param outputReals 1D array of length "length / 2 + 1" which will contain
+ * the real part of the FFT
+ * @param outputImgs 1D array of length "length / 2 + 1" which will contain the
+ * imaginary part of the FFT
+ * @return 1 if an error occured, 0 otherwise
+ */
+int RFFT(const unsigned length, const fft_real* input, fft_real* outputReals,
+         fft_real* outputImgs) {
+  if (length < 2 || !isPowerOfTwo(length) || input == NULL ||
+      outputReals == NULL || outputImgs == NULL) {
+    return 1;
+  }
+
+  const unsigned halfLength = length >> 1;
+  realPack(halfLength, input, outputReals, outputImgs);
+  FFT(halfLength, outputReals, outputImgs, 1);
+  realSplitEdges(halfLength, outputReals, outputImgs);
+
+  // factors for trigonometric recurrence formula
+  const fft_real piOverLength = M_PI / length;
+  fft_real wtempSin = sin(piOverLength);
+  fft_real wRealFactor = -2.0 * wtempSin * wtempSin;
+  fft_real wImaginaryFactor = -sin(2.0 * piOverLength);
+
+  fft_real wReal = 1.0;
+  fft_real wImaginary = 0.0;
+  for (unsigned k = 1; k <= halfLength >> 1; ++k) {
+    fft_real wtempReal = wReal;
+    wReal += wReal * wRealFactor - wImaginary * wImaginaryFactor;
+    wImaginary += wImaginary * wRealFactor + wtempReal * wImaginaryFactor;
+
+    realSplitPair(k, halfLength, outputReals, outputImgs, wReal, wImaginary);
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Computes the inverse FFT of the spectrum of a real vector.
+ * This is the inverse of RFFT.
+ * @param length The length of the output vector. Must be a power of 2 greater
+ * than 1
+ * @param inputReals 1D array of length "length / 2 + 1" containing the real
+ * part of the spectrum. This array is used as a work buffer and is modified
+ * @param inputImgs 1D array of length "length / 2 + 1" containing the
+ * imaginary part of the spectrum. This array is used as a work buffer and is
+ * modified
+ * @param output 1D array which will contain the real output vector
+ * @return 1 if an error occured, 0 otherwise
+ */
+int IRFFT(const unsigned length, fft_real* inputReals, fft_real* inputImgs,
+          fft_real* output) {
+  if (length < 2 || !isPowerOfTwo(length) || inputReals == NULL ||
+      inputImgs == NULL || output == NULL) {
+    return 1;
+  }
+
+  const unsigned halfLength = length >> 1;
+  realMergeEdges(halfLength, inputReals, inputImgs);
+
+  // factors for trigonometric recurrence formula
+  const fft_real piOverLength = M_PI / length;
+  fft_real wtempSin = sin(piOverLength);
+  fft_real wRealFactor = -2.0 * wtempSin * wtempSin;
+  fft_real wImaginaryFactor = -sin(2.0 * piOverLength);
+
+  fft_real wReal = 1.0;
+  fft_real wImaginary = 0.0;
+  for (unsigned k = 1; k <= halfLength >> 1; ++k) {
+    fft_real wtempReal = wReal;
+    wReal += wReal * wRealFactor - wImaginary * wImaginaryFactor;
+    wImaginary += wImaginary * wRealFactor + wtempReal * wImaginaryFactor;
+
+    realMergePair(k, halfLength, inputReals, inputImgs, wReal, wImaginary);
+  }
+
+  FFT(halfLength, inputReals, inputImgs, -1);
+  realUnpack(halfLength, inputReals, inputImgs, output);
+
+  return 0;
+}
+
+/**
+ * @brief Computes the FFT of a real vector using a plan.
+ * The result is the same as RFFT(plan->length, input, outputReals, outputImgs).
+ * @param plan The plan created with fftPlanCreate. Its length is the length of
+ * the real vector and must be a power of 2 greater than 1
+ * @param input 1D array containing the real input vector
+ * @param outputReals 1D array of length "plan->length / 2 + 1" which will
+ * contain the real part of the FFT
+ * @param outputImgs 1D array of length "plan->length / 2 + 1" which will
+ * contain the imaginary part of the FFT
+ * @return 1 if an error occured, 0 otherwise
+ */
+int fftPlanExecuteReal(const fft_plan* plan, const fft_real* input,
+                       fft_real* outputReals, fft_real* outputImgs) {
+  if (plan == NULL || plan->bitReversal == NULL || plan->length < 2 ||
+      input == NULL || outputReals == NULL || outputImgs == NULL) {
+    return 1;
+  }
+
+  const unsigned halfLength = plan->length >> 1;
+  realPack(halfLength, input, outputReals, outputImgs);
+  planTransform(plan, halfLength, outputReals, outputImgs, 1);
+  realSplitEdges(halfLength, outputReals, outputImgs);
+
+  for (unsigned k = 1; k <= halfLength >> 1; ++k) {
+    realSplitPair(k, halfLength, outputReals, outputImgs,
+                  plan->twiddleReals[k], -plan->twiddleImgs[k]);
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Computes the inverse FFT of the spectrum of a real vector using a
+ * plan. The result is the same as
+ * IRFFT(plan->length, inputReals, inputImgs, output).
+ * @param plan The plan created with fftPlanCreate. Its length is the length of
+ * the real vector and must be a power of 2 greater than 1
+ * @param inputReals 1D array of length "plan->length / 2 + 1" containing the
+ * real part of the spectrum. This array is used as a work buffer and is
+ * modified
+ * @param inputImgs 1D array of length "plan->length / 2 + 1" containing the
+ * imaginary part of the spectrum. This array is used as a work buffer and is
+ * modified
+ * @param output 1D array which will contain the real output vector
+ * @return 1 if an error occured, 0 otherwise
+ */
+int fftPlanExecuteRealInverse(const fft_plan* plan, fft_real* inputReals,
+                              fft_real* inputImgs, fft_real* output) {
+  if (plan == NULL || plan->bitReversal == NULL || plan->length < 2 ||
+      inputReals == NULL || inputImgs == NULL || output == NULL) {
+    return 1;
+  }
+
+  const unsigned halfLength = plan->length >> 1;
+  realMergeEdges(halfLength, inputReals, inputImgs);
+
+  for (unsigned k = 1; k <= halfLength >> 1; ++k) {
+    realMergePair(k, halfLength, inputReals, inputImgs, plan->twiddleReals[k],
+                  -plan->twiddleImgs[k]);
+  }
+
+  planTransform(plan, halfLength, inputReals, inputImgs, -1);
+  realUnpack(halfLength, inputReals, inputImgs, output);
+
+  return 0;
+}
+
+/**
+ * @brief Releases a plan created with fftPlanCreate.
+ * @param plan The plan to release. Can be NULL
+ */
+void fftPlanDestroy(fft_plan* plan) {
+  if (plan == NULL) {
+    return;
+  }
+
+  free(plan->twiddleReals);
+  free(plan->twiddleImgs);
+  free(plan->bitReversal);
+  free(plan->workReals);
+  free(plan->workImgs);
+  fftPlanDestroy(plan->convolutionPlan);
+  free(plan->chirpReals);
+  free(plan->chirpImgs);
+  free(plan->filterReals);
+  free(plan->filterImgs);
+  free(plan);
+}
@@ -9,13 +9,81 @@
 #define M_PI 3.14159265358979323846
 #endif
 
+// Radix of the butterflies used by FFT and by default in plans. Either 2 or 4.
+// With radix 4, two levels are computed per pass over the vectors, and a
+// radix-2 level is added first when the length is an odd power of 2.
+#ifndef FFT_RADIX
+#define FFT_RADIX 4
+#endif
+
+// Longest vector transformed by fftPlanExecute one branch element at a time,
+// loading each twiddle factor once per level. Longer vectors are transformed
+// one group at a time, which keeps the accesses within the cache.
+#ifndef FFT_PLAN_TWIDDLE_OUTER_LENGTH
+#define FFT_PLAN_TWIDDLE_OUTER_LENGTH 2048
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// Maximum number of factors of a mixed-radix plan
+#ifndef FFT_MAX_FACTORS
+#define FFT_MAX_FACTORS 32
+#endif
+
+/**
+ * Precomputed data for FFTs of a given length. A plan is created once with
+ * fftPlanCreate, can be executed any number of times with fftPlanExecute and
+ * must be released with fftPlanDestroy.
+ * Powers of 2 use the radix-2 or radix-4 butterflies with a bit-reversal
+ * permutation. Lengths whose only prime factors are 2, 3 and 5 use mixed-radix
+ * butterflies. Any other length uses Bluestein's algorithm.
+ * A plan holds a work buffer, so it must not be executed by multiple threads
+ * at the same time.
+ */
+typedef struct fft_plan {
+  unsigned length;        // Length of the transform
+  unsigned radix;         // Radix of the butterflies, 2 or 4. Can be changed
+  fft_real* twiddleReals; // cos(2 * pi * k / length)
+  fft_real* twiddleImgs;  // sin(2 * pi * k / length)
+  unsigned* bitReversal;  // Bit-reversed index of each element (powers of 2)
+
+  // Mixed-radix lengths
+  unsigned nbFactors;                // Number of butterfly levels
+  unsigned factors[FFT_MAX_FACTORS]; // Radix of each level: 2, 3, 4 or 5
+  fft_real* workReals;               // Work buffer, real part
+  fft_real* workImgs;                // Work buffer, imaginary part
+
+  // Bluestein's algorithm
+  struct fft_plan* convolutionPlan; // Power of 2 plan for the convolution
+  fft_real* chirpReals;             // cos(pi * k^2 / length), for k < length
+  fft_real* chirpImgs;              // sin(pi * k^2 / length), for k < length
+  fft_real* filterReals;            // FFT of the conjugated chirp (real)
+  fft_real* filterImgs;             // FFT of the conjugated chirp (imaginary)
+} fft_plan;
+
 int FFT(const unsigned length, fft_real* realArray, fft_real* imaginaryArray,
         const int dir);
 
+int RFFT(const unsigned length, const fft_real* input, fft_real* outputReals,
+         fft_real* outputImgs);
+int IRFFT(const unsigned length, fft_real* inputReals, fft_real* inputImgs,
+          fft_real* output);
+
+fft_plan* fftPlanCreate(const unsigned length);
+int fftPlanExecute(const fft_plan* plan, fft_real* realArray,
+                   fft_real* imaginaryArray, const int dir);
+int fftPlanExecuteBatch(const fft_plan* plan, fft_real* realArray,
+                        fft_real* imaginaryArray, const unsigned count,
+                        const unsigned stride, const unsigned distance,
+                        const int dir);
+int fftPlanExecuteReal(const fft_plan* plan, const fft_real* input,
+                       fft_real* outputReals, fft_real* outputImgs);
+int fftPlanExecuteRealInverse(const fft_plan* plan, fft_real* inputReals,
+                              fft_real* inputImgs, fft_real* output);
+void fftPlanDestroy(fft_plan* plan);
+
 #ifdef __cplusplus
 }
 #endif
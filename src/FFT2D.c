@@ -0,0 +1,294 @@
+#include "FFT2D.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * Computes the 2D FFT of a row-major matrix with the plans of its rows and of
+ * its columns.
+ * With a power of 2 height, the column plan works directly on the strided
+ * columns, every butterfly being applied to a whole row at once. Otherwise, the
+ * columns are transformed FFT2D_BLOCK_SIZE at a time: the block is transposed
+ * to contiguous vectors in the work buffers, transformed, and transposed back.
+ * Each row of the matrix is then accessed by whole cache lines, and the block
+ * stays in the cache during its transforms.
+ * @param rowPlan The plan of length width
+ * @param columnPlan The plan of length height
+ * @param height The number of rows of the matrix
+ * @param width The number of columns of the matrix
+ * @param realArray The real part of the matrix
+ * @param imaginaryArray The imaginary part of the matrix
+ * @param workReals Work buffer of FFT2D_BLOCK_SIZE x height elements. Can be
+ * NULL when the height is a power of 2
+ * @param workImgs Work buffer of FFT2D_BLOCK_SIZE x height elements. Can be
+ * NULL when the height is a power of 2
+ * @param dir Direction of the FFT. 1 for the FFT, -1 for the inverse FFT
+ */
+static void planTransform2D(const fft_plan* rowPlan,
+                            const fft_plan* columnPlan, const unsigned height,
+                            const unsigned width, fft_real* realArray,
+                            fft_real* imaginaryArray, fft_real* workReals,
+                            fft_real* workImgs, const int dir) {
+
+  fftPlanExecuteBatch(rowPlan, realArray, imaginaryArray, height, 1, width,
+                      dir);
+
+  if (columnPlan->bitReversal != NULL) {
+    fftPlanExecuteBatch(columnPlan, realArray, imaginaryArray, width, width, 1,
+                        dir);
+    return;
+  }
+
+  for (unsigned j0 = 0; j0 < width; j0 += FFT2D_BLOCK_SIZE) {
+    const unsigned blockWidth =
+        width - j0 < FFT2D_BLOCK_SIZE ? width - j0 : FFT2D_BLOCK_SIZE;
+
+    for (unsigned i = 0; i < height; ++i) {
+      const fft_real* rowReals = realArray + i * width + j0;
+      const fft_real* rowImgs = imaginaryArray + i * width + j0;
+      for (unsigned j = 0; j < blockWidth; ++j) {
+        workReals[j * height + i] = rowReals[j];
+        workImgs[j * height + i] = rowImgs[j];
+      }
+    }
+
+    fftPlanExecuteBatch(columnPlan, workReals, workImgs, blockWidth, 1, height,
+                        dir);
+
+    for (unsigned i = 0; i < height; ++i) {
+      fft_real* rowReals = realArray + i * width + j0;
+      fft_real* rowImgs = imaginaryArray + i * width + j0;
+      for (unsigned j = 0; j < blockWidth; ++j) {
+        rowReals[j] = workReals[j * height + i];
+        rowImgs[j] = workImgs[j * height + i];
+      }
+    }
+  }
+}
+
+/**
+ * @brief Computes the 2D FFT of a row-major matrix. The rows are transformed
+ * first, then the columns. Any height and width are supported, see FFT.
+ * @param height The number of rows of the matrix
+ * @param width The number of columns of the matrix
+ * @param realArray 1D array containing the real part of the matrix, of size
+ * height x width. This array will contain the end result of the real part of
+ * the FFT
+ * @param imaginaryArray 1D array containing the imaginary part of the matrix.
+ * This array will contain the end result of the imaginary part of the FFT
+ * @param dir Direction of the FFT. 1 for the FFT, -1 for the inverse FFT
+ * @return 1 if an error occured, 0 otherwise
+ */
+int FFT2D(const unsigned height, const unsigned width, fft_real* realArray,
+          fft_real* imaginaryArray, const int dir) {
+  if (height == 0 || width == 0 || realArray == NULL ||
+      imaginaryArray == NULL) {
+    return 1;
+  }
+
+  fft_plan* rowPlan = fftPlanCreate(width);
+  fft_plan* columnPlan = fftPlanCreate(height);
+
+  // Work buffers for the blocks of columns, unused with a power of 2 height
+  const unsigned workSize = FFT2D_BLOCK_SIZE * height;
+  fft_real* workReals = NULL;
+  if (columnPlan != NULL && columnPlan->bitReversal == NULL) {
+    workReals = malloc(2 * workSize * sizeof(fft_real));
+  }
+
+  int returnCode = 1;
+  if (rowPlan != NULL && columnPlan != NULL &&
+      (workReals != NULL || columnPlan->bitReversal != NULL)) {
+    planTransform2D(rowPlan, columnPlan, height, width, realArray,
+                    imaginaryArray, workReals,
+                    workReals == NULL ? NULL : workReals + workSize, dir);
+    returnCode = 0;
+  }
+
+  free(workReals);
+  fftPlanDestroy(rowPlan);
+  fftPlanDestroy(columnPlan);
+  return returnCode;
+}
+
+/**
+ * Finds the next power of 2 of the incoming value.
+ * @param value The value to find the next power of 2.
+ * @return The next power of 2 of the incoming value
+ */
+static unsigned nextPowerOf2(const unsigned value) {
+  unsigned k = 1;
+  while (k < value) {
+    k <<= 1;
+  }
+  return k;
+}
+
+/**
+ * Adds the linear convolution of a tile to the output image. The convolution
+ * of the tile spans tileHeight + kernelHeight - 1 rows, starting kernelHeight /
+ * 2 rows above the tile. The same goes for the columns. Values outside of the
+ * image are dropped.
+ * @param imageHeight The number of rows of the image
+ * @param imageWidth The number of columns of the image
+ * @param output The output image
+ * @param row The first row of the tile in the image
+ * @param column The first column of the tile in the image
+ * @param tileHeight The number of rows of the tile
+ * @param tileWidth The number of columns of the tile
+ * @param kernelHeight The number of rows of the kernel
+ * @param kernelWidth The number of columns of the kernel
+ * @param fftWidth The number of columns of the convolved tile
+ * @param tile The convolved tile
+ */
+static void accumulateTile(const unsigned imageHeight,
+                           const unsigned imageWidth, fft_real* output,
+                           const unsigned row, const unsigned column,
+                           const unsigned tileHeight, const unsigned tileWidth,
+                           const unsigned kernelHeight,
+                           const unsigned kernelWidth, const unsigned fftWidth,
+                           const fft_real* tile) {
+
+  const int firstRow = (int)row - (int)(kernelHeight / 2);
+  const int firstColumn = (int)column - (int)(kernelWidth / 2);
+
+  for (unsigned p = 0; p < tileHeight + kernelHeight - 1; ++p) {
+    const int outputRow = firstRow + (int)p;
+    if (outputRow < 0 || outputRow >= (int)imageHeight) {
+      continue;
+    }
+
+    for (unsigned q = 0; q < tileWidth + kernelWidth - 1; ++q) {
+      const int outputColumn = firstColumn + (int)q;
+      if (outputColumn >= 0 && outputColumn < (int)imageWidth) {
+        output[outputRow * imageWidth + outputColumn] += tile[p * fftWidth + q];
+      }
+    }
+  }
+}
+
+/**
+ * @brief Convolves a real image with a real kernel using 2D FFTs.
+ * The output has the size of the image and the kernel is centered on each
+ * pixel: the element (kernelHeight / 2, kernelWidth / 2) of the kernel
+ * multiplies the pixel itself. The image is considered to be 0 outside of its
+ * bounds.
+ * The image is cut in tiles of tileSize x tileSize pixels, which are convolved
+ * separately and added to the output (overlap-add). The memory used is
+ * 4 x fftHeight x fftWidth elements, where fftHeight is the power of 2 greater
+ * or equal to tileSize + kernelHeight - 1, and likewise for fftWidth. Two
+ * tiles are convolved by each complex FFT, as the real and imaginary parts of
+ * the same matrix.
+ * @param imageHeight The number of rows of the image
+ * @param imageWidth The number of columns of the image
+ * @param image The row-major image
+ * @param kernelHeight The number of rows of the kernel
+ * @param kernelWidth The number of columns of the kernel
+ * @param kernel The row-major kernel
+ * @param tileSize The side of the tiles. 0 to convolve the whole image at once
+ * @param output The row-major convolved image, of size imageHeight x imageWidth
+ * @return 1 if an error occured, 0 otherwise
+ */
+int fftConvolve2D(const unsigned imageHeight, const unsigned imageWidth,
+                  const fft_real* image, const unsigned kernelHeight,
+                  const unsigned kernelWidth, const fft_real* kernel,
+                  const unsigned tileSize, fft_real* output) {
+  if (imageHeight == 0 || imageWidth == 0 || image == NULL ||
+      kernelHeight == 0 || kernelWidth == 0 || kernel == NULL ||
+      output == NULL) {
+    return 1;
+  }
+
+  unsigned tileHeight = imageHeight;
+  unsigned tileWidth = imageWidth;
+  if (tileSize != 0) {
+    tileHeight = tileSize < imageHeight ? tileSize : imageHeight;
+    tileWidth = tileSize < imageWidth ? tileSize : imageWidth;
+  }
+
+  const unsigned fftHeight = nextPowerOf2(tileHeight + kernelHeight - 1);
+  const unsigned fftWidth = nextPowerOf2(tileWidth + kernelWidth - 1);
+  const unsigned fftSize = fftHeight * fftWidth;
+
+  fft_real* buffer = malloc(4 * fftSize * sizeof(fft_real));
+  fft_plan* rowPlan = fftPlanCreate(fftWidth);
+  fft_plan* columnPlan = fftPlanCreate(fftHeight);
+  if (buffer == NULL || rowPlan == NULL || columnPlan == NULL) {
+    free(buffer);
+    fftPlanDestroy(rowPlan);
+    fftPlanDestroy(columnPlan);
+    return 1;
+  }
+
+  fft_real* tileReals = buffer;
+  fft_real* tileImgs = buffer + fftSize;
+  fft_real* kernelReals = buffer + 2 * fftSize;
+  fft_real* kernelImgs = buffer + 3 * fftSize;
+
+  // FFT of the zero-padded kernel
+  memset(kernelReals, 0, 2 * fftSize * sizeof(fft_real));
+  for (unsigned m = 0; m < kernelHeight; ++m) {
+    for (unsigned n = 0; n < kernelWidth; ++n) {
+      kernelReals[m * fftWidth + n] = kernel[m * kernelWidth + n];
+    }
+  }
+  planTransform2D(rowPlan, columnPlan, fftHeight, fftWidth, kernelReals,
+                  kernelImgs, NULL, NULL, 1);
+
+  memset(output, 0, imageHeight * imageWidth * sizeof(fft_real));
+
+  const unsigned nbTileColumns = (imageWidth + tileWidth - 1) / tileWidth;
+  const unsigned nbTiles =
+      nbTileColumns * ((imageHeight + tileHeight - 1) / tileHeight);
+
+  for (unsigned t = 0; t < nbTiles; t += 2) {
+
+    // The tile t goes to the real part and the tile t + 1 to the imaginary
+    // part. As the kernel is real, both convolutions stay separated.
+    fft_real* parts[2] = {tileReals, tileImgs};
+    unsigned rows[2];
+    unsigned columns[2];
+    unsigned heights[2];
+    unsigned widths[2];
+    const unsigned nbParts = t + 1 < nbTiles ? 2 : 1;
+
+    memset(tileReals, 0, 2 * fftSize * sizeof(fft_real));
+    for (unsigned k = 0; k < nbParts; ++k) {
+      rows[k] = ((t + k) / nbTileColumns) * tileHeight;
+      columns[k] = ((t + k) % nbTileColumns) * tileWidth;
+      heights[k] = imageHeight - rows[k] < tileHeight ? imageHeight - rows[k]
+                                                      : tileHeight;
+      widths[k] = imageWidth - columns[k] < tileWidth ? imageWidth - columns[k]
+                                                      : tileWidth;
+
+      for (unsigned i = 0; i < heights[k]; ++i) {
+        memcpy(parts[k] + i * fftWidth,
+               image + (rows[k] + i) * imageWidth + columns[k],
+               widths[k] * sizeof(fft_real));
+      }
+    }
+
+    planTransform2D(rowPlan, columnPlan, fftHeight, fftWidth, tileReals,
+                    tileImgs, NULL, NULL, 1);
+
+    // Element-wise multiplication between the tile and the kernel
+    for (unsigned i = 0; i < fftSize; ++i) {
+      const fft_real tileReal = tileReals[i];
+      tileReals[i] = tileReal * kernelReals[i] - tileImgs[i] * kernelImgs[i];
+      tileImgs[i] = tileReal * kernelImgs[i] + tileImgs[i] * kernelReals[i];
+    }
+
+    planTransform2D(rowPlan, columnPlan, fftHeight, fftWidth, tileReals,
+                    tileImgs, NULL, NULL, -1);
+
+    for (unsigned k = 0; k < nbParts; ++k) {
+      accumulateTile(imageHeight, imageWidth, output, rows[k], columns[k],
+                     heights[k], widths[k], kernelHeight, kernelWidth,
+                     fftWidth, parts[k]);
+    }
+  }
+
+  free(buffer);
+  fftPlanDestroy(rowPlan);
+  fftPlanDestroy(columnPlan);
+  return 0;
+}
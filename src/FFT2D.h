@@ -0,0 +1,28 @@
+#ifndef FFT2D_H
+#define FFT2D_H
+
+#include "FFT.h"
+
+// Number of columns transposed and transformed together when the height is not
+// a power of 2. Each row of the matrix is accessed by blocks of this size.
+#ifndef FFT2D_BLOCK_SIZE
+#define FFT2D_BLOCK_SIZE 8
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int FFT2D(const unsigned height, const unsigned width, fft_real* realArray,
+          fft_real* imaginaryArray, const int dir);
+
+int fftConvolve2D(const unsigned imageHeight, const unsigned imageWidth,
+                  const fft_real* image, const unsigned kernelHeight,
+                  const unsigned kernelWidth, const fft_real* kernel,
+                  const unsigned tileSize, fft_real* output);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FFT2D_H
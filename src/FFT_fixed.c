@@ -0,0 +1,353 @@
+#include "FFT_fixed.h"
+#include "fast_sincos.h"
+#include "utils.h"
+#include <stddef.h>
+
+static inline int isPowerOfTwo(const unsigned value) {
+  return (value != 0) && ((value & (value - 1)) == 0);
+}
+
+static inline unsigned log2PowerOfTwo(unsigned value) {
+  unsigned power = 0;
+  while (value > 1) {
+    value >>= 1;
+    ++power;
+  }
+  return power;
+}
+
+/**
+ * Converts a value in [-1, 1] to a fixed-point number with the given number of
+ * fractional bits. 1 is saturated to the largest representable number.
+ * @param value The value to convert
+ * @param fractionalBits The number of fractional bits, 15 or 31
+ * @return The rounded fixed-point number
+ */
+static int32_t toFixed(const double value, const unsigned fractionalBits) {
+  const double fullScale = (double)(1UL << fractionalBits);
+  const double scaled = value * fullScale;
+  if (scaled >= fullScale - 0.5) {
+    return (int32_t)(fullScale - 1.0);
+  }
+  if (scaled <= -fullScale) {
+    return (int32_t)(-fullScale);
+  }
+  return (int32_t)(scaled < 0.0 ? scaled - 0.5 : scaled + 0.5);
+}
+
+/**
+ * Returns the largest of a magnitude and the magnitude of a value.
+ */
+static inline int32_t maxMagnitude32(const int32_t maxAbs,
+                                     const int32_t value) {
+  const int32_t valueAbs = value < 0 ? -value : value;
+  return valueAbs > maxAbs ? valueAbs : maxAbs;
+}
+
+/**
+ * Returns the largest of a magnitude and the magnitude of a value.
+ */
+static inline int64_t maxMagnitude64(const int64_t maxAbs,
+                                     const int64_t value) {
+  const int64_t valueAbs = value < 0 ? -value : value;
+  return valueAbs > maxAbs ? valueAbs : maxAbs;
+}
+
+/**
+ * Returns the number of bits by which a level of butterflies must scale its
+ * results down, so that no value can overflow.
+ * @param maxAbs The largest magnitude of the parts at the input of the level
+ * @param growthLimit The largest magnitude that does not need scaling
+ * @return The number of bits to shift the results of the level, from 0 to 2
+ */
+static inline unsigned levelShift(const int64_t maxAbs,
+                                  const int64_t growthLimit) {
+  unsigned shift = 0;
+  while ((maxAbs >> shift) > growthLimit) {
+    ++shift;
+  }
+  return shift;
+}
+
+/**
+ * Defines a function implementing the bit reversal needed by the FFT, on
+ * vectors of the given element type. Both fixed point formats share this
+ * body, which only differs by the type of the swapped elements.
+ * Uses the Gold and Rader's bit reversal algorithm
+ * The defined function takes:
+ * - length The length of the input vectors. Must be a power of 2
+ * - realArray 1D array containing the real part of the incoming vector.
+ * - imaginaryArray 1D array containing the imaginary part of the incoming
+ * vector.
+ */
+#define DEFINE_GOLD_RADER_BIT_REVERSAL(name, type)                             \
+  static void name(const unsigned length, type* realArray,                     \
+                   type* imaginaryArray) {                                     \
+    const unsigned N2 = length >> 1;                                           \
+    unsigned j = 0;                                                            \
+    for (unsigned i = 0; i < length - 1; ++i) {                                \
+      if (i < j) {                                                             \
+        type tmpReal = realArray[i];                                           \
+        type tmpImaginary = imaginaryArray[i];                                 \
+        realArray[i] = realArray[j];                                           \
+        imaginaryArray[i] = imaginaryArray[j];                                 \
+        realArray[j] = tmpReal;                                                \
+        imaginaryArray[j] = tmpImaginary;                                      \
+      }                                                                        \
+                                                                               \
+      unsigned k = N2;                                                         \
+      while (k <= j) {                                                         \
+        j -= k;                                                                \
+        k >>= 1;                                                               \
+      }                                                                        \
+                                                                               \
+      j += k;                                                                  \
+    }                                                                          \
+  }
+
+DEFINE_GOLD_RADER_BIT_REVERSAL(goldRaderBitReversalQ15, fft_q15)
+DEFINE_GOLD_RADER_BIT_REVERSAL(goldRaderBitReversalQ31, fft_q31)
+
+/**
+ * @brief Computes the twiddle factors of a Q15 FFT.
+ * The factor k is cos(2 * pi * k / length) + i * sin(2 * pi * k / length), for
+ * k < length / 2. The angles are given to fastFixedSinCosQ15 in fixed point,
+ * where 2^25 is 2 * pi, which is exact for every power of 2 length, and the
+ * factors are computed with integer operations only.
+ * @param length The length of the FFT. Must be a power of 2
+ * @param twiddleReals Array of length / 2 elements receiving the cosines
+ * @param twiddleImgs Array of length / 2 elements receiving the sines
+ * @return 1 if an error occured, 0 otherwise
+ */
+int fftQ15Twiddles(const unsigned length, fft_q15* twiddleReals,
+                   fft_q15* twiddleImgs) {
+  if (!isPowerOfTwo(length) || length > FIXED_2_PI || twiddleReals == NULL ||
+      twiddleImgs == NULL) {
+    return 1;
+  }
+
+  const uint32_t angleStep = FIXED_2_PI / length;
+  for (unsigned k = 0; k < length / 2; ++k) {
+    fastFixedSinCosQ15(k * angleStep, twiddleImgs + k, twiddleReals + k);
+  }
+  return 0;
+}
+
+/**
+ * @brief Computes the twiddle factors of a Q31 FFT.
+ * The factor k is cos(2 * pi * k / length) + i * sin(2 * pi * k / length), for
+ * k < length / 2. The degree 7 approximation of fastSinCos is used, as the
+ * error of the fixed-point lookup table is above the resolution of Q31 numbers.
+ * @param length The length of the FFT. Must be a power of 2
+ * @param twiddleReals Array of length / 2 elements receiving the cosines
+ * @param twiddleImgs Array of length / 2 elements receiving the sines
+ * @return 1 if an error occured, 0 otherwise
+ */
+int fftQ31Twiddles(const unsigned length, fft_q31* twiddleReals,
+                   fft_q31* twiddleImgs) {
+  if (!isPowerOfTwo(length) || twiddleReals == NULL || twiddleImgs == NULL) {
+    return 1;
+  }
+
+  const double angleStep = PI_TIMES_2 / length;
+  for (unsigned k = 0; k < length / 2; ++k) {
+    const double angle = k * angleStep;
+    fast_sincos_real sine;
+    fast_sincos_real cosine;
+    fastSinCos(angle, 7, &sine, &cosine);
+    twiddleReals[k] = toFixed(cosine, 31);
+    twiddleImgs[k] = toFixed(sine, 31);
+  }
+  return 0;
+}
+
+/**
+ * @brief Computes the FFT of a Q15 vector with block floating point.
+ * Before each level of radix-2 butterflies, the largest magnitude of the
+ * vector is compared to FFT_Q15_GROWTH_LIMIT, and the level scales its results
+ * down by 1 or 2 bits when needed. The total scaling is returned as a shared
+ * exponent: the FFT is realArray * 2^exponent + i * imaginaryArray *
+ * 2^exponent. The inverse FFT includes the division by the length in the
+ * exponent, which can then be negative.
+ * Only integer operations are used, with 32-bit intermediate products.
+ * @param length The length of the vectors. Must be a power of 2
+ * @param realArray 1D array containing the real part of the incoming vector.
+ * This array will contain the end result of the real part of the FFT
+ * @param imaginaryArray 1D array containing the imaginary part of the incoming
+ * vector. This array will contain the end result of the imaginary part of the
+ * FFT
+ * @param twiddleReals The real part of the twiddle factors, see fftQ15Twiddles
+ * @param twiddleImgs The imaginary part of the twiddle factors
+ * @param dir Direction of the FFT. 1 for the FFT, -1 for the inverse FFT
+ * @param exponent Receives the power of 2 by which the result is scaled
+ * @return 1 if an error occured, 0 otherwise
+ */
+int fftQ15(const unsigned length, fft_q15* realArray, fft_q15* imaginaryArray,
+           const fft_q15* twiddleReals, const fft_q15* twiddleImgs,
+           const int dir, int* exponent) {
+  if (!isPowerOfTwo(length) || realArray == NULL || imaginaryArray == NULL ||
+      twiddleReals == NULL || twiddleImgs == NULL || exponent == NULL) {
+    return 1;
+  }
+
+  goldRaderBitReversalQ15(length, realArray, imaginaryArray);
+
+  int32_t maxAbs = 0;
+  for (unsigned i = 0; i < length; ++i) {
+    maxAbs = maxMagnitude32(maxAbs, realArray[i]);
+    maxAbs = maxMagnitude32(maxAbs, imaginaryArray[i]);
+  }
+
+  // The forward FFT uses exp(-2 * pi * i * k / length)
+  const int32_t sinFactor = dir < 0 ? 1 : -1;
+  int scale = 0;
+
+  for (unsigned depth = 2; depth <= length; depth <<= 1) { // for the levels
+
+    const unsigned nElements = depth >> 1;
+    const unsigned twiddleStride = length / depth;
+    const unsigned shift = levelShift(maxAbs, FFT_Q15_GROWTH_LIMIT);
+    const int32_t rounding = (1 << shift) >> 1;
+    scale += shift;
+    maxAbs = 0;
+
+    for (unsigned branch = 0; branch < length;
+         branch += depth) { // current group on depth level
+
+      for (unsigned branchElement = 0; branchElement < nElements;
+           ++branchElement) { // branch element
+
+        const unsigned twiddleIndex = branchElement * twiddleStride;
+        const int32_t wReal = twiddleReals[twiddleIndex];
+        const int32_t wImaginary = sinFactor * twiddleImgs[twiddleIndex];
+
+        const unsigned i0 = branch + branchElement;
+        const unsigned i1 = i0 + nElements;
+
+        // Q15 complex multiplication, rounded to the nearest
+        const int32_t real1 = realArray[i1];
+        const int32_t imaginary1 = imaginaryArray[i1];
+        const int32_t tReal =
+            (wReal * real1 - wImaginary * imaginary1 + (1 << 14)) >> 15;
+        const int32_t tImaginary =
+            (wReal * imaginary1 + wImaginary * real1 + (1 << 14)) >> 15;
+
+        const int32_t real0 = realArray[i0];
+        const int32_t imaginary0 = imaginaryArray[i0];
+        const int32_t outputReal0 = (real0 + tReal + rounding) >> shift;
+        const int32_t outputImaginary0 =
+            (imaginary0 + tImaginary + rounding) >> shift;
+        const int32_t outputReal1 = (real0 - tReal + rounding) >> shift;
+        const int32_t outputImaginary1 =
+            (imaginary0 - tImaginary + rounding) >> shift;
+
+        realArray[i0] = outputReal0;
+        imaginaryArray[i0] = outputImaginary0;
+        realArray[i1] = outputReal1;
+        imaginaryArray[i1] = outputImaginary1;
+
+        maxAbs = maxMagnitude32(maxAbs, outputReal0);
+        maxAbs = maxMagnitude32(maxAbs, outputImaginary0);
+        maxAbs = maxMagnitude32(maxAbs, outputReal1);
+        maxAbs = maxMagnitude32(maxAbs, outputImaginary1);
+      }
+    }
+  }
+
+  *exponent = dir < 0 ? scale - (int)log2PowerOfTwo(length) : scale;
+  return 0;
+}
+
+/**
+ * @brief Computes the FFT of a Q31 vector with block floating point.
+ * Same as fftQ15, with 64-bit intermediate products and FFT_Q31_GROWTH_LIMIT.
+ * @param length The length of the vectors. Must be a power of 2
+ * @param realArray 1D array containing the real part of the incoming vector.
+ * This array will contain the end result of the real part of the FFT
+ * @param imaginaryArray 1D array containing the imaginary part of the incoming
+ * vector. This array will contain the end result of the imaginary part of the
+ * FFT
+ * @param twiddleReals The real part of the twiddle factors, see fftQ31Twiddles
+ * @param twiddleImgs The imaginary part of the twiddle factors
+ * @param dir Direction of the FFT. 1 for the FFT, -1 for the inverse FFT
+ * @param exponent Receives the power of 2 by which the result is scaled
+ * @return 1 if an error occured, 0 otherwise
+ */
+int fftQ31(const unsigned length, fft_q31* realArray, fft_q31* imaginaryArray,
+           const fft_q31* twiddleReals, const fft_q31* twiddleImgs,
+           const int dir, int* exponent) {
+  if (!isPowerOfTwo(length) || realArray == NULL || imaginaryArray == NULL ||
+      twiddleReals == NULL || twiddleImgs == NULL || exponent == NULL) {
+    return 1;
+  }
+
+  goldRaderBitReversalQ31(length, realArray, imaginaryArray);
+
+  // Magnitudes are kept in 64 bits, as -2^31 has no 32-bit magnitude
+  int64_t maxAbs = 0;
+  for (unsigned i = 0; i < length; ++i) {
+    maxAbs = maxMagnitude64(maxAbs, realArray[i]);
+    maxAbs = maxMagnitude64(maxAbs, imaginaryArray[i]);
+  }
+
+  // The forward FFT uses exp(-2 * pi * i * k / length)
+  const int64_t sinFactor = dir < 0 ? 1 : -1;
+  int scale = 0;
+
+  for (unsigned depth = 2; depth <= length; depth <<= 1) { // for the levels
+
+    const unsigned nElements = depth >> 1;
+    const unsigned twiddleStride = length / depth;
+    const unsigned shift = levelShift(maxAbs, FFT_Q31_GROWTH_LIMIT);
+    const int64_t rounding = ((int64_t)1 << shift) >> 1;
+    scale += shift;
+    maxAbs = 0;
+
+    for (unsigned branch = 0; branch < length;
+         branch += depth) { // current group on depth level
+
+      for (unsigned branchElement = 0; branchElement < nElements;
+           ++branchElement) { // branch element
+
+        const unsigned twiddleIndex = branchElement * twiddleStride;
+        const int64_t wReal = twiddleReals[twiddleIndex];
+        const int64_t wImaginary = sinFactor * twiddleImgs[twiddleIndex];
+
+        const unsigned i0 = branch + branchElement;
+        const unsigned i1 = i0 + nElements;
+
+        // Q31 complex multiplication, rounded to the nearest
+        const int64_t real1 = realArray[i1];
+        const int64_t imaginary1 = imaginaryArray[i1];
+        const int64_t tReal =
+            (wReal * real1 - wImaginary * imaginary1 + ((int64_t)1 << 30)) >>
+            31;
+        const int64_t tImaginary =
+            (wReal * imaginary1 + wImaginary * real1 + ((int64_t)1 << 30)) >>
+            31;
+
+        const int64_t real0 = realArray[i0];
+        const int64_t imaginary0 = imaginaryArray[i0];
+        const int64_t outputReal0 = (real0 + tReal + rounding) >> shift;
+        const int64_t outputImaginary0 =
+            (imaginary0 + tImaginary + rounding) >> shift;
+        const int64_t outputReal1 = (real0 - tReal + rounding) >> shift;
+        const int64_t outputImaginary1 =
+            (imaginary0 - tImaginary + rounding) >> shift;
+
+        realArray[i0] = (fft_q31)outputReal0;
+        imaginaryArray[i0] = (fft_q31)outputImaginary0;
+        realArray[i1] = (fft_q31)outputReal1;
+        imaginaryArray[i1] = (fft_q31)outputImaginary1;
+
+        maxAbs = maxMagnitude64(maxAbs, outputReal0);
+        maxAbs = maxMagnitude64(maxAbs, outputImaginary0);
+        maxAbs = maxMagnitude64(maxAbs, outputReal1);
+        maxAbs = maxMagnitude64(maxAbs, outputImaginary1);
+      }
+    }
+  }
+
+  *exponent = dir < 0 ? scale - (int)log2PowerOfTwo(length) : scale;
+  return 0;
+}
@@ -0,0 +1,36 @@
+#ifndef FFT_FIXED_H
+#define FFT_FIXED_H
+
+#include <stdint.h>
+
+// Fixed-point numbers in [-1, 1), with 15 and 31 fractional bits
+typedef int16_t fft_q15;
+typedef int32_t fft_q31;
+
+// Largest magnitude allowed at the input of a butterfly level without
+// scaling. A radix-2 butterfly can grow each part by a factor of up to
+// 1 + sqrt(2), so the values are kept below 0.4 of the full scale.
+#define FFT_Q15_GROWTH_LIMIT 13107      // 0.4 * 2^15
+#define FFT_Q31_GROWTH_LIMIT 858993459L // 0.4 * 2^31
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int fftQ15Twiddles(const unsigned length, fft_q15* twiddleReals,
+                   fft_q15* twiddleImgs);
+int fftQ15(const unsigned length, fft_q15* realArray, fft_q15* imaginaryArray,
+           const fft_q15* twiddleReals, const fft_q15* twiddleImgs,
+           const int dir, int* exponent);
+
+int fftQ31Twiddles(const unsigned length, fft_q31* twiddleReals,
+                   fft_q31* twiddleImgs);
+int fftQ31(const unsigned length, fft_q31* realArray, fft_q31* imaginaryArray,
+           const fft_q31* twiddleReals, const fft_q31* twiddleImgs,
+           const int dir, int* exponent);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FFT_FIXED_H
@@ -0,0 +1,504 @@
+#include "fast_math.h"
+#include <math.h>
+
+static fast_math_real lookupExp(const fast_math_real x, const int degree);
+static fast_math_real polynomialExp(const fast_math_real x, const int degree);
+static fast_math_real lookupLog(const fast_math_real mantissa,
+                                const int degree);
+static fast_math_real polynomialLog(const fast_math_real mantissa,
+                                    const int degree);
+static fast_math_real polynomialAtan(const fast_math_real x, const int degree);
+static inline long roundToLong(const fast_math_real x);
+
+// Configure table management
+#if defined __has_attribute
+// Define table storage and access mode. The tables are read as floats from the
+// program memory, as doubles are 32 bits on AVR.
+#if __has_attribute(__progmem__)
+#include <avr/pgmspace.h>
+#define ACCESS_TABLE(table, index) pgm_read_float_near((table) + (index))
+#else
+#define PROGMEM
+#define ACCESS_TABLE(table, index) (table)[index]
+#endif
+#else
+#define PROGMEM
+#define ACCESS_TABLE(table, index) (table)[index]
+#endif
+
+// ln(2) split in two parts (Cody-Waite), so that k * LN2_HIGH is exact
+#define LN2_HIGH 6.93147180369123816490e-01
+#define LN2_LOW 1.90821492927058770002e-10
+#define LOG2_E 1.44269504088896340736  // 1 / ln(2)
+#define LOG10_E 0.43429448190325182765 // 1 / ln(10)
+#define SQRT_1_2 0.70710678118654752440
+#define TAN_PI_8 0.41421356237309504880
+#define FAST_MATH_PI 3.14159265358979323846
+#define FAST_MATH_PI_2 1.57079632679489661923
+#define FAST_MATH_PI_4 0.78539816339744830962
+
+// Beyond this magnitude, exp overflows or underflows in any precision
+#define EXP_LIMIT 1000.0
+
+/**
+ * 2^(i / 64), used by the lookup approximation of exp
+ */
+static const fast_math_real expTable[FAST_MATH_EXP_TABLE_SIZE] PROGMEM = {
+    1.00000000000000000e+00, 1.01088928605170048e+00, 1.02189714865411663e+00,
+    1.03302487902122841e+00, 1.04427378242741375e+00, 1.05564517836055716e+00,
+    1.06714040067682370e+00, 1.07876079775711986e+00, 1.09050773266525769e+00,
+    1.10238258330784089e+00, 1.11438674259589243e+00, 1.12652161860824185e+00,
+    1.13878863475669156e+00, 1.15118922995298267e+00, 1.16372485877757748e+00,
+    1.17639699165028122e+00, 1.18920711500272103e+00, 1.20215673145270308e+00,
+    1.21524735998046896e+00, 1.22848053610687002e+00, 1.24185781207348400e+00,
+    1.25538075702469110e+00, 1.26905095719173322e+00, 1.28287001607877826e+00,
+    1.29683955465100964e+00, 1.31096121152476441e+00, 1.32523664315974132e+00,
+    1.33966752405330292e+00, 1.35425554693689265e+00, 1.36900242297459052e+00,
+    1.38390988196383202e+00, 1.39897967253831124e+00, 1.41421356237309515e+00,
+    1.42961333839197002e+00, 1.44518080697704665e+00, 1.46091779418064704e+00,
+    1.47682614593949935e+00, 1.49290772829126484e+00, 1.50916442759342284e+00,
+    1.52559815074453842e+00, 1.54221082540794074e+00, 1.55900440023783693e+00,
+    1.57598084510788650e+00, 1.59314215134226700e+00, 1.61049033194925428e+00,
+    1.62802742185734783e+00, 1.64575547815396495e+00, 1.66367658032673638e+00,
+    1.68179283050742900e+00, 1.70010635371852348e+00, 1.71861929812247793e+00,
+    1.73733383527370622e+00, 1.75625216037329945e+00, 1.77537649252652119e+00,
+    1.79470907500310717e+00, 1.81425217550039886e+00, 1.83400808640934243e+00,
+    1.85397912508338547e+00, 1.87416763411029996e+00, 1.89457598158696561e+00,
+    1.91520656139714740e+00, 1.93606179349229435e+00, 1.95714412417540018e+00,
+    1.97845602638795093e+00};
+
+/**
+ * log(c) and 1 / c, for c = 1 + (i + 0.5) / 64 the centers of the intervals
+ * of the lookup approximation of log
+ */
+static const fast_math_real logTable[FAST_MATH_LOG_TABLE_SIZE] PROGMEM = {
+    7.78214044205494896e-03, 2.31670592815343794e-02, 3.83188643021366016e-02,
+    5.32445145188122845e-02, 6.79506619085077507e-02, 8.24436692110745856e-02,
+    9.67296264585511129e-02, 1.10814366340290113e-01, 1.24703478500957241e-01,
+    1.38402322859119131e-01, 1.51916042025841969e-01, 1.65249572895307173e-01,
+    1.78407657472818310e-01, 1.91394852999629467e-01, 2.04215541428690889e-01,
+    2.16873938300614355e-01, 2.29374101064845820e-01, 2.41719936887145159e-01,
+    2.53915209980963452e-01, 2.65963548497137936e-01, 2.77868451003456307e-01,
+    2.89633292583042656e-01, 3.01261330578161790e-01, 3.12755710003896903e-01,
+    3.24119468654211984e-01, 3.35355541921137812e-01, 3.46466767346208571e-01,
+    3.57455888921803799e-01, 3.68325561158707626e-01, 3.79078352934969443e-01,
+    3.89716751140025186e-01, 4.00243164127012718e-01, 4.10659924985268376e-01,
+    4.20969294644129632e-01, 4.31173464818371321e-01, 4.41274560804875204e-01,
+    4.51274644139458558e-01, 4.61175715122170149e-01, 4.70979715218791006e-01,
+    4.80688529345751903e-01, 4.90303988045193817e-01, 4.99827869556449311e-01,
+    5.09261901789807903e-01, 5.18607764208045663e-01, 5.27867089620842389e-01,
+    5.37041465896883619e-01, 5.46132437598135678e-01, 5.55141507540501622e-01,
+    5.64070138284803013e-01, 5.72919753561785483e-01, 5.81691739634622507e-01,
+    5.90387446602176347e-01, 5.99008189646083378e-01, 6.07555250224541821e-01,
+    6.16029877215514055e-01, 6.24433288011893461e-01, 6.32766669571037776e-01,
+    6.41031179420931241e-01, 6.49227946625109853e-01, 6.57358072708359997e-01,
+    6.65422632545090487e-01, 6.73422675212166699e-01, 6.81359224807903119e-01,
+    6.89233281238809004e-01};
+static const fast_math_real inverseTable[FAST_MATH_LOG_TABLE_SIZE] PROGMEM = {
+    9.92248062015503862e-01, 9.77099236641221336e-01, 9.62406015037593932e-01,
+    9.48148148148148184e-01, 9.34306569343065663e-01, 9.20863309352518034e-01,
+    9.07801418439716290e-01, 8.95104895104895104e-01, 8.82758620689655160e-01,
+    8.70748299319727859e-01, 8.59060402684563740e-01, 8.47682119205298013e-01,
+    8.36601307189542509e-01, 8.25806451612903225e-01, 8.15286624203821697e-01,
+    8.05031446540880546e-01, 7.95031055900621064e-01, 7.85276073619631920e-01,
+    7.75757575757575757e-01, 7.66467065868263520e-01, 7.57396449704141994e-01,
+    7.48538011695906391e-01, 7.39884393063583778e-01, 7.31428571428571428e-01,
+    7.23163841807909602e-01, 7.15083798882681587e-01, 7.07182320441988921e-01,
+    6.99453551912568305e-01, 6.91891891891891930e-01, 6.84491978609625629e-01,
+    6.77248677248677211e-01, 6.70157068062827266e-01, 6.63212435233160646e-01,
+    6.56410256410256410e-01, 6.49746192893400965e-01, 6.43216080402010060e-01,
+    6.36815920398009938e-01, 6.30541871921182273e-01, 6.24390243902439024e-01,
+    6.18357487922705285e-01, 6.12440191387559785e-01, 6.06635071090047440e-01,
+    6.00938967136150248e-01, 5.95348837209302317e-01, 5.89861751152073732e-01,
+    5.84474885844748826e-01, 5.79185520361991002e-01, 5.73991031390134521e-01,
+    5.68888888888888888e-01, 5.63876651982378907e-01, 5.58951965065502154e-01,
+    5.54112554112554112e-01, 5.49356223175965663e-01, 5.44680851063829796e-01,
+    5.40084388185653963e-01, 5.35564853556485310e-01, 5.31120331950207469e-01,
+    5.26748971193415683e-01, 5.22448979591836782e-01, 5.18218623481781382e-01,
+    5.14056224899598346e-01, 5.09960159362549792e-01, 5.05928853754940677e-01,
+    5.01960784313725483e-01};
+
+/**
+ * @brief Fast exponential computation.
+ * With degrees of 3, 5 and 7, x is reduced to x = k * ln(2) + r, with r in
+ * [-ln(2) / 2, ln(2) / 2], and a minimax polynomial approximates exp(r). With
+ * degrees 1 and 2, x is reduced to x = k * ln(2) / 64 + r, and exp(r) is
+ * approximated by a polynomial of degree 1 or 2 times 2^((k mod 64) / 64),
+ * from a lookup table. Invalid degrees will default to 7.
+ * @param x The exponent
+ * @param degree The degree of the approximation.
+ * Higher is more accurate, but slower.
+ * @return An approximation of e^x
+ */
+fast_math_real fastExp(const fast_math_real x, const int degree) {
+  if (x != x) {
+    return x; // NaN
+  }
+
+  // Clamped so that the exponent of 2 stays in range. ldexp then overflows to
+  // infinity or underflows to 0 as exp would
+  fast_math_real clamped = x;
+  if (clamped > EXP_LIMIT) {
+    clamped = EXP_LIMIT;
+  } else if (clamped < -EXP_LIMIT) {
+    clamped = -EXP_LIMIT;
+  }
+
+  switch (degree) {
+  case 1:
+  case 2:
+    return lookupExp(clamped, degree);
+  default:
+    return polynomialExp(clamped, degree);
+  }
+}
+
+/**
+ * @brief Fast natural logarithm computation.
+ * x is split as m * 2^e. With degrees of 3, 5 and 7, m is in
+ * [sqrt(2) / 2, sqrt(2)) and log(m) = 2 * atanh(s), s = (m - 1) / (m + 1), is
+ * approximated by a minimax polynomial in s. With degrees 1 and 2, m is in
+ * [1, 2), log(m) is read in a lookup table at the nearest center c, and
+ * log(m / c) is approximated by a polynomial of degree 1 or 2. Zero, negative,
+ * infinite and NaN values are given to libm. Invalid degrees will default to
+ * 7.
+ * @param x The value
+ * @param degree The degree of the approximation.
+ * Higher is more accurate, but slower.
+ * @return An approximation of ln(x)
+ */
+fast_math_real fastLog(const fast_math_real x, const int degree) {
+  if (!(x > 0) || x == INFINITY) {
+    return log(x);
+  }
+
+  int exponent;
+  fast_math_real mantissa = frexp(x, &exponent); // In [0.5, 1)
+
+  fast_math_real logMantissa;
+  switch (degree) {
+  case 1:
+  case 2:
+    logMantissa = lookupLog(2 * mantissa, degree);
+    --exponent;
+    break;
+  default:
+    if (mantissa < SQRT_1_2) {
+      mantissa *= 2;
+      --exponent;
+    }
+    logMantissa = polynomialLog(mantissa, degree);
+    break;
+  }
+
+  return exponent * LN2_HIGH + (exponent * LN2_LOW + logMantissa);
+}
+
+/**
+ * @brief Fast base 10 logarithm computation, from fastLog.
+ * @param x The value
+ * @param degree The degree of the approximation, as in fastLog.
+ * @return An approximation of log10(x)
+ */
+fast_math_real fastLog10(const fast_math_real x, const int degree) {
+  return fastLog(x, degree) * LOG10_E;
+}
+
+/**
+ * @brief Fast power computation, as exp(y * log(x)).
+ * The relative error is about the relative error of fastExp plus |y| times
+ * the absolute error of fastLog. Negative and zero values of x are given to
+ * libm, as they need the parity of y.
+ * @param x The base
+ * @param y The exponent
+ * @param degree The degree of the approximations.
+ * Higher is more accurate, but slower.
+ * @return An approximation of x^y
+ */
+fast_math_real fastPow(const fast_math_real x, const fast_math_real y,
+                       const int degree) {
+  if (!(x > 0)) {
+    return pow(x, y);
+  }
+  return fastExp(y * fastLog(x, degree), degree);
+}
+
+/**
+ * @brief Fast square root computation.
+ * x is split as m * 2^e, with m in [0.25, 1) and e even. A quadratic
+ * approximation of 1 / sqrt(m) is refined with Newton-Raphson iterations,
+ * which need no division, and sqrt(x) = m / sqrt(m) * 2^(e / 2). The degree
+ * selects the number of iterations: 1 for degrees 1 and 2, 2 for degree 3, 3
+ * for degree 5 and 4 for degree 7. Zero, negative, infinite and NaN values
+ * are given to libm. Invalid degrees will default to 7.
+ * @param x The value
+ * @param degree The degree of the approximation.
+ * Higher is more accurate, but slower.
+ * @return An approximation of sqrt(x)
+ */
+fast_math_real fastSqrt(const fast_math_real x, const int degree) {
+  if (!(x > 0) || x == INFINITY) {
+    return sqrt(x);
+  }
+
+  int exponent;
+  fast_math_real mantissa = frexp(x, &exponent); // In [0.5, 1)
+  if (exponent & 1) {
+    mantissa *= 0.5;
+    ++exponent;
+  }
+
+  int iterations;
+  switch (degree) {
+  case 1:
+  case 2:
+    iterations = 1;
+    break;
+  case 3:
+    iterations = 2;
+    break;
+  case 5:
+    iterations = 3;
+    break;
+  default:
+  case 7:
+    iterations = 4;
+    break;
+  }
+
+  // Minimax approximation of 1 / sqrt(m) on [0.25, 1), with a relative error
+  // of 2.4e-2, which each iteration squares
+  fast_math_real inverse =
+      (1.63856786746695215 * mantissa - 3.28535661918110478) * mantissa +
+      2.67083538883563287;
+  const fast_math_real halfMantissa = 0.5 * mantissa;
+  for (int i = 0; i < iterations; ++i) {
+    inverse *= 1.5 - halfMantissa * inverse * inverse;
+  }
+
+  return ldexp(mantissa * inverse, exponent / 2);
+}
+
+/**
+ * @brief Fast arc tangent of y / x, in the quadrant of (x, y).
+ * The ratio of the smallest to the largest magnitude is in [0, 1]. Above
+ * tan(pi / 8), atan(z) = pi / 4 + atan((z - 1) / (z + 1)), so that a minimax
+ * odd polynomial of degree 3, 5 or 7 approximates atan on
+ * [-tan(pi / 8), tan(pi / 8)]. Degrees 1 and 2 use the degree 3 polynomial.
+ * Zero, infinite and NaN values are given to libm. Invalid degrees will default
+ * to 7.
+ * @param y The ordinate
+ * @param x The abscissa
+ * @param degree The degree of the approximation.
+ * Higher is more accurate, but slower.
+ * @return An approximation of atan2(y, x), in [-pi, pi]
+ */
+fast_math_real fastAtan2(const fast_math_real y, const fast_math_real x,
+                         const int degree) {
+  const fast_math_real absoluteX = fabs(x);
+  const fast_math_real absoluteY = fabs(y);
+  if (!(absoluteX + absoluteY > 0) || absoluteX + absoluteY == INFINITY) {
+    return atan2(y, x);
+  }
+
+  // Angle in the first octant, or in the second one when y is larger
+  const int isSwapped = absoluteY > absoluteX;
+  fast_math_real ratio =
+      isSwapped ? absoluteX / absoluteY : absoluteY / absoluteX;
+  fast_math_real angle = 0;
+  if (ratio > TAN_PI_8) {
+    ratio = (ratio - 1) / (ratio + 1);
+    angle = FAST_MATH_PI_4;
+  }
+  angle += polynomialAtan(ratio, degree);
+
+  if (isSwapped) {
+    angle = FAST_MATH_PI_2 - angle;
+  }
+  if (x < 0) {
+    angle = FAST_MATH_PI - angle;
+  }
+  return y < 0 ? -angle : angle;
+}
+
+/**
+ * Lookup approximation of exp: x = k * ln(2) / 64 + r, with
+ * |r| <= ln(2) / 128, and e^x = 2^(k / 64) * e^r, the fractional power of 2
+ * coming from the table.
+ * Coefficients were obtained with the Remez algorithm.
+ * @param x The exponent, in [-EXP_LIMIT, EXP_LIMIT]
+ * @param degree The degree of the approximation of e^r, 1 or 2
+ * @return An approximation of e^x
+ */
+static fast_math_real lookupExp(const fast_math_real x, const int degree) {
+  const long k = roundToLong(x * (FAST_MATH_EXP_TABLE_SIZE * LOG2_E));
+  const fast_math_real reduced =
+      (x - k * (LN2_HIGH / FAST_MATH_EXP_TABLE_SIZE)) -
+      k * (LN2_LOW / FAST_MATH_EXP_TABLE_SIZE);
+
+  // k = 64 * power + index, with index in [0, 64)
+  const int index = k & (FAST_MATH_EXP_TABLE_SIZE - 1);
+  const int power = (k - index) / FAST_MATH_EXP_TABLE_SIZE;
+
+  fast_math_real expReduced;
+  if (degree == 1) {
+    expReduced = 9.99997556272873234e-01 * reduced + 1.00000733107147699e+00;
+  } else {
+    expReduced = (4.99999083606488925e-01 * reduced + 1.00000366555652764e+00) *
+                     reduced +
+                 1.00000000002687273e+00;
+  }
+
+  return ldexp(ACCESS_TABLE(expTable, index) * expReduced, power);
+}
+
+/**
+ * Polynomial approximation of exp: x = k * ln(2) + r, with
+ * |r| <= ln(2) / 2, and e^x = 2^k * e^r.
+ * Coefficients were obtained with the Remez algorithm, on the relative error.
+ * Horner's method (nested multiplication) is then used for faster calculations.
+ * @param x The exponent, in [-EXP_LIMIT, EXP_LIMIT]
+ * @param degree The degree of the approximation of e^r, 3, 5 or 7
+ * @return An approximation of e^x
+ */
+static fast_math_real polynomialExp(const fast_math_real x, const int degree) {
+  const long k = roundToLong(x * LOG2_E);
+  const fast_math_real r = (x - k * LN2_HIGH) - k * LN2_LOW;
+
+  fast_math_real expReduced;
+  switch (degree) {
+  case 3:
+    expReduced = ((1.65668423479643334e-01 * r + 5.04963264182239802e-01) * r +
+                  1.00016418576109478e+00) *
+                     r +
+                 9.99928073540495621e-01;
+    break;
+  case 5:
+    expReduced = ((((8.29765508036347209e-03 * r + 4.19153819916958728e-02) *
+                        r +
+                    1.66675747287550441e-01) *
+                       r +
+                   4.99988948512219644e-01) *
+                      r +
+                  9.99999691991516726e-01) *
+                     r +
+                 1.00000007165468219e+00;
+    break;
+  default:
+  case 7:
+    expReduced =
+        ((((((1.97751715465279765e-04 * r + 1.39481833279241681e-03) * r +
+             8.33356109028514022e-03) *
+                r +
+            4.16662254254896586e-02) *
+               r +
+           1.66666651261370952e-01) *
+              r +
+          5.00000010453621746e-01) *
+             r +
+         1.00000000024309665e+00) *
+            r +
+        9.99999999961681985e-01;
+    break;
+  }
+
+  return ldexp(expReduced, k);
+}
+
+/**
+ * Lookup approximation of log on [1, 2): m is in the interval of center
+ * c = 1 + (i + 0.5) / 64, and log(m) = log(c) + log(1 + t), with
+ * t = (m - c) / c and |t| <= 1 / 128. log(c) and 1 / c come from the tables.
+ * @param mantissa The value, in [1, 2)
+ * @param degree The degree of the approximation of log(1 + t), 1 or 2
+ * @return An approximation of log(mantissa)
+ */
+static fast_math_real lookupLog(const fast_math_real mantissa,
+                                const int degree) {
+  const int index = (int)((mantissa - 1) * FAST_MATH_LOG_TABLE_SIZE);
+  const fast_math_real center =
+      1 + (index + 0.5) * (1.0 / FAST_MATH_LOG_TABLE_SIZE);
+  const fast_math_real t =
+      (mantissa - center) * ACCESS_TABLE(inverseTable, index);
+
+  fast_math_real logRatio = t;
+  if (degree == 2) {
+    logRatio -= 0.5 * t * t;
+  }
+  return ACCESS_TABLE(logTable, index) + logRatio;
+}
+
+/**
+ * Polynomial approximation of log on [sqrt(2) / 2, sqrt(2)):
+ * log(m) = 2 * atanh(s), with s = (m - 1) / (m + 1) and
+ * |s| <= 3 - 2 * sqrt(2).
+ * Coefficients were obtained with the Remez algorithm.
+ * Horner's method (nested multiplication) is then used for faster calculations.
+ * @param mantissa The value, in [sqrt(2) / 2, sqrt(2))
+ * @param degree The degree of the approximation in s, 3, 5 or 7
+ * @return An approximation of log(mantissa)
+ */
+static fast_math_real polynomialLog(const fast_math_real mantissa,
+                                    const int degree) {
+  const fast_math_real s = (mantissa - 1) / (mantissa + 1);
+  const fast_math_real sSquared = s * s;
+  switch (degree) {
+  case 3:
+    return (6.81734171969380132e-01 * sSquared + 1.99988804829720168e+00) * s;
+  case 5:
+    return ((4.15177060106323326e-01 * sSquared + 6.66440780416603706e-01) *
+                sSquared +
+            2.00000083703830134e+00) *
+           s;
+  default:
+  case 7:
+    return (((3.01003281297470171e-01 * sSquared + 3.99657949223109543e-01) *
+                 sSquared +
+             6.66669484507569687e-01) *
+                sSquared +
+            1.99999999374381621e+00) *
+           s;
+  }
+}
+
+/**
+ * Polynomial approximation of atan on [-tan(pi / 8), tan(pi / 8)].
+ * Coefficients were obtained with the Remez algorithm.
+ * Horner's method (nested multiplication) is then used for faster calculations.
+ * @param x The value, in [-tan(pi / 8), tan(pi / 8)]
+ * @param degree The degree of the approximation, 3, 5 or 7. Lower degrees use
+ * the degree 3
+ * @return An approximation of atan(x)
+ */
+static fast_math_real polynomialAtan(const fast_math_real x, const int degree) {
+  const fast_math_real xSquared = x * x;
+  switch (degree) {
+  case 1:
+  case 2:
+  case 3:
+    return (-2.95510352316788572e-01 * xSquared + 9.98460061620409900e-01) * x;
+  case 5:
+    return ((1.63585676014841669e-01 * xSquared - 3.30395626170169099e-01) *
+                xSquared +
+            9.99939370346684786e-01) *
+           x;
+  default:
+  case 7:
+    return (((-1.07797118167602457e-01 * xSquared + 1.95809741579654528e-01) *
+                 xSquared -
+             3.33141694109059305e-01) *
+                xSquared +
+            9.99997608654762726e-01) *
+           x;
+  }
+}
+
+/**
+ * @brief Rounds to the nearest integer, halfway cases away from zero, without
+ * calling libm.
+ * @param x The value, within the range of a long
+ * @return The rounded value
+ */
+static inline long roundToLong(const fast_math_real x) {
+  return (long)(x < 0 ? x - 0.5 : x + 0.5);
+}
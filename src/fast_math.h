@@ -0,0 +1,55 @@
+#ifndef FAST_MATH_H
+#define FAST_MATH_H
+
+#ifndef fast_math_real
+#define fast_math_real double
+#endif
+
+/**
+ * Fast approximations of exp, log, log10, pow, sqrt and atan2.
+ * As with fast_sincos, the degree selects the approximation. For exp and log,
+ * degrees 1 and 2 use a lookup table followed by a polynomial of degree 1 or
+ * 2, and degrees 3, 5 and 7 use a polynomial of that degree. sqrt uses 1 to 4
+ * Newton-Raphson iterations, 1 for degrees 1 and 2, and atan2 uses the degree
+ * 3 polynomial for degrees 1 and 2. Higher is more accurate, but slower.
+ * Invalid degrees default to 7.
+ *
+ * Max errors measured against libm:
+ * | degree | exp (relative) | log (absolute) | sqrt (relative) | atan2      |
+ * | 1      | 7.4e-6         | 3.1e-5         | 8.8e-4          | as 3       |
+ * | 2      | 6.7e-9         | 1.6e-7         | 8.8e-4          | as 3       |
+ * | 3      | 7.5e-5         | 3.9e-6         | 1.2e-6          | 1.3e-4     |
+ * | 5      | 7.5e-8         | 2.1e-8         | 2.0e-12         | 3.6e-6     |
+ * | 7      | 4.1e-11        | 1.2e-10        | 4.4e-16         | 1.1e-7     |
+ *
+ * Modules can use these approximations instead of libm with a compile-time
+ * switch, whose value is the degree:
+ * MONTE_CARLO_FAST_MATH for calcUCB, GENETIC_FAST_MATH for
+ * randomPoissonGenerator, STATS_FAST_MATH for the distances of the
+ * clustering and MCU_ANN_FAST_MATH for the softmax of the MNIST prototype.
+ * Each module includes fast_math.h privately, and fast_math.c must then be
+ * compiled with the module.
+ */
+
+// Tables of the lookup approximations
+#define FAST_MATH_EXP_TABLE_SIZE 64 // Values of 2^(i / 64)
+#define FAST_MATH_LOG_TABLE_SIZE 64 // Values of log(1 + (i + 0.5) / 64)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+fast_math_real fastExp(const fast_math_real x, const int degree);
+fast_math_real fastLog(const fast_math_real x, const int degree);
+fast_math_real fastLog10(const fast_math_real x, const int degree);
+fast_math_real fastPow(const fast_math_real x, const fast_math_real y,
+                       const int degree);
+fast_math_real fastSqrt(const fast_math_real x, const int degree);
+fast_math_real fastAtan2(const fast_math_real y, const fast_math_real x,
+                         const int degree);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FAST_MATH_H
@@ -13,16 +13,67 @@ static fast_sincos_real
 lookupSinInterpolate(const fast_sincos_real angleRadians);
 static fast_sincos_real lookupCos(const fast_sincos_real angleRadians);
 static fast_sincos_real lookupSin(const fast_sincos_real angleRadians);
+static void lookupSinCosInterpolate(uint16_t index, uint16_t remainder,
+                                    int negativeSine, fast_sincos_real* sine,
+                                    fast_sincos_real* cosine);
 static inline fast_sincos_real
 scaleValueToRadians(const fast_sincos_real value);
+static inline uint16_t fixedRemainder(const uint32_t fixedAngle);
+static void sinCosArray(const unsigned length, const fast_sincos_real* angles,
+                        fast_sincos_real* sines, fast_sincos_real* cosines,
+                        const int degree);
+
+// Constants of the branch-free range reduction of the array functions.
+// PI / 2 is split in three parts (Cody-Waite), the first two having 33
+// significant bits, so that the products with quadrants up to 2^20 are exact.
+#define TWO_OVER_PI 6.36619772367581382433e-01
+#define PI_2_HIGH 1.57079632673412561417e+00
+#define PI_2_MID 6.07710050630396597660e-11
+#define PI_2_LOW 2.02226624879595063154e-21
+
+// Adding then subtracting 1.5 * 2^52 (1.5 * 2^23 for a float) rounds to the
+// nearest integer, and leaves this integer in the low bits of the sum
+#define ROUNDING_CONSTANT                                                      \
+  ((fast_sincos_real)(sizeof(fast_sincos_real) == sizeof(float)                \
+                          ? 12582912.0                                         \
+                          : 6755399441055744.0))
+
+// Vector extensions used by the array functions when fast_sincos_real is a
+// double. Defining FAST_SINCOS_NO_SIMD keeps the portable loop only.
+#ifndef FAST_SINCOS_NO_SIMD
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define FAST_SINCOS_AVX2
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define FAST_SINCOS_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define FAST_SINCOS_NEON
+#endif
+#endif
+
+#if defined(FAST_SINCOS_AVX2) || defined(FAST_SINCOS_SSE2) ||                  \
+    defined(FAST_SINCOS_NEON)
+#define FAST_SINCOS_VECTOR
+static unsigned sinCosArrayVector(const unsigned length, const double* angles,
+                                  double* sines, double* cosines,
+                                  const int degree);
+#endif
 
 // Configure sine table management
 #if defined __has_attribute
 // Define table storage and access mode
 #if __has_attribute(__progmem__)
 #include <avr/pgmspace.h>
+#if FAST_SINCOS_TABLE_BITS == 8
+#define ACCESS_TABLE(index) pgm_read_byte_near(sineTable + index)
+#elif FAST_SINCOS_TABLE_BITS == 16
 #define ACCESS_TABLE(index) pgm_read_word_near(sineTable + index)
 #else
+#define ACCESS_TABLE(index) pgm_read_dword_near(sineTable + index)
+#endif
+#else
 #define PROGMEM
 #define ACCESS_TABLE(index) sineTable[index]
 #endif
@@ -31,14 +82,36 @@ scaleValueToRadians(const fast_sincos_real value);
 #define ACCESS_TABLE(index) sineTable[index]
 #endif
 
+// Type of the table elements, and type holding the product of a difference
+// of elements by an interpolation remainder
+#if FAST_SINCOS_TABLE_BITS == 8
+typedef uint8_t lookup_value;
+typedef uint32_t lookup_product;
+#elif FAST_SINCOS_TABLE_BITS == 16
+typedef uint16_t lookup_value;
+typedef uint32_t lookup_product;
+#else
+typedef uint32_t lookup_value;
+typedef uint64_t lookup_product;
+#endif
+
+static lookup_value lookupFixedSin(const uint32_t fixedAngle, int* negative);
+static lookup_value lookupFixedCos(const uint32_t fixedAngle, int* negative);
+static void lookupSinCosValues(uint16_t index, uint16_t remainder,
+                               lookup_value* sineValue,
+                               lookup_value* cosineValue, int* negativeSine,
+                               int* negativeCosine);
+static inline int16_t valueToQ15(const lookup_value value, const int negative);
+static inline int32_t valueToQ31(const lookup_value value, const int negative);
+
 /**
  * Sine table used for sine and cosine approximation
  * This sine table only contains the first quadrant
  * The size of this table is "QUADRANT_SIZE + 1"
  * The "+ 1" allows for interpolation
  *
- * The table is scaled from 0 to 65536, despite the
- * fact that the maximum number is 65535
+ * The table is scaled from 0 to 2^FAST_SINCOS_TABLE_BITS, despite the
+ * fact that the maximum number is 2^FAST_SINCOS_TABLE_BITS - 1
  *
  * It is recommended to put this table in the
  * program memory (flash) instead of the SRAM, as
@@ -47,22 +120,11 @@ scaleValueToRadians(const fast_sincos_real value);
  * Using PROGMEM requires special methods to access the data,
  * such as pgm_read_word_near
  *
- * Below is the definition of the table to instantiate
+ * The tables of every QUADRANT_SIZE and FAST_SINCOS_TABLE_BITS are generated
+ * by tools/generate_sine_tables.py, and the matching one is instantiated
  * in the program memory
  */
-static const uint16_t sineTable[129] PROGMEM = {
-    0,     804,   1608,  2412,  3216,  4019,  4821,  5623,  6424,  7224,  8022,
-    8820,  9616,  10411, 11204, 11996, 12785, 13573, 14359, 15143, 15924, 16703,
-    17479, 18253, 19024, 19792, 20557, 21320, 22078, 22834, 23586, 24335, 25080,
-    25821, 26558, 27291, 28020, 28745, 29466, 30182, 30893, 31600, 32303, 33000,
-    33692, 34380, 35062, 35738, 36410, 37076, 37736, 38391, 39040, 39683, 40320,
-    40951, 41576, 42194, 42806, 43412, 44011, 44604, 45190, 45769, 46341, 46906,
-    47464, 48015, 48559, 49095, 49624, 50146, 50660, 51166, 51665, 52156, 52639,
-    53114, 53581, 54040, 54491, 54934, 55368, 55794, 56212, 56621, 57022, 57414,
-    57798, 58172, 58538, 58896, 59244, 59583, 59914, 60235, 60547, 60851, 61145,
-    61429, 61705, 61971, 62228, 62476, 62714, 62943, 63162, 63372, 63572, 63763,
-    63944, 64115, 64277, 64429, 64571, 64704, 64827, 64940, 65043, 65137, 65220,
-    65294, 65358, 65413, 65457, 65492, 65516, 65531, 65535};
+#include "fast_sincos_table.h"
 
 /**
  * @brief Fast sine computation.
@@ -171,49 +233,110 @@ fast_sincos_real fastCos(const fast_sincos_real angleRadians,
 }
 
 /**
- * @brief Fast sine approximation in fixed point.
- * In this fixed point representation, the original range
- * 0 to 2PI is now 0 to 2^25.
- * @param fixedAngle The angle in fixed point.
- * @return A sine approximation of the angle.
+ * @brief Fast sine and cosine computation of the same angle.
+ * The results are the same as fastSin and fastCos, but the range reduction, or
+ * the lookup table index, is computed once for both.
+ * @param angleRadians The angle, in radians.
+ * @param degree The degree of the approximation.
+ * Higher is more accurate, but slower.
+ * @param sine Receives the sine approximation of the angle.
+ * @param cosine Receives the cosine approximation of the angle.
  */
-fast_sincos_real fastFixedSin(const uint32_t fixedAngle) {
+void fastSinCos(const fast_sincos_real angleRadians, const int degree,
+                fast_sincos_real* sine, fast_sincos_real* cosine) {
 
-  const uint16_t indexMask = 0x1FF; // 9 last bits
+  if (degree == 1 || degree == 2) {
+    fast_sincos_real scaledAngle = angleRadians * LOOKUP_SCALE_FACTOR;
+    int negativeSine = 0;
+    if (scaledAngle < 0) {
+      negativeSine = 1;
+      scaledAngle = -scaledAngle;
+    }
 
-  uint16_t remainder = fixedAngle;                            // 16 lsb bits
-  uint16_t index = (((uint16_t*)&fixedAngle)[1]) & indexMask; // 9 last bits
+    if (degree == 2) {
+      long roundedAngle = scaledAngle;
+      uint16_t remainder =
+          ldexpf(scaledAngle - roundedAngle, LOOKUP_REMAINDER_BITS);
+      lookupSinCosInterpolate(roundedAngle & LOOKUP_INDEX_MASK, remainder,
+                              negativeSine, sine, cosine);
+      return;
+    }
 
-  // Isolate the angle in the first quandrant
-  int negativeFactor = 0;
-  if (index >= QUADRANT_SIZE_2) {
-    index -= QUADRANT_SIZE_2;
-    negativeFactor = 1;
-  }
+    long roundedAngle = lroundf(scaledAngle);
+    uint16_t index = roundedAngle & LOOKUP_INDEX_MASK;
 
-  if (index >= QUADRANT_SIZE) {
-    if (remainder) {
-      index = QUADRANT_SIZE_2_MINUS_1 - index;
-      remainder = LOOKUP_REMAINDER_SIZE - remainder;
-    } else {
+    // Isolate the angle in the first quandrant
+    int negativeCosine = 0;
+    if (index >= QUADRANT_SIZE_2) {
+      index -= QUADRANT_SIZE_2;
+      negativeSine ^= 1;
+      negativeCosine ^= 1;
+    }
+
+    if (index >= QUADRANT_SIZE) {
       index = QUADRANT_SIZE_2 - index;
+      negativeCosine ^= 1;
     }
+
+    fast_sincos_real sineValue =
+        scaleValueToRadians((fast_sincos_real)ACCESS_TABLE(index));
+    fast_sincos_real cosineValue = scaleValueToRadians(
+        (fast_sincos_real)ACCESS_TABLE(QUADRANT_SIZE - index));
+    *sine = negativeSine ? -sineValue : sineValue;
+    *cosine = negativeCosine ? -cosineValue : cosineValue;
+    return;
   }
 
-  uint16_t currentValue = ACCESS_TABLE(index);
-  if (remainder) {
-    // extended for the multiplication that is about to occur and keep the
-    // precision
-    uint32_t difference = ACCESS_TABLE(index + 1) - currentValue;
-    uint32_t temporaryResult = difference * remainder;
-    currentValue +=
-        ((uint16_t*)&temporaryResult)[1]; // Equivalent of dividing by
-                                          // LOOKUP_REMAINDER_BITS
+  // Isolate the angle in the first quandrant
+  int negativeSine = 0;
+  int negativeCosine = 0;
+  fast_sincos_real clampedAngle = angleRadians;
+  if (clampedAngle < 0) {
+    negativeSine = 1;
+    clampedAngle = -clampedAngle;
   }
 
+  clampedAngle = fmod(clampedAngle, PI_TIMES_2);
+
+  if (clampedAngle >= M_PI) {
+    clampedAngle -= M_PI;
+    negativeSine ^= 1;
+    negativeCosine ^= 1;
+  }
+
+  if (clampedAngle >= M_PI_2) {
+    clampedAngle = M_PI - clampedAngle;
+    negativeCosine ^= 1;
+  }
+
+  // Both approximations use the same range
+  fast_sincos_real sineValue;
+  fast_sincos_real cosineValue;
+  if (clampedAngle < M_PI_4) {
+    sineValue = fastSinChebyshev(clampedAngle, degree);
+    cosineValue = fastCosChebyshev(clampedAngle, degree);
+  } else {
+    sineValue = fastCosChebyshev(M_PI_2 - clampedAngle, degree);
+    cosineValue = fastSinChebyshev(M_PI_2 - clampedAngle, degree);
+  }
+
+  *sine = negativeSine ? -sineValue : sineValue;
+  *cosine = negativeCosine ? -cosineValue : cosineValue;
+}
+
+/**
+ * @brief Fast sine approximation in fixed point.
+ * In this fixed point representation, the original range
+ * 0 to 2PI is now 0 to 2^25.
+ * @param fixedAngle The angle in fixed point.
+ * @return A sine approximation of the angle.
+ */
+fast_sincos_real fastFixedSin(const uint32_t fixedAngle) {
+  int negative;
+  const lookup_value value = lookupFixedSin(fixedAngle, &negative);
   fast_sincos_real returnedValue =
-      scaleValueToRadians((fast_sincos_real)currentValue);
-  return negativeFactor ? -returnedValue : returnedValue;
+      scaleValueToRadians((fast_sincos_real)value);
+  return negative ? -returnedValue : returnedValue;
 }
 
 /**
@@ -224,48 +347,527 @@ fast_sincos_real fastFixedSin(const uint32_t fixedAngle) {
  * @return A sine approximation of the angle.
  */
 fast_sincos_real fastFixedCos(const uint32_t fixedAngle) {
+  int negative;
+  const lookup_value value = lookupFixedCos(fixedAngle, &negative);
+  fast_sincos_real returnedValue =
+      scaleValueToRadians((fast_sincos_real)value);
+  return negative ? -returnedValue : returnedValue;
+}
 
-  const uint16_t indexMask = 0x1FF; // 9 last bits
+/**
+ * @brief Fast sine and cosine approximation in fixed point, sharing the
+ * lookup table index. The results are the same as fastFixedSin and
+ * fastFixedCos.
+ * In this fixed point representation, the original range
+ * 0 to 2PI is now 0 to 2^25.
+ * @param fixedAngle The angle in fixed point.
+ * @param sine Receives the sine approximation of the angle.
+ * @param cosine Receives the cosine approximation of the angle.
+ */
+void fastFixedSinCos(const uint32_t fixedAngle, fast_sincos_real* sine,
+                     fast_sincos_real* cosine) {
+  uint16_t remainder = fixedRemainder(fixedAngle);
+  uint16_t index = (fixedAngle >> FIXED_REMAINDER_BITS) & LOOKUP_INDEX_MASK;
+  lookupSinCosInterpolate(index, remainder, 0, sine, cosine);
+}
 
-  uint16_t remainder = fixedAngle;                            // 16 lsb bits
-  uint16_t index = (((uint16_t*)&fixedAngle)[1]) & indexMask; // 9 last bits
+/**
+ * @brief Fast sine approximation in fixed point, returning a Q1.15 number.
+ * Only integer operations are used, from the angle to the result, so that
+ * fixed point code does not go through floating point numbers.
+ * In this fixed point representation, the original range
+ * 0 to 2PI is now 0 to 2^25.
+ * @param fixedAngle The angle in fixed point.
+ * @return A sine approximation of the angle, times 2^15, in [-32767, 32767].
+ */
+int16_t fastFixedSinQ15(const uint32_t fixedAngle) {
+  int negative;
+  const lookup_value value = lookupFixedSin(fixedAngle, &negative);
+  return valueToQ15(value, negative);
+}
 
-  int negativeFactor = 0;
-  if (index >= QUADRANT_SIZE_2) {
-    index -= QUADRANT_SIZE_2;
-    negativeFactor ^= 1;
+/**
+ * @brief Fast cosine approximation in fixed point, returning a Q1.15 number.
+ * See fastFixedSinQ15.
+ * @param fixedAngle The angle in fixed point.
+ * @return A cosine approximation of the angle, times 2^15, in
+ * [-32767, 32767].
+ */
+int16_t fastFixedCosQ15(const uint32_t fixedAngle) {
+  int negative;
+  const lookup_value value = lookupFixedCos(fixedAngle, &negative);
+  return valueToQ15(value, negative);
+}
+
+/**
+ * @brief Fast sine and cosine approximation in fixed point, returning Q1.15
+ * numbers. The results are the same as fastFixedSinQ15 and fastFixedCosQ15.
+ * @param fixedAngle The angle in fixed point.
+ * @param sine Receives the sine approximation of the angle, times 2^15.
+ * @param cosine Receives the cosine approximation of the angle, times 2^15.
+ */
+void fastFixedSinCosQ15(const uint32_t fixedAngle, int16_t* sine,
+                        int16_t* cosine) {
+  lookup_value sineValue;
+  lookup_value cosineValue;
+  int negativeSine = 0;
+  int negativeCosine;
+  lookupSinCosValues((fixedAngle >> FIXED_REMAINDER_BITS) & LOOKUP_INDEX_MASK,
+                     fixedRemainder(fixedAngle), &sineValue, &cosineValue,
+                     &negativeSine, &negativeCosine);
+  *sine = valueToQ15(sineValue, negativeSine);
+  *cosine = valueToQ15(cosineValue, negativeCosine);
+}
+
+/**
+ * @brief Fast sine approximation in fixed point, returning a Q1.31 number.
+ * Only integer operations are used, as with fastFixedSinQ15. The accuracy is
+ * the one of the lookup table, FAST_SINCOS_TABLE_BITS being the number of
+ * significant bits at best.
+ * @param fixedAngle The angle in fixed point.
+ * @return A sine approximation of the angle, times 2^31, in
+ * [-2^31 + 1, 2^31 - 1].
+ */
+int32_t fastFixedSinQ31(const uint32_t fixedAngle) {
+  int negative;
+  const lookup_value value = lookupFixedSin(fixedAngle, &negative);
+  return valueToQ31(value, negative);
+}
+
+/**
+ * @brief Fast cosine approximation in fixed point, returning a Q1.31 number.
+ * See fastFixedSinQ31.
+ * @param fixedAngle The angle in fixed point.
+ * @return A cosine approximation of the angle, times 2^31, in
+ * [-2^31 + 1, 2^31 - 1].
+ */
+int32_t fastFixedCosQ31(const uint32_t fixedAngle) {
+  int negative;
+  const lookup_value value = lookupFixedCos(fixedAngle, &negative);
+  return valueToQ31(value, negative);
+}
+
+/**
+ * @brief Fast sine and cosine approximation in fixed point, returning Q1.31
+ * numbers. The results are the same as fastFixedSinQ31 and fastFixedCosQ31.
+ * @param fixedAngle The angle in fixed point.
+ * @param sine Receives the sine approximation of the angle, times 2^31.
+ * @param cosine Receives the cosine approximation of the angle, times 2^31.
+ */
+void fastFixedSinCosQ31(const uint32_t fixedAngle, int32_t* sine,
+                        int32_t* cosine) {
+  lookup_value sineValue;
+  lookup_value cosineValue;
+  int negativeSine = 0;
+  int negativeCosine;
+  lookupSinCosValues((fixedAngle >> FIXED_REMAINDER_BITS) & LOOKUP_INDEX_MASK,
+                     fixedRemainder(fixedAngle), &sineValue, &cosineValue,
+                     &negativeSine, &negativeCosine);
+  *sine = valueToQ31(sineValue, negativeSine);
+  *cosine = valueToQ31(cosineValue, negativeCosine);
+}
+
+/**
+ * @brief Fast sine computation over an array of angles.
+ * The results are the same as fastSin, within the accuracy of the
+ * approximation. With degrees of 3, 5 and 7, the quadrant of each angle is
+ * found without branches and the Chebyshev approximations are evaluated on
+ * whole vectors of angles. The angles should be finite and smaller than about
+ * 10^6 in magnitude. Invalid degrees will default to 7.
+ * @param length The number of angles
+ * @param angles The angles, in radians
+ * @param sines Array of length elements receiving the sines. Can be the same
+ * array as angles
+ * @param degree The degree of the approximation.
+ * Higher is more accurate, but slower.
+ */
+void fastSinArray(const unsigned length, const fast_sincos_real* angles,
+                  fast_sincos_real* sines, const int degree) {
+  sinCosArray(length, angles, sines, NULL, degree);
+}
+
+/**
+ * @brief Fast cosine computation over an array of angles.
+ * The results are the same as fastCos, within the accuracy of the
+ * approximation. See fastSinArray for the valid range of the angles.
+ * @param length The number of angles
+ * @param angles The angles, in radians
+ * @param cosines Array of length elements receiving the cosines. Can be the
+ * same array as angles
+ * @param degree The degree of the approximation.
+ * Higher is more accurate, but slower.
+ */
+void fastCosArray(const unsigned length, const fast_sincos_real* angles,
+                  fast_sincos_real* cosines, const int degree) {
+  sinCosArray(length, angles, NULL, cosines, degree);
+}
+
+/**
+ * @brief Fast sine and cosine computation over an array of angles.
+ * Both approximations share the range reduction, which makes this function
+ * faster than calling fastSinArray and fastCosArray. See fastSinArray for the
+ * valid range of the angles.
+ * @param length The number of angles
+ * @param angles The angles, in radians
+ * @param sines Array of length elements receiving the sines
+ * @param cosines Array of length elements receiving the cosines
+ * @param degree The degree of the approximation.
+ * Higher is more accurate, but slower.
+ */
+void fastSinCosArray(const unsigned length, const fast_sincos_real* angles,
+                     fast_sincos_real* sines, fast_sincos_real* cosines,
+                     const int degree) {
+  sinCosArray(length, angles, sines, cosines, degree);
+}
+
+/**
+ * Computes the sines and the cosines of an array of angles with the Chebyshev
+ * approximations. The quadrant folding has no branches, so that the compiler
+ * can vectorize the loop.
+ * @param length The number of angles
+ * @param angles The angles, in radians
+ * @param sines Array receiving the sines. Can be NULL
+ * @param cosines Array receiving the cosines. Can be NULL
+ * @param degree The degree of the Chebyshev approximation, 3, 5 or 7
+ */
+static inline void sinCosArrayPortable(const unsigned length,
+                                       const fast_sincos_real* angles,
+                                       fast_sincos_real* sines,
+                                       fast_sincos_real* cosines,
+                                       const int degree) {
+  for (unsigned i = 0; i < length; ++i) {
+
+    // angle = quadrant * PI / 2 + reduced, with reduced in [-PI / 4, PI / 4]
+    const fast_sincos_real angle = angles[i];
+    const fast_sincos_real quadrant =
+        (angle * TWO_OVER_PI + ROUNDING_CONSTANT) - ROUNDING_CONSTANT;
+    const fast_sincos_real reduced = ((angle - quadrant * PI_2_HIGH) -
+                                      quadrant * PI_2_MID) -
+                                     quadrant * PI_2_LOW;
+    const int32_t bits = (int32_t)quadrant;
+
+    const fast_sincos_real sine = fastSinChebyshev(reduced, degree);
+    const fast_sincos_real cosine = fastCosChebyshev(reduced, degree);
+
+    // Each quadrant swaps the sine and the cosine and negates the new sine
+    if (sines != NULL) {
+      const fast_sincos_real value = (bits & 1) ? cosine : sine;
+      sines[i] = (bits & 2) ? -value : value;
+    }
+    if (cosines != NULL) {
+      const fast_sincos_real value = (bits & 1) ? sine : cosine;
+      cosines[i] = ((bits + 1) & 2) ? -value : value;
+    }
   }
+}
 
-  if (index >= QUADRANT_SIZE) {
-    negativeFactor ^= 1;
-    if (remainder) {
-      index = QUADRANT_SIZE_2_MINUS_1 - index;
-      remainder = -remainder;
-    } else {
-      index = QUADRANT_SIZE_2 - index;
+/**
+ * Computes the sines and the cosines of an array of angles. The lookup table
+ * degrees go through the scalar functions, the others through the vector
+ * extensions, if any, then through the portable loop.
+ * @param length The number of angles
+ * @param angles The angles, in radians
+ * @param sines Array receiving the sines. Can be NULL
+ * @param cosines Array receiving the cosines. Can be NULL
+ * @param degree The degree of the approximation
+ */
+static void sinCosArray(const unsigned length, const fast_sincos_real* angles,
+                        fast_sincos_real* sines, fast_sincos_real* cosines,
+                        const int degree) {
+
+  // The lookup tables do not vectorize. The angle is read before writing the
+  // results, as the arrays can be the same.
+  if (degree == 1 || degree == 2) {
+    for (unsigned i = 0; i < length; ++i) {
+      const fast_sincos_real angle = angles[i];
+      if (sines != NULL && cosines != NULL) {
+        fastSinCos(angle, degree, sines + i, cosines + i);
+        continue;
+      }
+      if (sines != NULL) {
+        sines[i] = fastSin(angle, degree);
+      }
+      if (cosines != NULL) {
+        cosines[i] = fastCos(angle, degree);
+      }
     }
+    return;
   }
 
-  uint16_t currentValue;
-  if (remainder > 0) {
-    currentValue = ACCESS_TABLE(QUADRANT_SIZE_MINUS_1 - index);
-    remainder = LOOKUP_REMAINDER_SIZE - remainder;
-    // extended for the multiplication that is about to occur and keep the
-    // precision
-    uint32_t difference = ACCESS_TABLE(QUADRANT_SIZE - index) - currentValue;
-    uint32_t temporaryResult = difference * remainder;
-    currentValue +=
-        ((uint16_t*)&temporaryResult)[1]; // Equivalent of dividing by
-                                          // LOOKUP_REMAINDER_BITS
-  } else {
-    currentValue = ACCESS_TABLE(QUADRANT_SIZE - index);
+  unsigned done = 0;
+#ifdef FAST_SINCOS_VECTOR
+  if (sizeof(fast_sincos_real) == sizeof(double)) {
+    done = sinCosArrayVector(length, (const double*)angles, (double*)sines,
+                             (double*)cosines, degree);
   }
+#endif
 
-  fast_sincos_real returnedValue =
-      scaleValueToRadians((fast_sincos_real)currentValue);
-  return negativeFactor ? -returnedValue : returnedValue;
+  // Remaining angles. The degree is a constant in each call, so that the
+  // approximations are inlined without their switch.
+  angles += done;
+  sines = sines == NULL ? NULL : sines + done;
+  cosines = cosines == NULL ? NULL : cosines + done;
+  switch (degree) {
+  case 3:
+    sinCosArrayPortable(length - done, angles, sines, cosines, 3);
+    break;
+  case 5:
+    sinCosArrayPortable(length - done, angles, sines, cosines, 5);
+    break;
+  default:
+    sinCosArrayPortable(length - done, angles, sines, cosines, 7);
+    break;
+  }
 }
 
+#ifdef FAST_SINCOS_VECTOR
+
+// Coefficients of fastSinChebyshev and fastCosChebyshev, from the highest
+// power of the squared angle
+static const double sinCoefficients3[] = {-1.6034401672287444e-1,
+                                          9.9903142291243359e-1};
+static const double cosCoefficients3[] = {
+    4.0398535966168857e-2, -4.9970814035466399e-1, 9.9999003495519596e-1};
+static const double sinCoefficients5[] = {
+    8.1215579245991201e-3, -1.6660161988228715e-1, 9.9999499756161918e-1};
+static const double cosCoefficients5[] = {
+    -1.3585908510113299e-3, 4.1655026884251524e-2, -4.9999856695848848e-1,
+    9.9999997242332292e-1};
+static const double sinCoefficients7[] = {
+    -1.9462116998273101e-4, 8.3315846064878458e-3, -1.6666636754299513e-1,
+    9.9999998617934201e-1};
+static const double cosCoefficients7[] = {
+    2.4379929375956876e-5, -1.3886619210252882e-3, 4.1666616739207635e-2,
+    -4.9999999615433476e-1, 9.9999999995260044e-1};
+
+/**
+ * Selects the coefficients of the Chebyshev approximations of a degree.
+ * @param degree The degree of the approximation. Invalid degrees default to 7
+ * @param sinCoefficients Receives the sine coefficients
+ * @param cosCoefficients Receives the cosine coefficients, which are one more
+ * than the sine coefficients
+ * @return The number of sine coefficients
+ */
+static unsigned selectCoefficients(const int degree,
+                                   const double** sinCoefficients,
+                                   const double** cosCoefficients) {
+  switch (degree) {
+  case 3:
+    *sinCoefficients = sinCoefficients3;
+    *cosCoefficients = cosCoefficients3;
+    return 2;
+  case 5:
+    *sinCoefficients = sinCoefficients5;
+    *cosCoefficients = cosCoefficients5;
+    return 3;
+  default:
+    *sinCoefficients = sinCoefficients7;
+    *cosCoefficients = cosCoefficients7;
+    return 4;
+  }
+}
+
+#endif
+
+#if defined(FAST_SINCOS_AVX2)
+
+/**
+ * Computes the sines and the cosines of groups of 4 angles with AVX2.
+ * @return The number of angles computed, a multiple of 4
+ */
+static unsigned sinCosArrayVector(const unsigned length, const double* angles,
+                                  double* sines, double* cosines,
+                                  const int degree) {
+  const double* sinCoefficients;
+  const double* cosCoefficients;
+  const unsigned nbCoefficients =
+      selectCoefficients(degree, &sinCoefficients, &cosCoefficients);
+
+  const __m256d twoOverPi = _mm256_set1_pd(TWO_OVER_PI);
+  const __m256d rounding = _mm256_set1_pd(ROUNDING_CONSTANT);
+  const __m256d piHigh = _mm256_set1_pd(PI_2_HIGH);
+  const __m256d piMid = _mm256_set1_pd(PI_2_MID);
+  const __m256d piLow = _mm256_set1_pd(PI_2_LOW);
+  const __m256i one = _mm256_set1_epi64x(1);
+  const __m256i signBit = _mm256_castpd_si256(_mm256_set1_pd(-0.0));
+
+  unsigned i = 0;
+  for (; i + 4 <= length; i += 4) {
+    const __m256d angle = _mm256_loadu_pd(angles + i);
+    const __m256d shifted =
+        _mm256_add_pd(_mm256_mul_pd(angle, twoOverPi), rounding);
+    const __m256d quadrant = _mm256_sub_pd(shifted, rounding);
+    __m256d reduced = _mm256_sub_pd(angle, _mm256_mul_pd(quadrant, piHigh));
+    reduced = _mm256_sub_pd(reduced, _mm256_mul_pd(quadrant, piMid));
+    reduced = _mm256_sub_pd(reduced, _mm256_mul_pd(quadrant, piLow));
+    const __m256d squared = _mm256_mul_pd(reduced, reduced);
+
+    __m256d sine = _mm256_set1_pd(sinCoefficients[0]);
+    __m256d cosine = _mm256_set1_pd(cosCoefficients[0]);
+    for (unsigned k = 1; k < nbCoefficients; ++k) {
+      sine = _mm256_add_pd(_mm256_mul_pd(sine, squared),
+                           _mm256_set1_pd(sinCoefficients[k]));
+      cosine = _mm256_add_pd(_mm256_mul_pd(cosine, squared),
+                             _mm256_set1_pd(cosCoefficients[k]));
+    }
+    sine = _mm256_mul_pd(sine, reduced);
+    cosine = _mm256_add_pd(_mm256_mul_pd(cosine, squared),
+                           _mm256_set1_pd(cosCoefficients[nbCoefficients]));
+
+    // The low bits of the shifted angle are the bits of the quadrant. Bit 0
+    // swaps the sine and the cosine, bit 1 gives the sign.
+    const __m256i bits = _mm256_castpd_si256(shifted);
+    const __m256d swap = _mm256_castsi256_pd(_mm256_slli_epi64(bits, 63));
+    if (sines != NULL) {
+      const __m256d sign = _mm256_castsi256_pd(
+          _mm256_and_si256(_mm256_slli_epi64(bits, 62), signBit));
+      const __m256d value = _mm256_blendv_pd(sine, cosine, swap);
+      _mm256_storeu_pd(sines + i, _mm256_xor_pd(value, sign));
+    }
+    if (cosines != NULL) {
+      const __m256d sign = _mm256_castsi256_pd(_mm256_and_si256(
+          _mm256_slli_epi64(_mm256_add_epi64(bits, one), 62), signBit));
+      const __m256d value = _mm256_blendv_pd(cosine, sine, swap);
+      _mm256_storeu_pd(cosines + i, _mm256_xor_pd(value, sign));
+    }
+  }
+  return i;
+}
+
+#elif defined(FAST_SINCOS_SSE2)
+
+/**
+ * Computes the sines and the cosines of pairs of angles with SSE2.
+ * @return The number of angles computed, a multiple of 2
+ */
+static unsigned sinCosArrayVector(const unsigned length, const double* angles,
+                                  double* sines, double* cosines,
+                                  const int degree) {
+  const double* sinCoefficients;
+  const double* cosCoefficients;
+  const unsigned nbCoefficients =
+      selectCoefficients(degree, &sinCoefficients, &cosCoefficients);
+
+  const __m128d twoOverPi = _mm_set1_pd(TWO_OVER_PI);
+  const __m128d rounding = _mm_set1_pd(ROUNDING_CONSTANT);
+  const __m128d piHigh = _mm_set1_pd(PI_2_HIGH);
+  const __m128d piMid = _mm_set1_pd(PI_2_MID);
+  const __m128d piLow = _mm_set1_pd(PI_2_LOW);
+  const __m128i one = _mm_set1_epi64x(1);
+  const __m128i signBit = _mm_castpd_si128(_mm_set1_pd(-0.0));
+
+  unsigned i = 0;
+  for (; i + 2 <= length; i += 2) {
+    const __m128d angle = _mm_loadu_pd(angles + i);
+    const __m128d shifted = _mm_add_pd(_mm_mul_pd(angle, twoOverPi), rounding);
+    const __m128d quadrant = _mm_sub_pd(shifted, rounding);
+    __m128d reduced = _mm_sub_pd(angle, _mm_mul_pd(quadrant, piHigh));
+    reduced = _mm_sub_pd(reduced, _mm_mul_pd(quadrant, piMid));
+    reduced = _mm_sub_pd(reduced, _mm_mul_pd(quadrant, piLow));
+    const __m128d squared = _mm_mul_pd(reduced, reduced);
+
+    __m128d sine = _mm_set1_pd(sinCoefficients[0]);
+    __m128d cosine = _mm_set1_pd(cosCoefficients[0]);
+    for (unsigned k = 1; k < nbCoefficients; ++k) {
+      sine = _mm_add_pd(_mm_mul_pd(sine, squared),
+                        _mm_set1_pd(sinCoefficients[k]));
+      cosine = _mm_add_pd(_mm_mul_pd(cosine, squared),
+                          _mm_set1_pd(cosCoefficients[k]));
+    }
+    sine = _mm_mul_pd(sine, reduced);
+    cosine = _mm_add_pd(_mm_mul_pd(cosine, squared),
+                        _mm_set1_pd(cosCoefficients[nbCoefficients]));
+
+    // The low bits of the shifted angle are the bits of the quadrant. Bit 0
+    // swaps the sine and the cosine, bit 1 gives the sign. 0 - (bits & 1)
+    // spreads bit 0 to the whole lane.
+    const __m128i bits = _mm_castpd_si128(shifted);
+    const __m128d swap = _mm_castsi128_pd(
+        _mm_sub_epi64(_mm_setzero_si128(), _mm_and_si128(bits, one)));
+    if (sines != NULL) {
+      const __m128d sign =
+          _mm_castsi128_pd(_mm_and_si128(_mm_slli_epi64(bits, 62), signBit));
+      const __m128d value =
+          _mm_or_pd(_mm_and_pd(swap, cosine), _mm_andnot_pd(swap, sine));
+      _mm_storeu_pd(sines + i, _mm_xor_pd(value, sign));
+    }
+    if (cosines != NULL) {
+      const __m128d sign = _mm_castsi128_pd(_mm_and_si128(
+          _mm_slli_epi64(_mm_add_epi64(bits, one), 62), signBit));
+      const __m128d value =
+          _mm_or_pd(_mm_and_pd(swap, sine), _mm_andnot_pd(swap, cosine));
+      _mm_storeu_pd(cosines + i, _mm_xor_pd(value, sign));
+    }
+  }
+  return i;
+}
+
+#elif defined(FAST_SINCOS_NEON)
+
+/**
+ * Computes the sines and the cosines of pairs of angles with NEON.
+ * @return The number of angles computed, a multiple of 2
+ */
+static unsigned sinCosArrayVector(const unsigned length, const double* angles,
+                                  double* sines, double* cosines,
+                                  const int degree) {
+  const double* sinCoefficients;
+  const double* cosCoefficients;
+  const unsigned nbCoefficients =
+      selectCoefficients(degree, &sinCoefficients, &cosCoefficients);
+
+  const float64x2_t twoOverPi = vdupq_n_f64(TWO_OVER_PI);
+  const float64x2_t rounding = vdupq_n_f64(ROUNDING_CONSTANT);
+  const float64x2_t piHigh = vdupq_n_f64(PI_2_HIGH);
+  const float64x2_t piMid = vdupq_n_f64(PI_2_MID);
+  const float64x2_t piLow = vdupq_n_f64(PI_2_LOW);
+  const uint64x2_t one = vdupq_n_u64(1);
+  const uint64x2_t signBit = vdupq_n_u64(0x8000000000000000ull);
+
+  unsigned i = 0;
+  for (; i + 2 <= length; i += 2) {
+    const float64x2_t angle = vld1q_f64(angles + i);
+    const float64x2_t shifted =
+        vaddq_f64(vmulq_f64(angle, twoOverPi), rounding);
+    const float64x2_t quadrant = vsubq_f64(shifted, rounding);
+    float64x2_t reduced = vsubq_f64(angle, vmulq_f64(quadrant, piHigh));
+    reduced = vsubq_f64(reduced, vmulq_f64(quadrant, piMid));
+    reduced = vsubq_f64(reduced, vmulq_f64(quadrant, piLow));
+    const float64x2_t squared = vmulq_f64(reduced, reduced);
+
+    float64x2_t sine = vdupq_n_f64(sinCoefficients[0]);
+    float64x2_t cosine = vdupq_n_f64(cosCoefficients[0]);
+    for (unsigned k = 1; k < nbCoefficients; ++k) {
+      sine = vfmaq_f64(vdupq_n_f64(sinCoefficients[k]), sine, squared);
+      cosine = vfmaq_f64(vdupq_n_f64(cosCoefficients[k]), cosine, squared);
+    }
+    sine = vmulq_f64(sine, reduced);
+    cosine = vfmaq_f64(vdupq_n_f64(cosCoefficients[nbCoefficients]), cosine,
+                       squared);
+
+    // The low bits of the shifted angle are the bits of the quadrant. Bit 0
+    // swaps the sine and the cosine, bit 1 gives the sign.
+    const uint64x2_t bits = vreinterpretq_u64_f64(shifted);
+    const uint64x2_t swap = vtstq_u64(bits, one);
+    if (sines != NULL) {
+      const uint64x2_t sign = vandq_u64(vshlq_n_u64(bits, 62), signBit);
+      const float64x2_t value = vbslq_f64(swap, cosine, sine);
+      vst1q_f64(sines + i, vreinterpretq_f64_u64(veorq_u64(
+                               vreinterpretq_u64_f64(value), sign)));
+    }
+    if (cosines != NULL) {
+      const uint64x2_t sign =
+          vandq_u64(vshlq_n_u64(vaddq_u64(bits, one), 62), signBit);
+      const float64x2_t value = vbslq_f64(swap, sine, cosine);
+      vst1q_f64(cosines + i, vreinterpretq_f64_u64(veorq_u64(
+                                 vreinterpretq_u64_f64(value), sign)));
+    }
+  }
+  return i;
+}
+
+#endif
+
 /**
  * The Chebyshev approximation is used to compute the sine of the angle.
  * Coefficients were obtained manually with the Remez algorithm.
@@ -390,13 +992,11 @@ lookupSinInterpolate(const fast_sincos_real angleRadians) {
 
   // extended for the multiplication that is about to occur and keep the
   // precision
-  uint16_t currentValue = ACCESS_TABLE(index);
+  lookup_value currentValue = ACCESS_TABLE(index);
   if (remainder > 0) {
-    uint32_t temporaryResult =
-        ((uint32_t)(ACCESS_TABLE(index + 1) - currentValue)) * remainder;
-    currentValue +=
-        ((uint16_t*)&temporaryResult)[1]; // Equivalent of dividing by
-                                          // LOOKUP_REMAINDER_BITS
+    lookup_product temporaryResult =
+        ((lookup_product)(ACCESS_TABLE(index + 1) - currentValue)) * remainder;
+    currentValue += temporaryResult >> LOOKUP_REMAINDER_BITS;
   }
 
   fast_sincos_real returnedValue =
@@ -443,17 +1043,15 @@ lookupCosInterpolate(const fast_sincos_real angleRadians) {
 
   // extended for the multiplication that is about to occur and keep the
   // precision
-  uint16_t currentValue;
+  lookup_value currentValue;
   if (remainder > 0) {
     currentValue = ACCESS_TABLE(QUADRANT_SIZE_MINUS_1 - index);
     remainder = LOOKUP_REMAINDER_SIZE - remainder;
 
-    uint32_t temporaryResult =
-        ((uint32_t)(ACCESS_TABLE(QUADRANT_SIZE - index) - currentValue)) *
+    lookup_product temporaryResult =
+        ((lookup_product)(ACCESS_TABLE(QUADRANT_SIZE - index) - currentValue)) *
         remainder;
-    currentValue +=
-        ((uint16_t*)&temporaryResult)[1]; // Equivalent of dividing by
-                                          // LOOKUP_REMAINDER_BITS
+    currentValue += temporaryResult >> LOOKUP_REMAINDER_BITS;
   } else {
     currentValue = ACCESS_TABLE(QUADRANT_SIZE - index);
   }
@@ -463,6 +1061,178 @@ lookupCosInterpolate(const fast_sincos_real angleRadians) {
   return negativeFactor ? -returnedValue : returnedValue;
 }
 
+/**
+ * @brief Fast sine and cosine computation with lookup table, using
+ * interpolation. Both values share the folding of the index in the first
+ * quadrant.
+ * @param index The index in the four quadrants, below QUADRANT_SIZE * 4
+ * @param remainder The fraction between index and index + 1, over
+ * LOOKUP_REMAINDER_SIZE
+ * @param negativeSine 1 if the sine must be negated, for a negative angle
+ * @param sine Receives the sine approximation of the angle.
+ * @param cosine Receives the cosine approximation of the angle.
+ */
+static void lookupSinCosInterpolate(uint16_t index, uint16_t remainder,
+                                    int negativeSine, fast_sincos_real* sine,
+                                    fast_sincos_real* cosine) {
+  lookup_value sineValue;
+  lookup_value cosineValue;
+  int negativeCosine;
+  lookupSinCosValues(index, remainder, &sineValue, &cosineValue,
+                     &negativeSine, &negativeCosine);
+
+  fast_sincos_real sineResult =
+      scaleValueToRadians((fast_sincos_real)sineValue);
+  fast_sincos_real cosineResult =
+      scaleValueToRadians((fast_sincos_real)cosineValue);
+  *sine = negativeSine ? -sineResult : sineResult;
+  *cosine = negativeCosine ? -cosineResult : cosineResult;
+}
+
+/**
+ * @brief Interpolated magnitudes of the sine and cosine in the lookup table.
+ * Both values share the folding of the index in the first quadrant.
+ * @param index The index in the four quadrants, below QUADRANT_SIZE * 4
+ * @param remainder The fraction between index and index + 1, over
+ * LOOKUP_REMAINDER_SIZE
+ * @param sineValue Receives the magnitude of the sine, over
+ * 2^FAST_SINCOS_TABLE_BITS
+ * @param cosineValue Receives the magnitude of the cosine
+ * @param negativeSine 1 if the sine must be negated, for a negative angle.
+ * Receives 1 if the sine is negative.
+ * @param negativeCosine Receives 1 if the cosine is negative.
+ */
+static void lookupSinCosValues(uint16_t index, uint16_t remainder,
+                               lookup_value* sineValue,
+                               lookup_value* cosineValue, int* negativeSine,
+                               int* negativeCosine) {
+
+  // Isolate the angle in the first quandrant
+  *negativeCosine = 0;
+  if (index >= QUADRANT_SIZE_2) {
+    index -= QUADRANT_SIZE_2;
+    *negativeSine ^= 1;
+    *negativeCosine ^= 1;
+  }
+
+  if (index >= QUADRANT_SIZE) {
+    *negativeCosine ^= 1;
+    if (remainder) {
+      index = QUADRANT_SIZE_2_MINUS_1 - index;
+      remainder = LOOKUP_REMAINDER_SIZE - remainder;
+    } else {
+      index = QUADRANT_SIZE_2 - index;
+    }
+  }
+
+  // The sine interpolates from index, the cosine from the mirrored index
+  *sineValue = ACCESS_TABLE(index);
+  if (remainder) {
+    // extended for the multiplication that is about to occur and keep the
+    // precision
+    lookup_product temporaryResult =
+        ((lookup_product)(ACCESS_TABLE(index + 1) - *sineValue)) * remainder;
+    *sineValue += temporaryResult >> LOOKUP_REMAINDER_BITS;
+
+    *cosineValue = ACCESS_TABLE(QUADRANT_SIZE_MINUS_1 - index);
+    temporaryResult =
+        ((lookup_product)(ACCESS_TABLE(QUADRANT_SIZE - index) - *cosineValue)) *
+        (uint16_t)(LOOKUP_REMAINDER_SIZE - remainder);
+    *cosineValue += temporaryResult >> LOOKUP_REMAINDER_BITS;
+  } else {
+    *cosineValue = ACCESS_TABLE(QUADRANT_SIZE - index);
+  }
+}
+
+/**
+ * @brief Interpolated magnitude of the sine of a fixed point angle, in the
+ * lookup table.
+ * @param fixedAngle The angle in fixed point.
+ * @param negative Receives 1 if the sine is negative, 0 otherwise.
+ * @return The magnitude of the sine, over 2^FAST_SINCOS_TABLE_BITS.
+ */
+static lookup_value lookupFixedSin(const uint32_t fixedAngle,
+                                   int* negative) {
+
+  uint16_t remainder = fixedRemainder(fixedAngle);
+  uint16_t index = (fixedAngle >> FIXED_REMAINDER_BITS) & LOOKUP_INDEX_MASK;
+
+  // Isolate the angle in the first quandrant
+  int negativeFactor = 0;
+  if (index >= QUADRANT_SIZE_2) {
+    index -= QUADRANT_SIZE_2;
+    negativeFactor = 1;
+  }
+
+  if (index >= QUADRANT_SIZE) {
+    if (remainder) {
+      index = QUADRANT_SIZE_2_MINUS_1 - index;
+      remainder = LOOKUP_REMAINDER_SIZE - remainder;
+    } else {
+      index = QUADRANT_SIZE_2 - index;
+    }
+  }
+
+  lookup_value currentValue = ACCESS_TABLE(index);
+  if (remainder) {
+    // extended for the multiplication that is about to occur and keep the
+    // precision
+    lookup_product difference = ACCESS_TABLE(index + 1) - currentValue;
+    lookup_product temporaryResult = difference * remainder;
+    currentValue += temporaryResult >> LOOKUP_REMAINDER_BITS;
+  }
+
+  *negative = negativeFactor;
+  return currentValue;
+}
+
+/**
+ * @brief Interpolated magnitude of the cosine of a fixed point angle, in the
+ * lookup table.
+ * @param fixedAngle The angle in fixed point.
+ * @param negative Receives 1 if the cosine is negative, 0 otherwise.
+ * @return The magnitude of the cosine, over 2^FAST_SINCOS_TABLE_BITS.
+ */
+static lookup_value lookupFixedCos(const uint32_t fixedAngle,
+                                   int* negative) {
+
+  uint16_t remainder = fixedRemainder(fixedAngle);
+  uint16_t index = (fixedAngle >> FIXED_REMAINDER_BITS) & LOOKUP_INDEX_MASK;
+
+  int negativeFactor = 0;
+  if (index >= QUADRANT_SIZE_2) {
+    index -= QUADRANT_SIZE_2;
+    negativeFactor ^= 1;
+  }
+
+  if (index >= QUADRANT_SIZE) {
+    negativeFactor ^= 1;
+    if (remainder) {
+      index = QUADRANT_SIZE_2_MINUS_1 - index;
+      remainder = -remainder;
+    } else {
+      index = QUADRANT_SIZE_2 - index;
+    }
+  }
+
+  lookup_value currentValue;
+  if (remainder > 0) {
+    currentValue = ACCESS_TABLE(QUADRANT_SIZE_MINUS_1 - index);
+    remainder = LOOKUP_REMAINDER_SIZE - remainder;
+    // extended for the multiplication that is about to occur and keep the
+    // precision
+    lookup_product difference =
+        ACCESS_TABLE(QUADRANT_SIZE - index) - currentValue;
+    lookup_product temporaryResult = difference * remainder;
+    currentValue += temporaryResult >> LOOKUP_REMAINDER_BITS;
+  } else {
+    currentValue = ACCESS_TABLE(QUADRANT_SIZE - index);
+  }
+
+  *negative = negativeFactor;
+  return currentValue;
+}
+
 /**
  * @brief Fast sine computation with lookup table only
  * @param angleRadians The angle, in radians.
@@ -538,5 +1308,69 @@ static fast_sincos_real lookupCos(const fast_sincos_real angleRadians) {
  */
 static inline fast_sincos_real
 scaleValueToRadians(const fast_sincos_real value) {
+#if FAST_SINCOS_TABLE_BITS == 32
+  // A float cannot hold the 32 bits of the elements
+  return ldexp(value, LOOKUP_ELEMENTS_BITS_NEGATIVE);
+#else
   return ldexpf(value, LOOKUP_ELEMENTS_BITS_NEGATIVE);
+#endif
+}
+
+/**
+ * @brief Converts a value obtained from a lookup table to a Q1.15 number,
+ * rounding to the nearest. The magnitude saturates at 2^15 - 1, as sin(pi / 2)
+ * would overflow.
+ * @param value The value to convert, over 2^FAST_SINCOS_TABLE_BITS.
+ * @param negative 1 if the result must be negated.
+ * @return The signed Q1.15 value.
+ */
+static inline int16_t valueToQ15(const lookup_value value, const int negative) {
+#if FAST_SINCOS_TABLE_BITS == 8
+  const uint32_t magnitude = (uint32_t)value << 7;
+#else
+  const lookup_product half = (lookup_product)1
+                              << (FAST_SINCOS_TABLE_BITS - 16);
+  uint32_t magnitude =
+      (uint32_t)((value + half) >> (FAST_SINCOS_TABLE_BITS - 15));
+  if (magnitude > INT16_MAX) {
+    magnitude = INT16_MAX;
+  }
+#endif
+  return negative ? -(int16_t)magnitude : (int16_t)magnitude;
+}
+
+/**
+ * @brief Converts a value obtained from a lookup table to a Q1.31 number. The
+ * magnitude saturates at 2^31 - 1.
+ * @param value The value to convert, over 2^FAST_SINCOS_TABLE_BITS.
+ * @param negative 1 if the result must be negated.
+ * @return The signed Q1.31 value.
+ */
+static inline int32_t valueToQ31(const lookup_value value, const int negative) {
+#if FAST_SINCOS_TABLE_BITS == 32
+  uint32_t magnitude = (uint32_t)(((lookup_product)value + 1) >> 1);
+  if (magnitude > INT32_MAX) {
+    magnitude = INT32_MAX;
+  }
+#else
+  const uint32_t magnitude = (uint32_t)value << (31 - FAST_SINCOS_TABLE_BITS);
+#endif
+  return negative ? -(int32_t)magnitude : (int32_t)magnitude;
+}
+
+/**
+ * @brief Extracts the interpolation remainder of a fixed point angle, the
+ * FIXED_REMAINDER_BITS below the lookup table index, scaled to
+ * LOOKUP_REMAINDER_BITS bits.
+ * @param fixedAngle The angle in fixed point.
+ * @return The remainder, over LOOKUP_REMAINDER_SIZE.
+ */
+static inline uint16_t fixedRemainder(const uint32_t fixedAngle) {
+  const uint32_t remainder =
+      fixedAngle & (((uint32_t)1 << FIXED_REMAINDER_BITS) - 1);
+#if FIXED_REMAINDER_BITS >= LOOKUP_REMAINDER_BITS
+  return remainder >> (FIXED_REMAINDER_BITS - LOOKUP_REMAINDER_BITS);
+#else
+  return remainder << (LOOKUP_REMAINDER_BITS - FIXED_REMAINDER_BITS);
+#endif
 }
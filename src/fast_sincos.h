@@ -7,6 +7,18 @@
 #define fast_sincos_real double
 #endif
 
+// Size of a quadrant of the sine lookup table, a power of 2 from 64 to 4096.
+// Larger tables are more accurate for degrees 1 and 2 and the fixed point
+// functions, but take more memory.
+#ifndef FAST_SINCOS_QUADRANT_SIZE
+#define FAST_SINCOS_QUADRANT_SIZE 128
+#endif
+
+// Number of bits of the elements of the sine lookup table: 8, 16 or 32
+#ifndef FAST_SINCOS_TABLE_BITS
+#define FAST_SINCOS_TABLE_BITS 16
+#endif
+
 /**
  * The scaling factor to use the lookup table.
  * The scaling factor should be adapted to the lookup table and the incoming
@@ -21,25 +33,53 @@
  * If the input is expected to be in radians, then the scaling factor would
  * be "128 / (2 * pi)"
  */
-#define LOOKUP_SCALE_FACTOR 81.4873308630504119136684 // 128 * 4 / (2 * pi)
+#define LOOKUP_SCALE_FACTOR (QUADRANT_SIZE * 4 / 6.28318530717958647692)
 
 // Lookup sine table constants
-#define QUADRANT_SIZE 128 // The size of a quadrant.
+#define QUADRANT_SIZE FAST_SINCOS_QUADRANT_SIZE // The size of a quadrant.
 #define QUADRANT_SIZE_MINUS_1 (QUADRANT_SIZE - 1)
 #define QUADRANT_SIZE_2 (QUADRANT_SIZE * 2)
 #define QUADRANT_SIZE_2_MINUS_1 (QUADRANT_SIZE_2 - 1)
 #define LOOKUP_INDEX_MASK                                                      \
-  511 // QUADRANT_SIZE * 4 - 1. Used for a modulus of the calculated index
+  (QUADRANT_SIZE * 4 - 1) // Used for a modulus of the calculated index
 #define LOOKUP_REMAINDER_SIZE                                                  \
   65536 // Max size + 1 of the remainder used for interpolation.
 #define LOOKUP_REMAINDER_BITS                                                  \
   16 // The number of bits allocated for the remainder
-#define LOOKUP_ELEMENTS_BITS_NEGATIVE                                          \
-  -16 // Number of bits allocated for each element in the lookup table, times -1
+// Number of bits allocated for each element in the lookup table, times -1
+#define LOOKUP_ELEMENTS_BITS_NEGATIVE (-FAST_SINCOS_TABLE_BITS)
+
+// log2(QUADRANT_SIZE)
+#if QUADRANT_SIZE == 64
+#define QUADRANT_BITS 6
+#elif QUADRANT_SIZE == 128
+#define QUADRANT_BITS 7
+#elif QUADRANT_SIZE == 256
+#define QUADRANT_BITS 8
+#elif QUADRANT_SIZE == 512
+#define QUADRANT_BITS 9
+#elif QUADRANT_SIZE == 1024
+#define QUADRANT_BITS 10
+#elif QUADRANT_SIZE == 2048
+#define QUADRANT_BITS 11
+#elif QUADRANT_SIZE == 4096
+#define QUADRANT_BITS 12
+#else
+#error "FAST_SINCOS_QUADRANT_SIZE must be a power of 2 from 64 to 4096"
+#endif
+
+#if FAST_SINCOS_TABLE_BITS != 8 && FAST_SINCOS_TABLE_BITS != 16 &&            \
+    FAST_SINCOS_TABLE_BITS != 32
+#error "FAST_SINCOS_TABLE_BITS must be 8, 16 or 32"
+#endif
 
 #define FIXED_PI 16777216   // 2^24
 #define FIXED_2_PI 33554432 // 2^25
 
+// Number of bits of a fixed point angle below the lookup table index. The
+// index takes the QUADRANT_BITS + 2 bits above, out of 25.
+#define FIXED_REMAINDER_BITS (23 - QUADRANT_BITS)
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -48,6 +88,28 @@ fast_sincos_real fastSin(const fast_sincos_real angleRadians, const int degree);
 fast_sincos_real fastCos(const fast_sincos_real angleRadians, const int degree);
 fast_sincos_real fastFixedSin(const uint32_t fixedAngle);
 fast_sincos_real fastFixedCos(const uint32_t fixedAngle);
+void fastSinCos(const fast_sincos_real angleRadians, const int degree,
+                fast_sincos_real* sine, fast_sincos_real* cosine);
+void fastFixedSinCos(const uint32_t fixedAngle, fast_sincos_real* sine,
+                     fast_sincos_real* cosine);
+
+// Fixed point angles to Q1.15 and Q1.31 results, with integer operations only
+int16_t fastFixedSinQ15(const uint32_t fixedAngle);
+int16_t fastFixedCosQ15(const uint32_t fixedAngle);
+void fastFixedSinCosQ15(const uint32_t fixedAngle, int16_t* sine,
+                        int16_t* cosine);
+int32_t fastFixedSinQ31(const uint32_t fixedAngle);
+int32_t fastFixedCosQ31(const uint32_t fixedAngle);
+void fastFixedSinCosQ31(const uint32_t fixedAngle, int32_t* sine,
+                        int32_t* cosine);
+
+void fastSinArray(const unsigned length, const fast_sincos_real* angles,
+                  fast_sincos_real* sines, const int degree);
+void fastCosArray(const unsigned length, const fast_sincos_real* angles,
+                  fast_sincos_real* cosines, const int degree);
+void fastSinCosArray(const unsigned length, const fast_sincos_real* angles,
+                     fast_sincos_real* sines, fast_sincos_real* cosines,
+                     const int degree);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,2801 @@
+// Generated by tools/generate_sine_tables.py. Do not edit.
+#ifndef FAST_SINCOS_TABLE_H
+#define FAST_SINCOS_TABLE_H
+
+// The first quadrant of the sine, from 0 to pi / 2, in QUADRANT_SIZE + 1
+// elements of FAST_SINCOS_TABLE_BITS bits. The element i is
+// sin(i * pi / (2 * QUADRANT_SIZE)) * 2^FAST_SINCOS_TABLE_BITS, the last one
+// being clamped to 2^FAST_SINCOS_TABLE_BITS - 1.
+// PROGMEM must be defined before including this header.
+
+// clang-format off
+#if QUADRANT_SIZE == 64 && FAST_SINCOS_TABLE_BITS == 8
+static const uint8_t sineTable[65] PROGMEM = {
+    0,   6,   13,  19,  25,  31,  38,  44,  50,  56,  62,  68,  74,  80,  86,
+    92,  98,  104, 109, 115, 121, 126, 132, 137, 142, 147, 152, 157, 162, 167,
+    172, 177, 181, 185, 190, 194, 198, 202, 206, 209, 213, 216, 220, 223, 226,
+    229, 231, 234, 237, 239, 241, 243, 245, 247, 248, 250, 251, 252, 253, 254,
+    255, 255, 255, 255, 255,
+};
+#elif QUADRANT_SIZE == 64 && FAST_SINCOS_TABLE_BITS == 16
+static const uint16_t sineTable[65] PROGMEM = {
+    0,     1608,  3216,  4821,  6424,  8022,  9616,  11204, 12785, 14359,
+    15924, 17479, 19024, 20557, 22078, 23586, 25080, 26558, 28020, 29466,
+    30893, 32303, 33692, 35062, 36410, 37736, 39040, 40320, 41576, 42806,
+    44011, 45190, 46341, 47464, 48559, 49624, 50660, 51665, 52639, 53581,
+    54491, 55368, 56212, 57022, 57798, 58538, 59244, 59914, 60547, 61145,
+    61705, 62228, 62714, 63162, 63572, 63944, 64277, 64571, 64827, 65043,
+    65220, 65358, 65457, 65516, 65535,
+};
+#elif QUADRANT_SIZE == 64 && FAST_SINCOS_TABLE_BITS == 32
+static const uint32_t sineTable[65] PROGMEM = {
+    0,          105403774,  210744057,  315957395,  420980412,  525749847,
+    630202589,  734275721,  837906553,  941032661,  1043591926, 1145522571,
+    1246763195, 1347252816, 1446930903, 1545737412, 1643612827, 1740498191,
+    1836335144, 1931065957, 2024633568, 2116981616, 2208054473, 2297797281,
+    2386155981, 2473077351, 2558509031, 2642399561, 2724698408, 2805355999,
+    2884323748, 2961554089, 3037000500, 3110617535, 3182360851, 3252187232,
+    3320054617, 3385922125, 3449750080, 3511500034, 3571134792, 3628618433,
+    3683916329, 3736995171, 3787822988, 3836369162, 3882604450, 3926501002,
+    3968032378, 4007173558, 4043900968, 4078192482, 4110027446, 4139386683,
+    4166252509, 4190608739, 4212440704, 4231735252, 4248480760, 4262667143,
+    4274285855, 4283329896, 4289793820, 4293673732, 4294967295,
+};
+#elif QUADRANT_SIZE == 128 && FAST_SINCOS_TABLE_BITS == 8
+static const uint8_t sineTable[129] PROGMEM = {
+    0,   3,   6,   9,   13,  16,  19,  22,  25,  28,  31,  34,  38,  41,  44,
+    47,  50,  53,  56,  59,  62,  65,  68,  71,  74,  77,  80,  83,  86,  89,
+    92,  95,  98,  101, 104, 107, 109, 112, 115, 118, 121, 123, 126, 129, 132,
+    134, 137, 140, 142, 145, 147, 150, 152, 155, 157, 160, 162, 165, 167, 170,
+    172, 174, 177, 179, 181, 183, 185, 188, 190, 192, 194, 196, 198, 200, 202,
+    204, 206, 207, 209, 211, 213, 215, 216, 218, 220, 221, 223, 224, 226, 227,
+    229, 230, 231, 233, 234, 235, 237, 238, 239, 240, 241, 242, 243, 244, 245,
+    246, 247, 248, 248, 249, 250, 250, 251, 252, 252, 253, 253, 254, 254, 254,
+    255, 255, 255, 255, 255, 255, 255, 255, 255,
+};
+#elif QUADRANT_SIZE == 128 && FAST_SINCOS_TABLE_BITS == 16
+static const uint16_t sineTable[129] PROGMEM = {
+    0,     804,   1608,  2412,  3216,  4019,  4821,  5623,  6424,  7224,
+    8022,  8820,  9616,  10411, 11204, 11996, 12785, 13573, 14359, 15143,
+    15924, 16703, 17479, 18253, 19024, 19792, 20557, 21320, 22078, 22834,
+    23586, 24335, 25080, 25821, 26558, 27291, 28020, 28745, 29466, 30182,
+    30893, 31600, 32303, 33000, 33692, 34380, 35062, 35738, 36410, 37076,
+    37736, 38391, 39040, 39683, 40320, 40951, 41576, 42194, 42806, 43412,
+    44011, 44604, 45190, 45769, 46341, 46906, 47464, 48015, 48559, 49095,
+    49624, 50146, 50660, 51166, 51665, 52156, 52639, 53114, 53581, 54040,
+    54491, 54934, 55368, 55794, 56212, 56621, 57022, 57414, 57798, 58172,
+    58538, 58896, 59244, 59583, 59914, 60235, 60547, 60851, 61145, 61429,
+    61705, 61971, 62228, 62476, 62714, 62943, 63162, 63372, 63572, 63763,
+    63944, 64115, 64277, 64429, 64571, 64704, 64827, 64940, 65043, 65137,
+    65220, 65294, 65358, 65413, 65457, 65492, 65516, 65531, 65535,
+};
+#elif QUADRANT_SIZE == 128 && FAST_SINCOS_TABLE_BITS == 32
+static const uint32_t sineTable[129] PROGMEM = {
+    0,          52705856,   105403774,  158085819,  210744057,  263370557,
+    315957395,  368496651,  420980412,  473400776,  525749847,  578019742,
+    630202589,  682290530,  734275721,  786150333,  837906553,  889536587,
+    941032661,  992387019,  1043591926, 1094639673, 1145522571, 1196232957,
+    1246763195, 1297105676, 1347252816, 1397197066, 1446930903, 1496446837,
+    1545737412, 1594795204, 1643612827, 1692182927, 1740498191, 1788551342,
+    1836335144, 1883842400, 1931065957, 1977998702, 2024633568, 2070963532,
+    2116981616, 2162680890, 2208054473, 2253095531, 2297797281, 2342152991,
+    2386155981, 2429799626, 2473077351, 2515982640, 2558509031, 2600650120,
+    2642399561, 2683751066, 2724698408, 2765235421, 2805355999, 2845054101,
+    2884323748, 2923159027, 2961554089, 2999503152, 3037000500, 3074040487,
+    3110617535, 3146726136, 3182360851, 3217516315, 3252187232, 3286368382,
+    3320054617, 3353240863, 3385922125, 3418093478, 3449750080, 3480887161,
+    3511500034, 3541584088, 3571134792, 3600147697, 3628618433, 3656542712,
+    3683916329, 3710735162, 3736995171, 3762692404, 3787822988, 3812383140,
+    3836369162, 3859777440, 3882604450, 3904846754, 3926501002, 3947563934,
+    3968032378, 3987903250, 4007173558, 4025840401, 4043900968, 4061352537,
+    4078192482, 4094418266, 4110027446, 4125017671, 4139386683, 4153132319,
+    4166252509, 4178745276, 4190608739, 4201841112, 4212440704, 4222405917,
+    4231735252, 4240427302, 4248480760, 4255894413, 4262667143, 4268797931,
+    4274285855, 4279130086, 4283329896, 4286884652, 4289793820, 4292056960,
+    4293673732, 4294643893, 4294967295,
+};
+#elif QUADRANT_SIZE == 256 && FAST_SINCOS_TABLE_BITS == 8
+static const uint8_t sineTable[257] PROGMEM = {
+    0,   2,   3,   5,   6,   8,   9,   11,  13,  14,  16,  17,  19,  20,  22,
+    24,  25,  27,  28,  30,  31,  33,  34,  36,  38,  39,  41,  42,  44,  45,
+    47,  48,  50,  51,  53,  55,  56,  58,  59,  61,  62,  64,  65,  67,  68,
+    70,  71,  73,  74,  76,  77,  79,  80,  82,  83,  85,  86,  88,  89,  91,
+    92,  94,  95,  97,  98,  99,  101, 102, 104, 105, 107, 108, 109, 111, 112,
+    114, 115, 117, 118, 119, 121, 122, 123, 125, 126, 128, 129, 130, 132, 133,
+    134, 136, 137, 138, 140, 141, 142, 144, 145, 146, 147, 149, 150, 151, 152,
+    154, 155, 156, 157, 159, 160, 161, 162, 164, 165, 166, 167, 168, 170, 171,
+    172, 173, 174, 175, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 188,
+    189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203,
+    204, 205, 206, 207, 207, 208, 209, 210, 211, 212, 213, 214, 215, 215, 216,
+    217, 218, 219, 220, 220, 221, 222, 223, 224, 224, 225, 226, 227, 227, 228,
+    229, 229, 230, 231, 231, 232, 233, 233, 234, 235, 235, 236, 237, 237, 238,
+    238, 239, 239, 240, 241, 241, 242, 242, 243, 243, 244, 244, 245, 245, 245,
+    246, 246, 247, 247, 248, 248, 248, 249, 249, 249, 250, 250, 250, 251, 251,
+    251, 252, 252, 252, 252, 253, 253, 253, 253, 254, 254, 254, 254, 254, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255,
+};
+#elif QUADRANT_SIZE == 256 && FAST_SINCOS_TABLE_BITS == 16
+static const uint16_t sineTable[257] PROGMEM = {
+    0,     402,   804,   1206,  1608,  2010,  2412,  2814,  3216,  3617,
+    4019,  4420,  4821,  5222,  5623,  6023,  6424,  6824,  7224,  7623,
+    8022,  8421,  8820,  9218,  9616,  10014, 10411, 10808, 11204, 11600,
+    11996, 12391, 12785, 13180, 13573, 13966, 14359, 14751, 15143, 15534,
+    15924, 16314, 16703, 17091, 17479, 17867, 18253, 18639, 19024, 19409,
+    19792, 20175, 20557, 20939, 21320, 21699, 22078, 22457, 22834, 23210,
+    23586, 23961, 24335, 24708, 25080, 25451, 25821, 26190, 26558, 26925,
+    27291, 27656, 28020, 28383, 28745, 29106, 29466, 29824, 30182, 30538,
+    30893, 31248, 31600, 31952, 32303, 32652, 33000, 33347, 33692, 34037,
+    34380, 34721, 35062, 35401, 35738, 36075, 36410, 36744, 37076, 37407,
+    37736, 38064, 38391, 38716, 39040, 39362, 39683, 40002, 40320, 40636,
+    40951, 41264, 41576, 41886, 42194, 42501, 42806, 43110, 43412, 43713,
+    44011, 44308, 44604, 44898, 45190, 45480, 45769, 46056, 46341, 46624,
+    46906, 47186, 47464, 47741, 48015, 48288, 48559, 48828, 49095, 49361,
+    49624, 49886, 50146, 50404, 50660, 50914, 51166, 51417, 51665, 51911,
+    52156, 52398, 52639, 52878, 53114, 53349, 53581, 53812, 54040, 54267,
+    54491, 54714, 54934, 55152, 55368, 55582, 55794, 56004, 56212, 56418,
+    56621, 56823, 57022, 57219, 57414, 57607, 57798, 57986, 58172, 58356,
+    58538, 58718, 58896, 59071, 59244, 59415, 59583, 59750, 59914, 60075,
+    60235, 60392, 60547, 60700, 60851, 60999, 61145, 61288, 61429, 61568,
+    61705, 61839, 61971, 62101, 62228, 62353, 62476, 62596, 62714, 62830,
+    62943, 63054, 63162, 63268, 63372, 63473, 63572, 63668, 63763, 63854,
+    63944, 64031, 64115, 64197, 64277, 64354, 64429, 64501, 64571, 64639,
+    64704, 64766, 64827, 64884, 64940, 64993, 65043, 65091, 65137, 65180,
+    65220, 65259, 65294, 65328, 65358, 65387, 65413, 65436, 65457, 65476,
+    65492, 65505, 65516, 65525, 65531, 65535, 65535,
+};
+#elif QUADRANT_SIZE == 256 && FAST_SINCOS_TABLE_BITS == 32
+static const uint32_t sineTable[257] PROGMEM = {
+    0,          26353424,   52705856,   79056303,   105403774,  131747276,
+    158085819,  184418409,  210744057,  237061769,  263370557,  289669429,
+    315957395,  342233465,  368496651,  394745962,  420980412,  447199012,
+    473400776,  499584716,  525749847,  551895183,  578019742,  604122538,
+    630202589,  656258914,  682290530,  708296459,  734275721,  760227338,
+    786150333,  812043729,  837906553,  863737830,  889536587,  915301854,
+    941032661,  966728038,  992387019,  1018008636, 1043591926, 1069135926,
+    1094639673, 1120102207, 1145522571, 1170899806, 1196232957, 1221521071,
+    1246763195, 1271958380, 1297105676, 1322204136, 1347252816, 1372250773,
+    1397197066, 1422090755, 1446930903, 1471716574, 1496446837, 1521120759,
+    1545737412, 1570295869, 1594795204, 1619234497, 1643612827, 1667929275,
+    1692182927, 1716372869, 1740498191, 1764557983, 1788551342, 1812477362,
+    1836335144, 1860123788, 1883842400, 1907490086, 1931065957, 1954569124,
+    1977998702, 2001353810, 2024633568, 2047837100, 2070963532, 2094011993,
+    2116981616, 2139871536, 2162680890, 2185408821, 2208054473, 2230616993,
+    2253095531, 2275489241, 2297797281, 2320018810, 2342152991, 2364198992,
+    2386155981, 2408023134, 2429799626, 2451484637, 2473077351, 2494576955,
+    2515982640, 2537293599, 2558509031, 2579628136, 2600650120, 2621574191,
+    2642399561, 2663125446, 2683751066, 2704275644, 2724698408, 2745018589,
+    2765235421, 2785348143, 2805355999, 2825258235, 2845054101, 2864742853,
+    2884323748, 2903796051, 2923159027, 2942411948, 2961554089, 2980584729,
+    2999503152, 3018308645, 3037000500, 3055578014, 3074040487, 3092387225,
+    3110617535, 3128730733, 3146726136, 3164603066, 3182360851, 3199998822,
+    3217516315, 3234912670, 3252187232, 3269339351, 3286368382, 3303273682,
+    3320054617, 3336710553, 3353240863, 3369644927, 3385922125, 3402071844,
+    3418093478, 3433986423, 3449750080, 3465383855, 3480887161, 3496259414,
+    3511500034, 3526608449, 3541584088, 3556426389, 3571134792, 3585708745,
+    3600147697, 3614451106, 3628618433, 3642649144, 3656542712, 3670298613,
+    3683916329, 3697395348, 3710735162, 3723935269, 3736995171, 3749914379,
+    3762692404, 3775328765, 3787822988, 3800174601, 3812383140, 3824448145,
+    3836369162, 3848145741, 3859777440, 3871263820, 3882604450, 3893798902,
+    3904846754, 3915747591, 3926501002, 3937106583, 3947563934, 3957872662,
+    3968032378, 3978042699, 3987903250, 3997613658, 4007173558, 4016582591,
+    4025840401, 4034946641, 4043900968, 4052703044, 4061352537, 4069849124,
+    4078192482, 4086382299, 4094418266, 4102300081, 4110027446, 4117600071,
+    4125017671, 4132279966, 4139386683, 4146337555, 4153132319, 4159770720,
+    4166252509, 4172577440, 4178745276, 4184755784, 4190608739, 4196303920,
+    4201841112, 4207220108, 4212440704, 4217502704, 4222405917, 4227150159,
+    4231735252, 4236161021, 4240427302, 4244533933, 4248480760, 4252267634,
+    4255894413, 4259360959, 4262667143, 4265812840, 4268797931, 4271622305,
+    4274285855, 4276788480, 4279130086, 4281310585, 4283329896, 4285187942,
+    4286884652, 4288419964, 4289793820, 4291006167, 4292056960, 4292946160,
+    4293673732, 4294239650, 4294643893, 4294886444, 4294967295,
+};
+#elif QUADRANT_SIZE == 512 && FAST_SINCOS_TABLE_BITS == 8
+static const uint8_t sineTable[513] PROGMEM = {
+    0,   1,   2,   2,   3,   4,   5,   5,   6,   7,   8,   9,   9,   10,  11,
+    12,  13,  13,  14,  15,  16,  16,  17,  18,  19,  20,  20,  21,  22,  23,
+    24,  24,  25,  26,  27,  27,  28,  29,  30,  31,  31,  32,  33,  34,  34,
+    35,  36,  37,  38,  38,  39,  40,  41,  41,  42,  43,  44,  45,  45,  46,
+    47,  48,  48,  49,  50,  51,  51,  52,  53,  54,  55,  55,  56,  57,  58,
+    58,  59,  60,  61,  61,  62,  63,  64,  64,  65,  66,  67,  68,  68,  69,
+    70,  71,  71,  72,  73,  74,  74,  75,  76,  77,  77,  78,  79,  80,  80,
+    81,  82,  83,  83,  84,  85,  86,  86,  87,  88,  88,  89,  90,  91,  91,
+    92,  93,  94,  94,  95,  96,  97,  97,  98,  99,  99,  100, 101, 102, 102,
+    103, 104, 104, 105, 106, 107, 107, 108, 109, 109, 110, 111, 112, 112, 113,
+    114, 114, 115, 116, 117, 117, 118, 119, 119, 120, 121, 121, 122, 123, 123,
+    124, 125, 125, 126, 127, 128, 128, 129, 130, 130, 131, 132, 132, 133, 134,
+    134, 135, 136, 136, 137, 138, 138, 139, 140, 140, 141, 142, 142, 143, 144,
+    144, 145, 145, 146, 147, 147, 148, 149, 149, 150, 151, 151, 152, 152, 153,
+    154, 154, 155, 156, 156, 157, 157, 158, 159, 159, 160, 161, 161, 162, 162,
+    163, 164, 164, 165, 165, 166, 167, 167, 168, 168, 169, 170, 170, 171, 171,
+    172, 173, 173, 174, 174, 175, 175, 176, 177, 177, 178, 178, 179, 179, 180,
+    180, 181, 182, 182, 183, 183, 184, 184, 185, 185, 186, 186, 187, 188, 188,
+    189, 189, 190, 190, 191, 191, 192, 192, 193, 193, 194, 194, 195, 195, 196,
+    196, 197, 197, 198, 198, 199, 199, 200, 200, 201, 201, 202, 202, 203, 203,
+    204, 204, 205, 205, 206, 206, 207, 207, 207, 208, 208, 209, 209, 210, 210,
+    211, 211, 212, 212, 212, 213, 213, 214, 214, 215, 215, 215, 216, 216, 217,
+    217, 218, 218, 218, 219, 219, 220, 220, 220, 221, 221, 222, 222, 222, 223,
+    223, 224, 224, 224, 225, 225, 225, 226, 226, 227, 227, 227, 228, 228, 228,
+    229, 229, 229, 230, 230, 230, 231, 231, 231, 232, 232, 232, 233, 233, 233,
+    234, 234, 234, 235, 235, 235, 236, 236, 236, 237, 237, 237, 237, 238, 238,
+    238, 239, 239, 239, 239, 240, 240, 240, 241, 241, 241, 241, 242, 242, 242,
+    242, 243, 243, 243, 243, 244, 244, 244, 244, 245, 245, 245, 245, 245, 246,
+    246, 246, 246, 247, 247, 247, 247, 247, 248, 248, 248, 248, 248, 249, 249,
+    249, 249, 249, 249, 250, 250, 250, 250, 250, 250, 251, 251, 251, 251, 251,
+    251, 252, 252, 252, 252, 252, 252, 252, 252, 253, 253, 253, 253, 253, 253,
+    253, 253, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255,
+};
+#elif QUADRANT_SIZE == 512 && FAST_SINCOS_TABLE_BITS == 16
+static const uint16_t sineTable[513] PROGMEM = {
+    0,     201,   402,   603,   804,   1005,  1206,  1407,  1608,  1809,
+    2010,  2211,  2412,  2613,  2814,  3015,  3216,  3417,  3617,  3818,
+    4019,  4219,  4420,  4621,  4821,  5022,  5222,  5422,  5623,  5823,
+    6023,  6224,  6424,  6624,  6824,  7024,  7224,  7423,  7623,  7823,
+    8022,  8222,  8421,  8621,  8820,  9019,  9218,  9417,  9616,  9815,
+    10014, 10212, 10411, 10609, 10808, 11006, 11204, 11402, 11600, 11798,
+    11996, 12193, 12391, 12588, 12785, 12983, 13180, 13376, 13573, 13770,
+    13966, 14163, 14359, 14555, 14751, 14947, 15143, 15338, 15534, 15729,
+    15924, 16119, 16314, 16508, 16703, 16897, 17091, 17285, 17479, 17673,
+    17867, 18060, 18253, 18446, 18639, 18832, 19024, 19216, 19409, 19600,
+    19792, 19984, 20175, 20366, 20557, 20748, 20939, 21129, 21320, 21510,
+    21699, 21889, 22078, 22268, 22457, 22645, 22834, 23022, 23210, 23398,
+    23586, 23774, 23961, 24148, 24335, 24521, 24708, 24894, 25080, 25265,
+    25451, 25636, 25821, 26005, 26190, 26374, 26558, 26742, 26925, 27108,
+    27291, 27474, 27656, 27838, 28020, 28202, 28383, 28564, 28745, 28926,
+    29106, 29286, 29466, 29645, 29824, 30003, 30182, 30360, 30538, 30716,
+    30893, 31071, 31248, 31424, 31600, 31776, 31952, 32127, 32303, 32477,
+    32652, 32826, 33000, 33173, 33347, 33520, 33692, 33865, 34037, 34208,
+    34380, 34551, 34721, 34892, 35062, 35231, 35401, 35570, 35738, 35907,
+    36075, 36243, 36410, 36577, 36744, 36910, 37076, 37241, 37407, 37572,
+    37736, 37900, 38064, 38228, 38391, 38554, 38716, 38878, 39040, 39201,
+    39362, 39523, 39683, 39843, 40002, 40161, 40320, 40478, 40636, 40794,
+    40951, 41108, 41264, 41420, 41576, 41731, 41886, 42040, 42194, 42348,
+    42501, 42654, 42806, 42958, 43110, 43261, 43412, 43562, 43713, 43862,
+    44011, 44160, 44308, 44456, 44604, 44751, 44898, 45044, 45190, 45335,
+    45480, 45625, 45769, 45912, 46056, 46199, 46341, 46483, 46624, 46765,
+    46906, 47046, 47186, 47325, 47464, 47603, 47741, 47878, 48015, 48152,
+    48288, 48424, 48559, 48694, 48828, 48962, 49095, 49228, 49361, 49493,
+    49624, 49756, 49886, 50016, 50146, 50275, 50404, 50532, 50660, 50787,
+    50914, 51041, 51166, 51292, 51417, 51541, 51665, 51789, 51911, 52034,
+    52156, 52277, 52398, 52519, 52639, 52759, 52878, 52996, 53114, 53232,
+    53349, 53465, 53581, 53697, 53812, 53926, 54040, 54154, 54267, 54379,
+    54491, 54603, 54714, 54824, 54934, 55043, 55152, 55260, 55368, 55476,
+    55582, 55689, 55794, 55900, 56004, 56108, 56212, 56315, 56418, 56520,
+    56621, 56722, 56823, 56923, 57022, 57121, 57219, 57317, 57414, 57511,
+    57607, 57703, 57798, 57892, 57986, 58079, 58172, 58265, 58356, 58448,
+    58538, 58628, 58718, 58807, 58896, 58983, 59071, 59158, 59244, 59330,
+    59415, 59499, 59583, 59667, 59750, 59832, 59914, 59995, 60075, 60156,
+    60235, 60314, 60392, 60470, 60547, 60624, 60700, 60776, 60851, 60925,
+    60999, 61072, 61145, 61217, 61288, 61359, 61429, 61499, 61568, 61637,
+    61705, 61772, 61839, 61906, 61971, 62036, 62101, 62165, 62228, 62291,
+    62353, 62415, 62476, 62536, 62596, 62655, 62714, 62772, 62830, 62886,
+    62943, 62998, 63054, 63108, 63162, 63215, 63268, 63320, 63372, 63423,
+    63473, 63523, 63572, 63621, 63668, 63716, 63763, 63809, 63854, 63899,
+    63944, 63987, 64031, 64073, 64115, 64156, 64197, 64237, 64277, 64316,
+    64354, 64392, 64429, 64465, 64501, 64536, 64571, 64605, 64639, 64672,
+    64704, 64735, 64766, 64797, 64827, 64856, 64884, 64912, 64940, 64967,
+    64993, 65018, 65043, 65067, 65091, 65114, 65137, 65159, 65180, 65200,
+    65220, 65240, 65259, 65277, 65294, 65311, 65328, 65343, 65358, 65373,
+    65387, 65400, 65413, 65425, 65436, 65447, 65457, 65467, 65476, 65484,
+    65492, 65499, 65505, 65511, 65516, 65521, 65525, 65528, 65531, 65533,
+    65535, 65535, 65535,
+};
+#elif QUADRANT_SIZE == 512 && FAST_SINCOS_TABLE_BITS == 32
+static const uint32_t sineTable[513] PROGMEM = {
+    0,          13176774,   26353424,   39529826,   52705856,   65881389,
+    79056303,   92230472,   105403774,  118576083,  131747276,  144917230,
+    158085819,  171252920,  184418409,  197582163,  210744057,  223903967,
+    237061769,  250217341,  263370557,  276521294,  289669429,  302814837,
+    315957395,  329096979,  342233465,  355366730,  368496651,  381623102,
+    394745962,  407865107,  420980412,  434091755,  447199012,  460302060,
+    473400776,  486495035,  499584716,  512669694,  525749847,  538825051,
+    551895183,  564960121,  578019742,  591073921,  604122538,  617165468,
+    630202589,  643233779,  656258914,  669277872,  682290530,  695296767,
+    708296459,  721289485,  734275721,  747255046,  760227338,  773192474,
+    786150333,  799100792,  812043729,  824979024,  837906553,  850826195,
+    863737830,  876641334,  889536587,  902423468,  915301854,  928171626,
+    941032661,  953884839,  966728038,  979562138,  992387019,  1005202558,
+    1018008636, 1030805132, 1043591926, 1056368897, 1069135926, 1081892891,
+    1094639673, 1107376152, 1120102207, 1132817720, 1145522571, 1158216639,
+    1170899806, 1183571952, 1196232957, 1208882703, 1221521071, 1234147941,
+    1246763195, 1259366714, 1271958380, 1284538073, 1297105676, 1309661069,
+    1322204136, 1334734758, 1347252816, 1359758194, 1372250773, 1384730436,
+    1397197066, 1409650544, 1422090755, 1434517580, 1446930903, 1459330606,
+    1471716574, 1484088690, 1496446837, 1508790899, 1521120759, 1533436302,
+    1545737412, 1558023973, 1570295869, 1582552984, 1594795204, 1607022414,
+    1619234497, 1631431340, 1643612827, 1655778843, 1667929275, 1680064008,
+    1692182927, 1704285919, 1716372869, 1728443664, 1740498191, 1752536335,
+    1764557983, 1776563023, 1788551342, 1800522825, 1812477362, 1824414839,
+    1836335144, 1848238164, 1860123788, 1871991904, 1883842400, 1895675165,
+    1907490086, 1919287054, 1931065957, 1942826684, 1954569124, 1966293167,
+    1977998702, 1989685620, 2001353810, 2013003163, 2024633568, 2036244917,
+    2047837100, 2059410008, 2070963532, 2082497563, 2094011993, 2105506713,
+    2116981616, 2128436593, 2139871536, 2151286337, 2162680890, 2174055087,
+    2185408821, 2196741986, 2208054473, 2219346178, 2230616993, 2241866812,
+    2253095531, 2264303042, 2275489241, 2286654023, 2297797281, 2308918911,
+    2320018810, 2331096871, 2342152991, 2353187066, 2364198992, 2375188665,
+    2386155981, 2397100839, 2408023134, 2418922764, 2429799626, 2440653617,
+    2451484637, 2462292582, 2473077351, 2483838842, 2494576955, 2505291588,
+    2515982640, 2526650010, 2537293599, 2547913306, 2558509031, 2569080674,
+    2579628136, 2590151318, 2600650120, 2611124444, 2621574191, 2631999263,
+    2642399561, 2652774988, 2663125446, 2673450838, 2683751066, 2694026034,
+    2704275644, 2714499801, 2724698408, 2734871369, 2745018589, 2755139971,
+    2765235421, 2775304843, 2785348143, 2795365227, 2805355999, 2815320366,
+    2825258235, 2835169511, 2845054101, 2854911913, 2864742853, 2874546829,
+    2884323748, 2894073520, 2903796051, 2913491250, 2923159027, 2932799290,
+    2942411948, 2951996911, 2961554089, 2971083391, 2980584729, 2990058012,
+    2999503152, 3008920059, 3018308645, 3027668821, 3037000500, 3046303593,
+    3055578014, 3064823674, 3074040487, 3083228366, 3092387225, 3101516976,
+    3110617535, 3119688816, 3128730733, 3137743202, 3146726136, 3155679453,
+    3164603066, 3173496894, 3182360851, 3191194855, 3199998822, 3208772670,
+    3217516315, 3226229675, 3234912670, 3243565216, 3252187232, 3260778637,
+    3269339351, 3277869293, 3286368382, 3294836538, 3303273682, 3311679735,
+    3320054617, 3328398249, 3336710553, 3344991450, 3353240863, 3361458715,
+    3369644927, 3377799422, 3385922125, 3394012957, 3402071844, 3410098710,
+    3418093478, 3426056074, 3433986423, 3441884449, 3449750080, 3457583240,
+    3465383855, 3473151854, 3480887161, 3488589706, 3496259414, 3503896214,
+    3511500034, 3519070803, 3526608449, 3534112901, 3541584088, 3549021941,
+    3556426389, 3563797363, 3571134792, 3578438609, 3585708745, 3592945130,
+    3600147697, 3607316378, 3614451106, 3621551813, 3628618433, 3635650898,
+    3642649144, 3649613104, 3656542712, 3663437903, 3670298613, 3677124776,
+    3683916329, 3690673207, 3697395348, 3704082687, 3710735162, 3717352710,
+    3723935269, 3730482776, 3736995171, 3743472393, 3749914379, 3756321069,
+    3762692404, 3769028322, 3775328765, 3781593674, 3787822988, 3794016650,
+    3800174601, 3806296784, 3812383140, 3818433613, 3824448145, 3830426680,
+    3836369162, 3842275534, 3848145741, 3853979728, 3859777440, 3865538822,
+    3871263820, 3876952381, 3882604450, 3888219974, 3893798902, 3899341179,
+    3904846754, 3910315575, 3915747591, 3921142750, 3926501002, 3931822297,
+    3937106583, 3942353812, 3947563934, 3952736900, 3957872662, 3962971170,
+    3968032378, 3973056236, 3978042699, 3982991719, 3987903250, 3992777245,
+    3997613658, 4002412444, 4007173558, 4011896955, 4016582591, 4021230421,
+    4025840401, 4030412489, 4034946641, 4039442815, 4043900968, 4048321058,
+    4052703044, 4057046884, 4061352537, 4065619964, 4069849124, 4074039976,
+    4078192482, 4082306603, 4086382299, 4090419533, 4094418266, 4098378461,
+    4102300081, 4106183088, 4110027446, 4113833119, 4117600071, 4121328267,
+    4125017671, 4128668249, 4132279966, 4135852789, 4139386683, 4142881616,
+    4146337555, 4149754467, 4153132319, 4156471081, 4159770720, 4163031206,
+    4166252509, 4169434596, 4172577440, 4175681009, 4178745276, 4181770210,
+    4184755784, 4187701970, 4190608739, 4193476065, 4196303920, 4199092278,
+    4201841112, 4204550397, 4207220108, 4209850218, 4212440704, 4214991540,
+    4217502704, 4219974170, 4222405917, 4224797921, 4227150159, 4229462610,
+    4231735252, 4233968062, 4236161021, 4238314108, 4240427302, 4242500584,
+    4244533933, 4246527332, 4248480760, 4250394200, 4252267634, 4254101044,
+    4255894413, 4257647723, 4259360959, 4261034104, 4262667143, 4264260060,
+    4265812840, 4267325469, 4268797931, 4270230215, 4271622305, 4272974189,
+    4274285855, 4275557289, 4276788480, 4277979416, 4279130086, 4280240479,
+    4281310585, 4282340394, 4283329896, 4284279082, 4285187942, 4286056468,
+    4286884652, 4287672487, 4288419964, 4289127078, 4289793820, 4290420185,
+    4291006167, 4291551760, 4292056960, 4292521761, 4292946160, 4293330151,
+    4293673732, 4293976900, 4294239650, 4294461982, 4294643893, 4294785381,
+    4294886444, 4294947083, 4294967295,
+};
+#elif QUADRANT_SIZE == 1024 && FAST_SINCOS_TABLE_BITS == 8
+static const uint8_t sineTable[1025] PROGMEM = {
+    0,   0,   1,   1,   2,   2,   2,   3,   3,   4,   4,   4,   5,   5,   5,
+    6,   6,   7,   7,   7,   8,   8,   9,   9,   9,   10,  10,  11,  11,  11,
+    12,  12,  13,  13,  13,  14,  14,  15,  15,  15,  16,  16,  16,  17,  17,
+    18,  18,  18,  19,  19,  20,  20,  20,  21,  21,  22,  22,  22,  23,  23,
+    24,  24,  24,  25,  25,  25,  26,  26,  27,  27,  27,  28,  28,  29,  29,
+    29,  30,  30,  31,  31,  31,  32,  32,  33,  33,  33,  34,  34,  34,  35,
+    35,  36,  36,  36,  37,  37,  38,  38,  38,  39,  39,  40,  40,  40,  41,
+    41,  41,  42,  42,  43,  43,  43,  44,  44,  45,  45,  45,  46,  46,  46,
+    47,  47,  48,  48,  48,  49,  49,  50,  50,  50,  51,  51,  51,  52,  52,
+    53,  53,  53,  54,  54,  55,  55,  55,  56,  56,  56,  57,  57,  58,  58,
+    58,  59,  59,  60,  60,  60,  61,  61,  61,  62,  62,  63,  63,  63,  64,
+    64,  64,  65,  65,  66,  66,  66,  67,  67,  68,  68,  68,  69,  69,  69,
+    70,  70,  71,  71,  71,  72,  72,  72,  73,  73,  74,  74,  74,  75,  75,
+    75,  76,  76,  77,  77,  77,  78,  78,  78,  79,  79,  80,  80,  80,  81,
+    81,  81,  82,  82,  83,  83,  83,  84,  84,  84,  85,  85,  86,  86,  86,
+    87,  87,  87,  88,  88,  88,  89,  89,  90,  90,  90,  91,  91,  91,  92,
+    92,  92,  93,  93,  94,  94,  94,  95,  95,  95,  96,  96,  97,  97,  97,
+    98,  98,  98,  99,  99,  99,  100, 100, 101, 101, 101, 102, 102, 102, 103,
+    103, 103, 104, 104, 104, 105, 105, 106, 106, 106, 107, 107, 107, 108, 108,
+    108, 109, 109, 109, 110, 110, 111, 111, 111, 112, 112, 112, 113, 113, 113,
+    114, 114, 114, 115, 115, 115, 116, 116, 117, 117, 117, 118, 118, 118, 119,
+    119, 119, 120, 120, 120, 121, 121, 121, 122, 122, 122, 123, 123, 123, 124,
+    124, 124, 125, 125, 125, 126, 126, 127, 127, 127, 128, 128, 128, 129, 129,
+    129, 130, 130, 130, 131, 131, 131, 132, 132, 132, 133, 133, 133, 134, 134,
+    134, 135, 135, 135, 136, 136, 136, 137, 137, 137, 138, 138, 138, 139, 139,
+    139, 140, 140, 140, 141, 141, 141, 142, 142, 142, 143, 143, 143, 144, 144,
+    144, 145, 145, 145, 145, 146, 146, 146, 147, 147, 147, 148, 148, 148, 149,
+    149, 149, 150, 150, 150, 151, 151, 151, 152, 152, 152, 152, 153, 153, 153,
+    154, 154, 154, 155, 155, 155, 156, 156, 156, 157, 157, 157, 157, 158, 158,
+    158, 159, 159, 159, 160, 160, 160, 161, 161, 161, 161, 162, 162, 162, 163,
+    163, 163, 164, 164, 164, 165, 165, 165, 165, 166, 166, 166, 167, 167, 167,
+    168, 168, 168, 168, 169, 169, 169, 170, 170, 170, 170, 171, 171, 171, 172,
+    172, 172, 173, 173, 173, 173, 174, 174, 174, 175, 175, 175, 175, 176, 176,
+    176, 177, 177, 177, 177, 178, 178, 178, 179, 179, 179, 179, 180, 180, 180,
+    180, 181, 181, 181, 182, 182, 182, 182, 183, 183, 183, 184, 184, 184, 184,
+    185, 185, 185, 185, 186, 186, 186, 186, 187, 187, 187, 188, 188, 188, 188,
+    189, 189, 189, 189, 190, 190, 190, 190, 191, 191, 191, 192, 192, 192, 192,
+    193, 193, 193, 193, 194, 194, 194, 194, 195, 195, 195, 195, 196, 196, 196,
+    196, 197, 197, 197, 197, 198, 198, 198, 198, 199, 199, 199, 199, 200, 200,
+    200, 200, 201, 201, 201, 201, 202, 202, 202, 202, 203, 203, 203, 203, 203,
+    204, 204, 204, 204, 205, 205, 205, 205, 206, 206, 206, 206, 207, 207, 207,
+    207, 207, 208, 208, 208, 208, 209, 209, 209, 209, 210, 210, 210, 210, 210,
+    211, 211, 211, 211, 212, 212, 212, 212, 212, 213, 213, 213, 213, 214, 214,
+    214, 214, 214, 215, 215, 215, 215, 215, 216, 216, 216, 216, 216, 217, 217,
+    217, 217, 218, 218, 218, 218, 218, 219, 219, 219, 219, 219, 220, 220, 220,
+    220, 220, 221, 221, 221, 221, 221, 222, 222, 222, 222, 222, 223, 223, 223,
+    223, 223, 224, 224, 224, 224, 224, 224, 225, 225, 225, 225, 225, 226, 226,
+    226, 226, 226, 227, 227, 227, 227, 227, 227, 228, 228, 228, 228, 228, 228,
+    229, 229, 229, 229, 229, 230, 230, 230, 230, 230, 230, 231, 231, 231, 231,
+    231, 231, 232, 232, 232, 232, 232, 232, 233, 233, 233, 233, 233, 233, 234,
+    234, 234, 234, 234, 234, 235, 235, 235, 235, 235, 235, 235, 236, 236, 236,
+    236, 236, 236, 237, 237, 237, 237, 237, 237, 237, 238, 238, 238, 238, 238,
+    238, 238, 239, 239, 239, 239, 239, 239, 239, 240, 240, 240, 240, 240, 240,
+    240, 241, 241, 241, 241, 241, 241, 241, 241, 242, 242, 242, 242, 242, 242,
+    242, 242, 243, 243, 243, 243, 243, 243, 243, 243, 244, 244, 244, 244, 244,
+    244, 244, 244, 245, 245, 245, 245, 245, 245, 245, 245, 245, 246, 246, 246,
+    246, 246, 246, 246, 246, 246, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 249, 249, 249, 249,
+    249, 249, 249, 249, 249, 249, 249, 250, 250, 250, 250, 250, 250, 250, 250,
+    250, 250, 250, 250, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251,
+    251, 251, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252,
+    252, 252, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+    253, 253, 253, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+    254, 254, 254, 254, 254, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255,
+};
+#elif QUADRANT_SIZE == 1024 && FAST_SINCOS_TABLE_BITS == 16
+static const uint16_t sineTable[1025] PROGMEM = {
+    0,     101,   201,   302,   402,   503,   603,   704,   804,   905,
+    1005,  1106,  1206,  1307,  1407,  1508,  1608,  1709,  1809,  1910,
+    2010,  2111,  2211,  2312,  2412,  2513,  2613,  2714,  2814,  2914,
+    3015,  3115,  3216,  3316,  3417,  3517,  3617,  3718,  3818,  3918,
+    4019,  4119,  4219,  4320,  4420,  4520,  4621,  4721,  4821,  4921,
+    5022,  5122,  5222,  5322,  5422,  5523,  5623,  5723,  5823,  5923,
+    6023,  6123,  6224,  6324,  6424,  6524,  6624,  6724,  6824,  6924,
+    7024,  7124,  7224,  7323,  7423,  7523,  7623,  7723,  7823,  7923,
+    8022,  8122,  8222,  8322,  8421,  8521,  8621,  8720,  8820,  8919,
+    9019,  9119,  9218,  9318,  9417,  9517,  9616,  9716,  9815,  9914,
+    10014, 10113, 10212, 10312, 10411, 10510, 10609, 10709, 10808, 10907,
+    11006, 11105, 11204, 11303, 11402, 11501, 11600, 11699, 11798, 11897,
+    11996, 12095, 12193, 12292, 12391, 12490, 12588, 12687, 12785, 12884,
+    12983, 13081, 13180, 13278, 13376, 13475, 13573, 13672, 13770, 13868,
+    13966, 14065, 14163, 14261, 14359, 14457, 14555, 14653, 14751, 14849,
+    14947, 15045, 15143, 15240, 15338, 15436, 15534, 15631, 15729, 15826,
+    15924, 16021, 16119, 16216, 16314, 16411, 16508, 16606, 16703, 16800,
+    16897, 16994, 17091, 17188, 17285, 17382, 17479, 17576, 17673, 17770,
+    17867, 17963, 18060, 18156, 18253, 18350, 18446, 18543, 18639, 18735,
+    18832, 18928, 19024, 19120, 19216, 19313, 19409, 19505, 19600, 19696,
+    19792, 19888, 19984, 20080, 20175, 20271, 20366, 20462, 20557, 20653,
+    20748, 20844, 20939, 21034, 21129, 21224, 21320, 21415, 21510, 21604,
+    21699, 21794, 21889, 21984, 22078, 22173, 22268, 22362, 22457, 22551,
+    22645, 22740, 22834, 22928, 23022, 23116, 23210, 23304, 23398, 23492,
+    23586, 23680, 23774, 23867, 23961, 24054, 24148, 24241, 24335, 24428,
+    24521, 24614, 24708, 24801, 24894, 24987, 25080, 25172, 25265, 25358,
+    25451, 25543, 25636, 25728, 25821, 25913, 26005, 26098, 26190, 26282,
+    26374, 26466, 26558, 26650, 26742, 26833, 26925, 27017, 27108, 27200,
+    27291, 27382, 27474, 27565, 27656, 27747, 27838, 27929, 28020, 28111,
+    28202, 28293, 28383, 28474, 28564, 28655, 28745, 28835, 28926, 29016,
+    29106, 29196, 29286, 29376, 29466, 29555, 29645, 29735, 29824, 29914,
+    30003, 30093, 30182, 30271, 30360, 30449, 30538, 30627, 30716, 30805,
+    30893, 30982, 31071, 31159, 31248, 31336, 31424, 31512, 31600, 31688,
+    31776, 31864, 31952, 32040, 32127, 32215, 32303, 32390, 32477, 32565,
+    32652, 32739, 32826, 32913, 33000, 33087, 33173, 33260, 33347, 33433,
+    33520, 33606, 33692, 33778, 33865, 33951, 34037, 34122, 34208, 34294,
+    34380, 34465, 34551, 34636, 34721, 34806, 34892, 34977, 35062, 35146,
+    35231, 35316, 35401, 35485, 35570, 35654, 35738, 35823, 35907, 35991,
+    36075, 36159, 36243, 36326, 36410, 36493, 36577, 36660, 36744, 36827,
+    36910, 36993, 37076, 37159, 37241, 37324, 37407, 37489, 37572, 37654,
+    37736, 37818, 37900, 37982, 38064, 38146, 38228, 38309, 38391, 38472,
+    38554, 38635, 38716, 38797, 38878, 38959, 39040, 39120, 39201, 39282,
+    39362, 39442, 39523, 39603, 39683, 39763, 39843, 39922, 40002, 40082,
+    40161, 40241, 40320, 40399, 40478, 40557, 40636, 40715, 40794, 40872,
+    40951, 41029, 41108, 41186, 41264, 41342, 41420, 41498, 41576, 41653,
+    41731, 41808, 41886, 41963, 42040, 42117, 42194, 42271, 42348, 42424,
+    42501, 42578, 42654, 42730, 42806, 42882, 42958, 43034, 43110, 43186,
+    43261, 43337, 43412, 43487, 43562, 43638, 43713, 43787, 43862, 43937,
+    44011, 44086, 44160, 44234, 44308, 44382, 44456, 44530, 44604, 44677,
+    44751, 44824, 44898, 44971, 45044, 45117, 45190, 45262, 45335, 45408,
+    45480, 45552, 45625, 45697, 45769, 45841, 45912, 45984, 46056, 46127,
+    46199, 46270, 46341, 46412, 46483, 46554, 46624, 46695, 46765, 46836,
+    46906, 46976, 47046, 47116, 47186, 47256, 47325, 47395, 47464, 47534,
+    47603, 47672, 47741, 47809, 47878, 47947, 48015, 48084, 48152, 48220,
+    48288, 48356, 48424, 48491, 48559, 48626, 48694, 48761, 48828, 48895,
+    48962, 49029, 49095, 49162, 49228, 49295, 49361, 49427, 49493, 49559,
+    49624, 49690, 49756, 49821, 49886, 49951, 50016, 50081, 50146, 50211,
+    50275, 50340, 50404, 50468, 50532, 50596, 50660, 50724, 50787, 50851,
+    50914, 50977, 51041, 51104, 51166, 51229, 51292, 51354, 51417, 51479,
+    51541, 51603, 51665, 51727, 51789, 51850, 51911, 51973, 52034, 52095,
+    52156, 52217, 52277, 52338, 52398, 52459, 52519, 52579, 52639, 52699,
+    52759, 52818, 52878, 52937, 52996, 53055, 53114, 53173, 53232, 53290,
+    53349, 53407, 53465, 53523, 53581, 53639, 53697, 53754, 53812, 53869,
+    53926, 53983, 54040, 54097, 54154, 54210, 54267, 54323, 54379, 54435,
+    54491, 54547, 54603, 54658, 54714, 54769, 54824, 54879, 54934, 54989,
+    55043, 55098, 55152, 55206, 55260, 55314, 55368, 55422, 55476, 55529,
+    55582, 55636, 55689, 55742, 55794, 55847, 55900, 55952, 56004, 56056,
+    56108, 56160, 56212, 56264, 56315, 56367, 56418, 56469, 56520, 56571,
+    56621, 56672, 56722, 56773, 56823, 56873, 56923, 56972, 57022, 57072,
+    57121, 57170, 57219, 57268, 57317, 57366, 57414, 57463, 57511, 57559,
+    57607, 57655, 57703, 57750, 57798, 57845, 57892, 57939, 57986, 58033,
+    58079, 58126, 58172, 58219, 58265, 58311, 58356, 58402, 58448, 58493,
+    58538, 58583, 58628, 58673, 58718, 58763, 58807, 58851, 58896, 58940,
+    58983, 59027, 59071, 59114, 59158, 59201, 59244, 59287, 59330, 59372,
+    59415, 59457, 59499, 59541, 59583, 59625, 59667, 59708, 59750, 59791,
+    59832, 59873, 59914, 59954, 59995, 60035, 60075, 60116, 60156, 60195,
+    60235, 60275, 60314, 60353, 60392, 60431, 60470, 60509, 60547, 60586,
+    60624, 60662, 60700, 60738, 60776, 60813, 60851, 60888, 60925, 60962,
+    60999, 61035, 61072, 61108, 61145, 61181, 61217, 61253, 61288, 61324,
+    61359, 61394, 61429, 61464, 61499, 61534, 61568, 61603, 61637, 61671,
+    61705, 61739, 61772, 61806, 61839, 61873, 61906, 61939, 61971, 62004,
+    62036, 62069, 62101, 62133, 62165, 62197, 62228, 62260, 62291, 62322,
+    62353, 62384, 62415, 62445, 62476, 62506, 62536, 62566, 62596, 62626,
+    62655, 62685, 62714, 62743, 62772, 62801, 62830, 62858, 62886, 62915,
+    62943, 62971, 62998, 63026, 63054, 63081, 63108, 63135, 63162, 63189,
+    63215, 63242, 63268, 63294, 63320, 63346, 63372, 63397, 63423, 63448,
+    63473, 63498, 63523, 63547, 63572, 63596, 63621, 63645, 63668, 63692,
+    63716, 63739, 63763, 63786, 63809, 63832, 63854, 63877, 63899, 63922,
+    63944, 63966, 63987, 64009, 64031, 64052, 64073, 64094, 64115, 64136,
+    64156, 64177, 64197, 64217, 64237, 64257, 64277, 64296, 64316, 64335,
+    64354, 64373, 64392, 64410, 64429, 64447, 64465, 64483, 64501, 64519,
+    64536, 64554, 64571, 64588, 64605, 64622, 64639, 64655, 64672, 64688,
+    64704, 64720, 64735, 64751, 64766, 64782, 64797, 64812, 64827, 64841,
+    64856, 64870, 64884, 64899, 64912, 64926, 64940, 64953, 64967, 64980,
+    64993, 65006, 65018, 65031, 65043, 65055, 65067, 65079, 65091, 65103,
+    65114, 65126, 65137, 65148, 65159, 65169, 65180, 65190, 65200, 65210,
+    65220, 65230, 65240, 65249, 65259, 65268, 65277, 65286, 65294, 65303,
+    65311, 65320, 65328, 65336, 65343, 65351, 65358, 65366, 65373, 65380,
+    65387, 65393, 65400, 65406, 65413, 65419, 65425, 65430, 65436, 65442,
+    65447, 65452, 65457, 65462, 65467, 65471, 65476, 65480, 65484, 65488,
+    65492, 65495, 65499, 65502, 65505, 65508, 65511, 65514, 65516, 65519,
+    65521, 65523, 65525, 65527, 65528, 65530, 65531, 65532, 65533, 65534,
+    65535, 65535, 65535, 65535, 65535,
+};
+#elif QUADRANT_SIZE == 1024 && FAST_SINCOS_TABLE_BITS == 32
+static const uint32_t sineTable[1025] PROGMEM = {
+    0,          6588395,    13176774,   19765122,   26353424,   32941664,
+    39529826,   46117895,   52705856,   59293692,   65881389,   72468931,
+    79056303,   85643488,   92230472,   98817239,   105403774,  111990060,
+    118576083,  125161827,  131747276,  138332416,  144917230,  151501702,
+    158085819,  164669563,  171252920,  177835874,  184418409,  191000511,
+    197582163,  204163350,  210744057,  217324267,  223903967,  230483139,
+    237061769,  243639842,  250217341,  256794251,  263370557,  269946243,
+    276521294,  283095695,  289669429,  296242481,  302814837,  309386480,
+    315957395,  322527566,  329096979,  335665617,  342233465,  348800508,
+    355366730,  361932116,  368496651,  375060318,  381623102,  388184989,
+    394745962,  401306007,  407865107,  414423247,  420980412,  427536587,
+    434091755,  440645902,  447199012,  453751070,  460302060,  466851967,
+    473400776,  479948470,  486495035,  493040456,  499584716,  506127800,
+    512669694,  519210381,  525749847,  532288075,  538825051,  545360759,
+    551895183,  558428309,  564960121,  571490604,  578019742,  584547519,
+    591073921,  597598933,  604122538,  610644721,  617165468,  623684762,
+    630202589,  636718933,  643233779,  649747111,  656258914,  662769172,
+    669277872,  675784996,  682290530,  688794459,  695296767,  701797439,
+    708296459,  714793813,  721289485,  727783459,  734275721,  740766255,
+    747255046,  753742079,  760227338,  766710808,  773192474,  779672321,
+    786150333,  792626495,  799100792,  805573208,  812043729,  818512339,
+    824979024,  831443766,  837906553,  844367368,  850826195,  857283021,
+    863737830,  870190606,  876641334,  883090000,  889536587,  895981082,
+    902423468,  908863731,  915301854,  921737825,  928171626,  934603243,
+    941032661,  947459865,  953884839,  960307568,  966728038,  973146233,
+    979562138,  985975738,  992387019,  998795963,  1005202558, 1011606787,
+    1018008636, 1024408090, 1030805132, 1037199750, 1043591926, 1049981647,
+    1056368897, 1062753662, 1069135926, 1075515674, 1081892891, 1088267562,
+    1094639673, 1101009208, 1107376152, 1113740490, 1120102207, 1126461289,
+    1132817720, 1139171486, 1145522571, 1151870960, 1158216639, 1164559593,
+    1170899806, 1177237264, 1183571952, 1189903854, 1196232957, 1202559245,
+    1208882703, 1215203317, 1221521071, 1227835951, 1234147941, 1240457028,
+    1246763195, 1253066429, 1259366714, 1265664036, 1271958380, 1278249730,
+    1284538073, 1290823393, 1297105676, 1303384906, 1309661069, 1315934151,
+    1322204136, 1328471010, 1334734758, 1340995365, 1347252816, 1353507098,
+    1359758194, 1366006091, 1372250773, 1378492227, 1384730436, 1390965388,
+    1397197066, 1403425456, 1409650544, 1415872315, 1422090755, 1428305848,
+    1434517580, 1440725936, 1446930903, 1453132464, 1459330606, 1465525315,
+    1471716574, 1477904371, 1484088690, 1490269517, 1496446837, 1502620636,
+    1508790899, 1514957611, 1521120759, 1527280328, 1533436302, 1539588668,
+    1545737412, 1551882518, 1558023973, 1564161761, 1570295869, 1576426281,
+    1582552984, 1588675964, 1594795204, 1600910693, 1607022414, 1613130353,
+    1619234497, 1625334831, 1631431340, 1637524010, 1643612827, 1649697776,
+    1655778843, 1661856014, 1667929275, 1673998611, 1680064008, 1686125451,
+    1692182927, 1698236421, 1704285919, 1710331406, 1716372869, 1722410293,
+    1728443664, 1734472968, 1740498191, 1746519318, 1752536335, 1758549228,
+    1764557983, 1770562587, 1776563023, 1782559280, 1788551342, 1794539195,
+    1800522825, 1806502219, 1812477362, 1818448240, 1824414839, 1830377145,
+    1836335144, 1842288821, 1848238164, 1854183158, 1860123788, 1866060042,
+    1871991904, 1877919361, 1883842400, 1889761006, 1895675165, 1901584863,
+    1907490086, 1913390821, 1919287054, 1925178771, 1931065957, 1936948599,
+    1942826684, 1948700196, 1954569124, 1960433452, 1966293167, 1972148255,
+    1977998702, 1983844495, 1989685620, 1995522063, 2001353810, 2007180848,
+    2013003163, 2018820741, 2024633568, 2030441631, 2036244917, 2042043411,
+    2047837100, 2053625970, 2059410008, 2065189200, 2070963532, 2076732991,
+    2082497563, 2088257235, 2094011993, 2099761824, 2105506713, 2111246649,
+    2116981616, 2122711602, 2128436593, 2134156575, 2139871536, 2145581461,
+    2151286337, 2156986152, 2162680890, 2168370540, 2174055087, 2179734519,
+    2185408821, 2191077981, 2196741986, 2202400821, 2208054473, 2213702930,
+    2219346178, 2224984203, 2230616993, 2236244534, 2241866812, 2247483816,
+    2253095531, 2258701944, 2264303042, 2269898812, 2275489241, 2281074316,
+    2286654023, 2292228349, 2297797281, 2303360806, 2308918911, 2314471584,
+    2320018810, 2325560576, 2331096871, 2336627680, 2342152991, 2347672791,
+    2353187066, 2358695804, 2364198992, 2369696616, 2375188665, 2380675124,
+    2386155981, 2391631224, 2397100839, 2402564813, 2408023134, 2413475788,
+    2418922764, 2424364047, 2429799626, 2435229487, 2440653617, 2446072005,
+    2451484637, 2456891500, 2462292582, 2467687870, 2473077351, 2478461013,
+    2483838842, 2489210827, 2494576955, 2499937213, 2505291588, 2510640068,
+    2515982640, 2521319292, 2526650010, 2531974784, 2537293599, 2542606444,
+    2547913306, 2553214173, 2558509031, 2563797869, 2569080674, 2574357434,
+    2579628136, 2584892768, 2590151318, 2595403773, 2600650120, 2605890348,
+    2611124444, 2616352396, 2621574191, 2626789817, 2631999263, 2637202515,
+    2642399561, 2647590390, 2652774988, 2657953344, 2663125446, 2668291281,
+    2673450838, 2678604104, 2683751066, 2688891714, 2694026034, 2699154015,
+    2704275644, 2709390911, 2714499801, 2719602305, 2724698408, 2729788101,
+    2734871369, 2739948203, 2745018589, 2750082515, 2755139971, 2760190943,
+    2765235421, 2770273391, 2775304843, 2780329764, 2785348143, 2790359968,
+    2795365227, 2800363908, 2805355999, 2810341489, 2815320366, 2820292619,
+    2825258235, 2830217203, 2835169511, 2840115147, 2845054101, 2849986360,
+    2854911913, 2859830747, 2864742853, 2869648217, 2874546829, 2879438676,
+    2884323748, 2889202033, 2894073520, 2898938196, 2903796051, 2908647073,
+    2913491250, 2918328572, 2923159027, 2927982603, 2932799290, 2937609075,
+    2942411948, 2947207897, 2951996911, 2956778979, 2961554089, 2966322230,
+    2971083391, 2975837561, 2980584729, 2985324883, 2990058012, 2994784105,
+    2999503152, 3004215140, 3008920059, 3013617897, 3018308645, 3022992289,
+    3027668821, 3032338228, 3037000500, 3041655625, 3046303593, 3050944393,
+    3055578014, 3060204445, 3064823674, 3069435692, 3074040487, 3078638049,
+    3083228366, 3087811428, 3092387225, 3096955744, 3101516976, 3106070910,
+    3110617535, 3115156841, 3119688816, 3124213451, 3128730733, 3133240654,
+    3137743202, 3142238366, 3146726136, 3151206502, 3155679453, 3160144978,
+    3164603066, 3169053709, 3173496894, 3177932612, 3182360851, 3186781603,
+    3191194855, 3195600598, 3199998822, 3204389516, 3208772670, 3213148273,
+    3217516315, 3221876786, 3226229675, 3230574973, 3234912670, 3239242754,
+    3243565216, 3247880045, 3252187232, 3256486766, 3260778637, 3265062836,
+    3269339351, 3273608174, 3277869293, 3282122699, 3286368382, 3290606332,
+    3294836538, 3299058992, 3303273682, 3307480600, 3311679735, 3315871077,
+    3320054617, 3324230344, 3328398249, 3332558322, 3336710553, 3340854932,
+    3344991450, 3349120097, 3353240863, 3357353739, 3361458715, 3365555780,
+    3369644927, 3373726144, 3377799422, 3381864752, 3385922125, 3389971529,
+    3394012957, 3398046399, 3402071844, 3406089285, 3410098710, 3414100111,
+    3418093478, 3422078802, 3426056074, 3430025284, 3433986423, 3437939481,
+    3441884449, 3445821319, 3449750080, 3453670723, 3457583240, 3461487620,
+    3465383855, 3469271936, 3473151854, 3477023598, 3480887161, 3484742533,
+    3488589706, 3492428669, 3496259414, 3500081932, 3503896214, 3507702251,
+    3511500034, 3515289554, 3519070803, 3522843770, 3526608449, 3530364828,
+    3534112901, 3537852657, 3541584088, 3545307186, 3549021941, 3552728345,
+    3556426389, 3560116064, 3563797363, 3567470275, 3571134792, 3574790907,
+    3578438609, 3582077892, 3585708745, 3589331160, 3592945130, 3596550645,
+    3600147697, 3603736278, 3607316378, 3610887990, 3614451106, 3618005716,
+    3621551813, 3625089388, 3628618433, 3632138939, 3635650898, 3639154303,
+    3642649144, 3646135414, 3649613104, 3653082206, 3656542712, 3659994613,
+    3663437903, 3666872572, 3670298613, 3673716017, 3677124776, 3680524883,
+    3683916329, 3687299106, 3690673207, 3694038624, 3697395348, 3700743371,
+    3704082687, 3707413286, 3710735162, 3714048305, 3717352710, 3720648367,
+    3723935269, 3727213408, 3730482776, 3733743367, 3736995171, 3740238183,
+    3743472393, 3746697794, 3749914379, 3753122140, 3756321069, 3759511160,
+    3762692404, 3765864794, 3769028322, 3772182982, 3775328765, 3778465665,
+    3781593674, 3784712784, 3787822988, 3790924279, 3794016650, 3797100093,
+    3800174601, 3803240167, 3806296784, 3809344444, 3812383140, 3815412866,
+    3818433613, 3821445375, 3824448145, 3827441916, 3830426680, 3833402431,
+    3836369162, 3839326865, 3842275534, 3845215161, 3848145741, 3851067265,
+    3853979728, 3856883122, 3859777440, 3862662676, 3865538822, 3868405873,
+    3871263820, 3874112659, 3876952381, 3879782980, 3882604450, 3885416784,
+    3888219974, 3891014016, 3893798902, 3896574625, 3899341179, 3902098557,
+    3904846754, 3907585762, 3910315575, 3913036187, 3915747591, 3918449781,
+    3921142750, 3923826493, 3926501002, 3929166272, 3931822297, 3934469069,
+    3937106583, 3939734833, 3942353812, 3944963515, 3947563934, 3950155065,
+    3952736900, 3955309435, 3957872662, 3960426576, 3962971170, 3965506439,
+    3968032378, 3970548979, 3973056236, 3975554145, 3978042699, 3980521892,
+    3982991719, 3985452174, 3987903250, 3990344942, 3992777245, 3995200152,
+    3997613658, 4000017757, 4002412444, 4004797713, 4007173558, 4009539974,
+    4011896955, 4014244496, 4016582591, 4018911234, 4021230421, 4023540145,
+    4025840401, 4028131185, 4030412489, 4032684310, 4034946641, 4037199478,
+    4039442815, 4041676647, 4043900968, 4046115773, 4048321058, 4050516816,
+    4052703044, 4054879734, 4057046884, 4059204486, 4061352537, 4063491032,
+    4065619964, 4067739330, 4069849124, 4071949341, 4074039976, 4076121025,
+    4078192482, 4080254343, 4082306603, 4084349257, 4086382299, 4088405726,
+    4090419533, 4092423715, 4094418266, 4096403184, 4098378461, 4100344095,
+    4102300081, 4104246413, 4106183088, 4108110101, 4110027446, 4111935121,
+    4113833119, 4115721438, 4117600071, 4119469016, 4121328267, 4123177820,
+    4125017671, 4126847815, 4128668249, 4130478967, 4132279966, 4134071241,
+    4135852789, 4137624604, 4139386683, 4141139022, 4142881616, 4144614462,
+    4146337555, 4148050891, 4149754467, 4151448277, 4153132319, 4154806588,
+    4156471081, 4158125793, 4159770720, 4161405860, 4163031206, 4164646757,
+    4166252509, 4167848456, 4169434596, 4171010925, 4172577440, 4174134136,
+    4175681009, 4177218057, 4178745276, 4180262661, 4181770210, 4183267919,
+    4184755784, 4186233802, 4187701970, 4189160283, 4190608739, 4192047334,
+    4193476065, 4194894928, 4196303920, 4197703038, 4199092278, 4200471637,
+    4201841112, 4203200700, 4204550397, 4205890201, 4207220108, 4208540114,
+    4209850218, 4211150416, 4212440704, 4213721080, 4214991540, 4216252083,
+    4217502704, 4218743401, 4219974170, 4221195010, 4222405917, 4223606888,
+    4224797921, 4225979012, 4227150159, 4228311359, 4229462610, 4230603908,
+    4231735252, 4232856637, 4233968062, 4235069525, 4236161021, 4237242550,
+    4238314108, 4239375693, 4240427302, 4241468933, 4242500584, 4243522251,
+    4244533933, 4245535628, 4246527332, 4247509043, 4248480760, 4249442480,
+    4250394200, 4251335919, 4252267634, 4253189343, 4254101044, 4255002735,
+    4255894413, 4256776076, 4257647723, 4258509352, 4259360959, 4260202544,
+    4261034104, 4261855638, 4262667143, 4263468618, 4264260060, 4265041468,
+    4265812840, 4266574174, 4267325469, 4268066722, 4268797931, 4269519096,
+    4270230215, 4270931285, 4271622305, 4272303274, 4272974189, 4273635050,
+    4274285855, 4274926601, 4275557289, 4276177915, 4276788480, 4277388980,
+    4277979416, 4278559785, 4279130086, 4279690318, 4280240479, 4280780569,
+    4281310585, 4281830528, 4282340394, 4282840184, 4283329896, 4283809529,
+    4284279082, 4284738553, 4285187942, 4285627247, 4286056468, 4286475604,
+    4286884652, 4287283614, 4287672487, 4288051271, 4288419964, 4288778567,
+    4289127078, 4289465495, 4289793820, 4290112050, 4290420185, 4290718224,
+    4291006167, 4291284012, 4291551760, 4291809410, 4292056960, 4292294411,
+    4292521761, 4292739011, 4292946160, 4293143206, 4293330151, 4293506993,
+    4293673732, 4293830368, 4293976900, 4294113327, 4294239650, 4294355869,
+    4294461982, 4294557990, 4294643893, 4294719690, 4294785381, 4294840966,
+    4294886444, 4294921817, 4294947083, 4294962243, 4294967295,
+};
+#elif QUADRANT_SIZE == 2048 && FAST_SINCOS_TABLE_BITS == 8
+static const uint8_t sineTable[2049] PROGMEM = {
+    0,   0,   0,   1,   1,   1,   1,   1,   2,   2,   2,   2,   2,   3,   3,
+    3,   3,   3,   4,   4,   4,   4,   4,   5,   5,   5,   5,   5,   5,   6,
+    6,   6,   6,   6,   7,   7,   7,   7,   7,   8,   8,   8,   8,   8,   9,
+    9,   9,   9,   9,   10,  10,  10,  10,  10,  11,  11,  11,  11,  11,  12,
+    12,  12,  12,  12,  13,  13,  13,  13,  13,  14,  14,  14,  14,  14,  15,
+    15,  15,  15,  15,  16,  16,  16,  16,  16,  16,  17,  17,  17,  17,  17,
+    18,  18,  18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,
+    21,  21,  21,  21,  21,  22,  22,  22,  22,  22,  23,  23,  23,  23,  23,
+    24,  24,  24,  24,  24,  25,  25,  25,  25,  25,  25,  26,  26,  26,  26,
+    26,  27,  27,  27,  27,  27,  28,  28,  28,  28,  28,  29,  29,  29,  29,
+    29,  30,  30,  30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,
+    32,  33,  33,  33,  33,  33,  33,  34,  34,  34,  34,  34,  35,  35,  35,
+    35,  35,  36,  36,  36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,
+    38,  38,  39,  39,  39,  39,  39,  40,  40,  40,  40,  40,  40,  41,  41,
+    41,  41,  41,  42,  42,  42,  42,  42,  43,  43,  43,  43,  43,  44,  44,
+    44,  44,  44,  45,  45,  45,  45,  45,  46,  46,  46,  46,  46,  46,  47,
+    47,  47,  47,  47,  48,  48,  48,  48,  48,  49,  49,  49,  49,  49,  50,
+    50,  50,  50,  50,  51,  51,  51,  51,  51,  51,  52,  52,  52,  52,  52,
+    53,  53,  53,  53,  53,  54,  54,  54,  54,  54,  55,  55,  55,  55,  55,
+    56,  56,  56,  56,  56,  56,  57,  57,  57,  57,  57,  58,  58,  58,  58,
+    58,  59,  59,  59,  59,  59,  60,  60,  60,  60,  60,  60,  61,  61,  61,
+    61,  61,  62,  62,  62,  62,  62,  63,  63,  63,  63,  63,  64,  64,  64,
+    64,  64,  64,  65,  65,  65,  65,  65,  66,  66,  66,  66,  66,  67,  67,
+    67,  67,  67,  68,  68,  68,  68,  68,  68,  69,  69,  69,  69,  69,  70,
+    70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  72,  72,  72,  72,  72,
+    73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,  75,  75,
+    75,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  78,  78,  78,  78,
+    78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  80,  81,  81,
+    81,  81,  81,  82,  82,  82,  82,  82,  83,  83,  83,  83,  83,  83,  84,
+    84,  84,  84,  84,  85,  85,  85,  85,  85,  86,  86,  86,  86,  86,  86,
+    87,  87,  87,  87,  87,  88,  88,  88,  88,  88,  88,  89,  89,  89,  89,
+    89,  90,  90,  90,  90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,
+    92,  92,  92,  93,  93,  93,  93,  93,  94,  94,  94,  94,  94,  95,  95,
+    95,  95,  95,  95,  96,  96,  96,  96,  96,  97,  97,  97,  97,  97,  97,
+    98,  98,  98,  98,  98,  99,  99,  99,  99,  99,  99,  100, 100, 100, 100,
+    100, 101, 101, 101, 101, 101, 101, 102, 102, 102, 102, 102, 102, 103, 103,
+    103, 103, 103, 104, 104, 104, 104, 104, 104, 105, 105, 105, 105, 105, 106,
+    106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 108, 108, 108, 108,
+    108, 109, 109, 109, 109, 109, 109, 110, 110, 110, 110, 110, 111, 111, 111,
+    111, 111, 111, 112, 112, 112, 112, 112, 112, 113, 113, 113, 113, 113, 114,
+    114, 114, 114, 114, 114, 115, 115, 115, 115, 115, 115, 116, 116, 116, 116,
+    116, 117, 117, 117, 117, 117, 117, 118, 118, 118, 118, 118, 118, 119, 119,
+    119, 119, 119, 119, 120, 120, 120, 120, 120, 121, 121, 121, 121, 121, 121,
+    122, 122, 122, 122, 122, 122, 123, 123, 123, 123, 123, 123, 124, 124, 124,
+    124, 124, 124, 125, 125, 125, 125, 125, 125, 126, 126, 126, 126, 126, 127,
+    127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 128, 129, 129, 129, 129,
+    129, 129, 130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 132,
+    132, 132, 132, 132, 132, 133, 133, 133, 133, 133, 133, 134, 134, 134, 134,
+    134, 134, 135, 135, 135, 135, 135, 135, 136, 136, 136, 136, 136, 136, 137,
+    137, 137, 137, 137, 137, 138, 138, 138, 138, 138, 138, 139, 139, 139, 139,
+    139, 139, 140, 140, 140, 140, 140, 140, 141, 141, 141, 141, 141, 141, 142,
+    142, 142, 142, 142, 142, 143, 143, 143, 143, 143, 143, 144, 144, 144, 144,
+    144, 144, 145, 145, 145, 145, 145, 145, 145, 146, 146, 146, 146, 146, 146,
+    147, 147, 147, 147, 147, 147, 148, 148, 148, 148, 148, 148, 149, 149, 149,
+    149, 149, 149, 149, 150, 150, 150, 150, 150, 150, 151, 151, 151, 151, 151,
+    151, 152, 152, 152, 152, 152, 152, 152, 153, 153, 153, 153, 153, 153, 154,
+    154, 154, 154, 154, 154, 155, 155, 155, 155, 155, 155, 155, 156, 156, 156,
+    156, 156, 156, 157, 157, 157, 157, 157, 157, 157, 158, 158, 158, 158, 158,
+    158, 159, 159, 159, 159, 159, 159, 160, 160, 160, 160, 160, 160, 160, 161,
+    161, 161, 161, 161, 161, 161, 162, 162, 162, 162, 162, 162, 163, 163, 163,
+    163, 163, 163, 163, 164, 164, 164, 164, 164, 164, 165, 165, 165, 165, 165,
+    165, 165, 166, 166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167,
+    168, 168, 168, 168, 168, 168, 168, 169, 169, 169, 169, 169, 169, 169, 170,
+    170, 170, 170, 170, 170, 170, 171, 171, 171, 171, 171, 171, 171, 172, 172,
+    172, 172, 172, 172, 173, 173, 173, 173, 173, 173, 173, 174, 174, 174, 174,
+    174, 174, 174, 175, 175, 175, 175, 175, 175, 175, 176, 176, 176, 176, 176,
+    176, 176, 177, 177, 177, 177, 177, 177, 177, 178, 178, 178, 178, 178, 178,
+    178, 179, 179, 179, 179, 179, 179, 179, 179, 180, 180, 180, 180, 180, 180,
+    180, 181, 181, 181, 181, 181, 181, 181, 182, 182, 182, 182, 182, 182, 182,
+    183, 183, 183, 183, 183, 183, 183, 184, 184, 184, 184, 184, 184, 184, 184,
+    185, 185, 185, 185, 185, 185, 185, 186, 186, 186, 186, 186, 186, 186, 186,
+    187, 187, 187, 187, 187, 187, 187, 188, 188, 188, 188, 188, 188, 188, 188,
+    189, 189, 189, 189, 189, 189, 189, 190, 190, 190, 190, 190, 190, 190, 190,
+    191, 191, 191, 191, 191, 191, 191, 192, 192, 192, 192, 192, 192, 192, 192,
+    193, 193, 193, 193, 193, 193, 193, 193, 194, 194, 194, 194, 194, 194, 194,
+    194, 195, 195, 195, 195, 195, 195, 195, 196, 196, 196, 196, 196, 196, 196,
+    196, 197, 197, 197, 197, 197, 197, 197, 197, 198, 198, 198, 198, 198, 198,
+    198, 198, 199, 199, 199, 199, 199, 199, 199, 199, 200, 200, 200, 200, 200,
+    200, 200, 200, 200, 201, 201, 201, 201, 201, 201, 201, 201, 202, 202, 202,
+    202, 202, 202, 202, 202, 203, 203, 203, 203, 203, 203, 203, 203, 203, 204,
+    204, 204, 204, 204, 204, 204, 204, 205, 205, 205, 205, 205, 205, 205, 205,
+    206, 206, 206, 206, 206, 206, 206, 206, 206, 207, 207, 207, 207, 207, 207,
+    207, 207, 207, 208, 208, 208, 208, 208, 208, 208, 208, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 210, 210, 210, 210, 210, 210, 210, 210, 210, 211,
+    211, 211, 211, 211, 211, 211, 211, 211, 212, 212, 212, 212, 212, 212, 212,
+    212, 212, 213, 213, 213, 213, 213, 213, 213, 213, 213, 214, 214, 214, 214,
+    214, 214, 214, 214, 214, 214, 215, 215, 215, 215, 215, 215, 215, 215, 215,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 217, 217, 217, 217, 217,
+    217, 217, 217, 217, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 219,
+    219, 219, 219, 219, 219, 219, 219, 219, 219, 220, 220, 220, 220, 220, 220,
+    220, 220, 220, 220, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 222,
+    222, 222, 222, 222, 222, 222, 222, 222, 222, 223, 223, 223, 223, 223, 223,
+    223, 223, 223, 223, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224,
+    225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 226, 226, 226, 226,
+    226, 226, 226, 226, 226, 226, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+    227, 227, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 229,
+    229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 231, 231, 231, 231, 231, 231, 231, 231,
+    231, 231, 231, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232,
+    233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 235, 235, 235, 235, 235,
+    235, 235, 235, 235, 235, 235, 235, 235, 236, 236, 236, 236, 236, 236, 236,
+    236, 236, 236, 236, 236, 236, 237, 237, 237, 237, 237, 237, 237, 237, 237,
+    237, 237, 237, 237, 237, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238,
+    238, 238, 238, 238, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239,
+    239, 239, 239, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240,
+    240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+    241, 241, 241, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242,
+    242, 242, 242, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243,
+    243, 243, 243, 243, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+    244, 244, 244, 244, 244, 244, 245, 245, 245, 245, 245, 245, 245, 245, 245,
+    245, 245, 245, 245, 245, 245, 245, 245, 245, 246, 246, 246, 246, 246, 246,
+    246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
+    248, 248, 248, 248, 248, 248, 248, 249, 249, 249, 249, 249, 249, 249, 249,
+    249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 250,
+    250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250,
+    250, 250, 250, 250, 250, 250, 250, 250, 251, 251, 251, 251, 251, 251, 251,
+    251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251,
+    251, 251, 251, 251, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252,
+    252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252,
+    252, 252, 252, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+    253, 253, 253, 253, 253, 253, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+    254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+    254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+    254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255,
+};
+#elif QUADRANT_SIZE == 2048 && FAST_SINCOS_TABLE_BITS == 16
+static const uint16_t sineTable[2049] PROGMEM = {
+    0,     50,    101,   151,   201,   251,   302,   352,   402,   452,
+    503,   553,   603,   653,   704,   754,   804,   854,   905,   955,
+    1005,  1056,  1106,  1156,  1206,  1257,  1307,  1357,  1407,  1458,
+    1508,  1558,  1608,  1659,  1709,  1759,  1809,  1860,  1910,  1960,
+    2010,  2061,  2111,  2161,  2211,  2261,  2312,  2362,  2412,  2462,
+    2513,  2563,  2613,  2663,  2714,  2764,  2814,  2864,  2914,  2965,
+    3015,  3065,  3115,  3165,  3216,  3266,  3316,  3366,  3417,  3467,
+    3517,  3567,  3617,  3667,  3718,  3768,  3818,  3868,  3918,  3969,
+    4019,  4069,  4119,  4169,  4219,  4270,  4320,  4370,  4420,  4470,
+    4520,  4570,  4621,  4671,  4721,  4771,  4821,  4871,  4921,  4972,
+    5022,  5072,  5122,  5172,  5222,  5272,  5322,  5372,  5422,  5473,
+    5523,  5573,  5623,  5673,  5723,  5773,  5823,  5873,  5923,  5973,
+    6023,  6073,  6123,  6173,  6224,  6274,  6324,  6374,  6424,  6474,
+    6524,  6574,  6624,  6674,  6724,  6774,  6824,  6874,  6924,  6974,
+    7024,  7074,  7124,  7174,  7224,  7273,  7323,  7373,  7423,  7473,
+    7523,  7573,  7623,  7673,  7723,  7773,  7823,  7873,  7923,  7972,
+    8022,  8072,  8122,  8172,  8222,  8272,  8322,  8371,  8421,  8471,
+    8521,  8571,  8621,  8670,  8720,  8770,  8820,  8870,  8919,  8969,
+    9019,  9069,  9119,  9168,  9218,  9268,  9318,  9367,  9417,  9467,
+    9517,  9566,  9616,  9666,  9716,  9765,  9815,  9865,  9914,  9964,
+    10014, 10063, 10113, 10163, 10212, 10262, 10312, 10361, 10411, 10461,
+    10510, 10560, 10609, 10659, 10709, 10758, 10808, 10857, 10907, 10956,
+    11006, 11056, 11105, 11155, 11204, 11254, 11303, 11353, 11402, 11452,
+    11501, 11551, 11600, 11650, 11699, 11749, 11798, 11847, 11897, 11946,
+    11996, 12045, 12095, 12144, 12193, 12243, 12292, 12341, 12391, 12440,
+    12490, 12539, 12588, 12638, 12687, 12736, 12785, 12835, 12884, 12933,
+    12983, 13032, 13081, 13130, 13180, 13229, 13278, 13327, 13376, 13426,
+    13475, 13524, 13573, 13622, 13672, 13721, 13770, 13819, 13868, 13917,
+    13966, 14016, 14065, 14114, 14163, 14212, 14261, 14310, 14359, 14408,
+    14457, 14506, 14555, 14604, 14653, 14702, 14751, 14800, 14849, 14898,
+    14947, 14996, 15045, 15094, 15143, 15192, 15240, 15289, 15338, 15387,
+    15436, 15485, 15534, 15582, 15631, 15680, 15729, 15778, 15826, 15875,
+    15924, 15973, 16021, 16070, 16119, 16168, 16216, 16265, 16314, 16362,
+    16411, 16460, 16508, 16557, 16606, 16654, 16703, 16751, 16800, 16849,
+    16897, 16946, 16994, 17043, 17091, 17140, 17188, 17237, 17285, 17334,
+    17382, 17431, 17479, 17528, 17576, 17625, 17673, 17721, 17770, 17818,
+    17867, 17915, 17963, 18012, 18060, 18108, 18156, 18205, 18253, 18301,
+    18350, 18398, 18446, 18494, 18543, 18591, 18639, 18687, 18735, 18783,
+    18832, 18880, 18928, 18976, 19024, 19072, 19120, 19168, 19216, 19264,
+    19313, 19361, 19409, 19457, 19505, 19553, 19600, 19648, 19696, 19744,
+    19792, 19840, 19888, 19936, 19984, 20032, 20080, 20127, 20175, 20223,
+    20271, 20319, 20366, 20414, 20462, 20510, 20557, 20605, 20653, 20701,
+    20748, 20796, 20844, 20891, 20939, 20987, 21034, 21082, 21129, 21177,
+    21224, 21272, 21320, 21367, 21415, 21462, 21510, 21557, 21604, 21652,
+    21699, 21747, 21794, 21842, 21889, 21936, 21984, 22031, 22078, 22126,
+    22173, 22220, 22268, 22315, 22362, 22409, 22457, 22504, 22551, 22598,
+    22645, 22693, 22740, 22787, 22834, 22881, 22928, 22975, 23022, 23069,
+    23116, 23163, 23210, 23257, 23304, 23351, 23398, 23445, 23492, 23539,
+    23586, 23633, 23680, 23727, 23774, 23820, 23867, 23914, 23961, 24008,
+    24054, 24101, 24148, 24195, 24241, 24288, 24335, 24381, 24428, 24475,
+    24521, 24568, 24614, 24661, 24708, 24754, 24801, 24847, 24894, 24940,
+    24987, 25033, 25080, 25126, 25172, 25219, 25265, 25312, 25358, 25404,
+    25451, 25497, 25543, 25589, 25636, 25682, 25728, 25774, 25821, 25867,
+    25913, 25959, 26005, 26051, 26098, 26144, 26190, 26236, 26282, 26328,
+    26374, 26420, 26466, 26512, 26558, 26604, 26650, 26696, 26742, 26787,
+    26833, 26879, 26925, 26971, 27017, 27062, 27108, 27154, 27200, 27245,
+    27291, 27337, 27382, 27428, 27474, 27519, 27565, 27611, 27656, 27702,
+    27747, 27793, 27838, 27884, 27929, 27975, 28020, 28066, 28111, 28156,
+    28202, 28247, 28293, 28338, 28383, 28429, 28474, 28519, 28564, 28610,
+    28655, 28700, 28745, 28790, 28835, 28881, 28926, 28971, 29016, 29061,
+    29106, 29151, 29196, 29241, 29286, 29331, 29376, 29421, 29466, 29511,
+    29555, 29600, 29645, 29690, 29735, 29780, 29824, 29869, 29914, 29959,
+    30003, 30048, 30093, 30137, 30182, 30226, 30271, 30316, 30360, 30405,
+    30449, 30494, 30538, 30583, 30627, 30672, 30716, 30760, 30805, 30849,
+    30893, 30938, 30982, 31026, 31071, 31115, 31159, 31203, 31248, 31292,
+    31336, 31380, 31424, 31468, 31512, 31556, 31600, 31644, 31688, 31732,
+    31776, 31820, 31864, 31908, 31952, 31996, 32040, 32084, 32127, 32171,
+    32215, 32259, 32303, 32346, 32390, 32434, 32477, 32521, 32565, 32608,
+    32652, 32695, 32739, 32783, 32826, 32870, 32913, 32956, 33000, 33043,
+    33087, 33130, 33173, 33217, 33260, 33303, 33347, 33390, 33433, 33476,
+    33520, 33563, 33606, 33649, 33692, 33735, 33778, 33821, 33865, 33908,
+    33951, 33994, 34037, 34079, 34122, 34165, 34208, 34251, 34294, 34337,
+    34380, 34422, 34465, 34508, 34551, 34593, 34636, 34679, 34721, 34764,
+    34806, 34849, 34892, 34934, 34977, 35019, 35062, 35104, 35146, 35189,
+    35231, 35274, 35316, 35358, 35401, 35443, 35485, 35527, 35570, 35612,
+    35654, 35696, 35738, 35781, 35823, 35865, 35907, 35949, 35991, 36033,
+    36075, 36117, 36159, 36201, 36243, 36284, 36326, 36368, 36410, 36452,
+    36493, 36535, 36577, 36619, 36660, 36702, 36744, 36785, 36827, 36868,
+    36910, 36951, 36993, 37034, 37076, 37117, 37159, 37200, 37241, 37283,
+    37324, 37365, 37407, 37448, 37489, 37530, 37572, 37613, 37654, 37695,
+    37736, 37777, 37818, 37859, 37900, 37941, 37982, 38023, 38064, 38105,
+    38146, 38187, 38228, 38269, 38309, 38350, 38391, 38432, 38472, 38513,
+    38554, 38594, 38635, 38675, 38716, 38757, 38797, 38838, 38878, 38919,
+    38959, 38999, 39040, 39080, 39120, 39161, 39201, 39241, 39282, 39322,
+    39362, 39402, 39442, 39482, 39523, 39563, 39603, 39643, 39683, 39723,
+    39763, 39803, 39843, 39882, 39922, 39962, 40002, 40042, 40082, 40121,
+    40161, 40201, 40241, 40280, 40320, 40359, 40399, 40439, 40478, 40518,
+    40557, 40597, 40636, 40675, 40715, 40754, 40794, 40833, 40872, 40912,
+    40951, 40990, 41029, 41068, 41108, 41147, 41186, 41225, 41264, 41303,
+    41342, 41381, 41420, 41459, 41498, 41537, 41576, 41614, 41653, 41692,
+    41731, 41770, 41808, 41847, 41886, 41924, 41963, 42002, 42040, 42079,
+    42117, 42156, 42194, 42233, 42271, 42309, 42348, 42386, 42424, 42463,
+    42501, 42539, 42578, 42616, 42654, 42692, 42730, 42768, 42806, 42844,
+    42882, 42920, 42958, 42996, 43034, 43072, 43110, 43148, 43186, 43223,
+    43261, 43299, 43337, 43374, 43412, 43450, 43487, 43525, 43562, 43600,
+    43638, 43675, 43713, 43750, 43787, 43825, 43862, 43899, 43937, 43974,
+    44011, 44049, 44086, 44123, 44160, 44197, 44234, 44271, 44308, 44345,
+    44382, 44419, 44456, 44493, 44530, 44567, 44604, 44641, 44677, 44714,
+    44751, 44788, 44824, 44861, 44898, 44934, 44971, 45007, 45044, 45080,
+    45117, 45153, 45190, 45226, 45262, 45299, 45335, 45371, 45408, 45444,
+    45480, 45516, 45552, 45589, 45625, 45661, 45697, 45733, 45769, 45805,
+    45841, 45877, 45912, 45948, 45984, 46020, 46056, 46091, 46127, 46163,
+    46199, 46234, 46270, 46305, 46341, 46376, 46412, 46447, 46483, 46518,
+    46554, 46589, 46624, 46660, 46695, 46730, 46765, 46801, 46836, 46871,
+    46906, 46941, 46976, 47011, 47046, 47081, 47116, 47151, 47186, 47221,
+    47256, 47291, 47325, 47360, 47395, 47430, 47464, 47499, 47534, 47568,
+    47603, 47637, 47672, 47706, 47741, 47775, 47809, 47844, 47878, 47912,
+    47947, 47981, 48015, 48049, 48084, 48118, 48152, 48186, 48220, 48254,
+    48288, 48322, 48356, 48390, 48424, 48458, 48491, 48525, 48559, 48593,
+    48626, 48660, 48694, 48727, 48761, 48795, 48828, 48862, 48895, 48929,
+    48962, 48995, 49029, 49062, 49095, 49129, 49162, 49195, 49228, 49262,
+    49295, 49328, 49361, 49394, 49427, 49460, 49493, 49526, 49559, 49592,
+    49624, 49657, 49690, 49723, 49756, 49788, 49821, 49854, 49886, 49919,
+    49951, 49984, 50016, 50049, 50081, 50114, 50146, 50178, 50211, 50243,
+    50275, 50307, 50340, 50372, 50404, 50436, 50468, 50500, 50532, 50564,
+    50596, 50628, 50660, 50692, 50724, 50756, 50787, 50819, 50851, 50882,
+    50914, 50946, 50977, 51009, 51041, 51072, 51104, 51135, 51166, 51198,
+    51229, 51260, 51292, 51323, 51354, 51386, 51417, 51448, 51479, 51510,
+    51541, 51572, 51603, 51634, 51665, 51696, 51727, 51758, 51789, 51819,
+    51850, 51881, 51911, 51942, 51973, 52003, 52034, 52065, 52095, 52126,
+    52156, 52186, 52217, 52247, 52277, 52308, 52338, 52368, 52398, 52429,
+    52459, 52489, 52519, 52549, 52579, 52609, 52639, 52669, 52699, 52729,
+    52759, 52788, 52818, 52848, 52878, 52907, 52937, 52967, 52996, 53026,
+    53055, 53085, 53114, 53144, 53173, 53202, 53232, 53261, 53290, 53319,
+    53349, 53378, 53407, 53436, 53465, 53494, 53523, 53552, 53581, 53610,
+    53639, 53668, 53697, 53726, 53754, 53783, 53812, 53840, 53869, 53898,
+    53926, 53955, 53983, 54012, 54040, 54069, 54097, 54125, 54154, 54182,
+    54210, 54239, 54267, 54295, 54323, 54351, 54379, 54407, 54435, 54463,
+    54491, 54519, 54547, 54575, 54603, 54630, 54658, 54686, 54714, 54741,
+    54769, 54796, 54824, 54852, 54879, 54906, 54934, 54961, 54989, 55016,
+    55043, 55071, 55098, 55125, 55152, 55179, 55206, 55233, 55260, 55288,
+    55314, 55341, 55368, 55395, 55422, 55449, 55476, 55502, 55529, 55556,
+    55582, 55609, 55636, 55662, 55689, 55715, 55742, 55768, 55794, 55821,
+    55847, 55873, 55900, 55926, 55952, 55978, 56004, 56030, 56056, 56082,
+    56108, 56134, 56160, 56186, 56212, 56238, 56264, 56289, 56315, 56341,
+    56367, 56392, 56418, 56443, 56469, 56494, 56520, 56545, 56571, 56596,
+    56621, 56647, 56672, 56697, 56722, 56747, 56773, 56798, 56823, 56848,
+    56873, 56898, 56923, 56948, 56972, 56997, 57022, 57047, 57072, 57096,
+    57121, 57145, 57170, 57195, 57219, 57244, 57268, 57293, 57317, 57341,
+    57366, 57390, 57414, 57438, 57463, 57487, 57511, 57535, 57559, 57583,
+    57607, 57631, 57655, 57679, 57703, 57726, 57750, 57774, 57798, 57821,
+    57845, 57869, 57892, 57916, 57939, 57963, 57986, 58009, 58033, 58056,
+    58079, 58103, 58126, 58149, 58172, 58195, 58219, 58242, 58265, 58288,
+    58311, 58334, 58356, 58379, 58402, 58425, 58448, 58470, 58493, 58516,
+    58538, 58561, 58583, 58606, 58628, 58651, 58673, 58696, 58718, 58740,
+    58763, 58785, 58807, 58829, 58851, 58873, 58896, 58918, 58940, 58962,
+    58983, 59005, 59027, 59049, 59071, 59093, 59114, 59136, 59158, 59179,
+    59201, 59222, 59244, 59265, 59287, 59308, 59330, 59351, 59372, 59393,
+    59415, 59436, 59457, 59478, 59499, 59520, 59541, 59562, 59583, 59604,
+    59625, 59646, 59667, 59687, 59708, 59729, 59750, 59770, 59791, 59811,
+    59832, 59852, 59873, 59893, 59914, 59934, 59954, 59975, 59995, 60015,
+    60035, 60055, 60075, 60096, 60116, 60136, 60156, 60175, 60195, 60215,
+    60235, 60255, 60275, 60294, 60314, 60334, 60353, 60373, 60392, 60412,
+    60431, 60451, 60470, 60490, 60509, 60528, 60547, 60567, 60586, 60605,
+    60624, 60643, 60662, 60681, 60700, 60719, 60738, 60757, 60776, 60794,
+    60813, 60832, 60851, 60869, 60888, 60906, 60925, 60943, 60962, 60980,
+    60999, 61017, 61035, 61054, 61072, 61090, 61108, 61127, 61145, 61163,
+    61181, 61199, 61217, 61235, 61253, 61270, 61288, 61306, 61324, 61341,
+    61359, 61377, 61394, 61412, 61429, 61447, 61464, 61482, 61499, 61517,
+    61534, 61551, 61568, 61586, 61603, 61620, 61637, 61654, 61671, 61688,
+    61705, 61722, 61739, 61756, 61772, 61789, 61806, 61823, 61839, 61856,
+    61873, 61889, 61906, 61922, 61939, 61955, 61971, 61988, 62004, 62020,
+    62036, 62053, 62069, 62085, 62101, 62117, 62133, 62149, 62165, 62181,
+    62197, 62212, 62228, 62244, 62260, 62275, 62291, 62307, 62322, 62338,
+    62353, 62369, 62384, 62400, 62415, 62430, 62445, 62461, 62476, 62491,
+    62506, 62521, 62536, 62551, 62566, 62581, 62596, 62611, 62626, 62641,
+    62655, 62670, 62685, 62699, 62714, 62729, 62743, 62758, 62772, 62787,
+    62801, 62815, 62830, 62844, 62858, 62872, 62886, 62901, 62915, 62929,
+    62943, 62957, 62971, 62985, 62998, 63012, 63026, 63040, 63054, 63067,
+    63081, 63095, 63108, 63122, 63135, 63149, 63162, 63175, 63189, 63202,
+    63215, 63229, 63242, 63255, 63268, 63281, 63294, 63307, 63320, 63333,
+    63346, 63359, 63372, 63385, 63397, 63410, 63423, 63435, 63448, 63461,
+    63473, 63486, 63498, 63510, 63523, 63535, 63547, 63560, 63572, 63584,
+    63596, 63608, 63621, 63633, 63645, 63657, 63668, 63680, 63692, 63704,
+    63716, 63728, 63739, 63751, 63763, 63774, 63786, 63797, 63809, 63820,
+    63832, 63843, 63854, 63866, 63877, 63888, 63899, 63910, 63922, 63933,
+    63944, 63955, 63966, 63976, 63987, 63998, 64009, 64020, 64031, 64041,
+    64052, 64062, 64073, 64084, 64094, 64105, 64115, 64125, 64136, 64146,
+    64156, 64167, 64177, 64187, 64197, 64207, 64217, 64227, 64237, 64247,
+    64257, 64267, 64277, 64287, 64296, 64306, 64316, 64325, 64335, 64344,
+    64354, 64363, 64373, 64382, 64392, 64401, 64410, 64420, 64429, 64438,
+    64447, 64456, 64465, 64474, 64483, 64492, 64501, 64510, 64519, 64528,
+    64536, 64545, 64554, 64563, 64571, 64580, 64588, 64597, 64605, 64614,
+    64622, 64630, 64639, 64647, 64655, 64663, 64672, 64680, 64688, 64696,
+    64704, 64712, 64720, 64728, 64735, 64743, 64751, 64759, 64766, 64774,
+    64782, 64789, 64797, 64804, 64812, 64819, 64827, 64834, 64841, 64849,
+    64856, 64863, 64870, 64877, 64884, 64892, 64899, 64905, 64912, 64919,
+    64926, 64933, 64940, 64947, 64953, 64960, 64967, 64973, 64980, 64986,
+    64993, 64999, 65006, 65012, 65018, 65025, 65031, 65037, 65043, 65049,
+    65055, 65061, 65067, 65073, 65079, 65085, 65091, 65097, 65103, 65109,
+    65114, 65120, 65126, 65131, 65137, 65142, 65148, 65153, 65159, 65164,
+    65169, 65175, 65180, 65185, 65190, 65195, 65200, 65205, 65210, 65215,
+    65220, 65225, 65230, 65235, 65240, 65245, 65249, 65254, 65259, 65263,
+    65268, 65272, 65277, 65281, 65286, 65290, 65294, 65299, 65303, 65307,
+    65311, 65315, 65320, 65324, 65328, 65332, 65336, 65339, 65343, 65347,
+    65351, 65355, 65358, 65362, 65366, 65369, 65373, 65376, 65380, 65383,
+    65387, 65390, 65393, 65397, 65400, 65403, 65406, 65410, 65413, 65416,
+    65419, 65422, 65425, 65428, 65430, 65433, 65436, 65439, 65442, 65444,
+    65447, 65449, 65452, 65455, 65457, 65460, 65462, 65464, 65467, 65469,
+    65471, 65473, 65476, 65478, 65480, 65482, 65484, 65486, 65488, 65490,
+    65492, 65493, 65495, 65497, 65499, 65500, 65502, 65504, 65505, 65507,
+    65508, 65510, 65511, 65512, 65514, 65515, 65516, 65517, 65519, 65520,
+    65521, 65522, 65523, 65524, 65525, 65526, 65527, 65527, 65528, 65529,
+    65530, 65530, 65531, 65532, 65532, 65533, 65533, 65534, 65534, 65534,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+};
+#elif QUADRANT_SIZE == 2048 && FAST_SINCOS_TABLE_BITS == 32
+static const uint32_t sineTable[2049] PROGMEM = {
+    0,          3294198,    6588395,    9882587,    13176774,   16470953,
+    19765122,   23059280,   26353424,   29647552,   32941664,   36235755,
+    39529826,   42823873,   46117895,   49411890,   52705856,   55999790,
+    59293692,   62587559,   65881389,   69175181,   72468931,   75762639,
+    79056303,   82349920,   85643488,   88937007,   92230472,   95523884,
+    98817239,   102110537,  105403774,  108696949,  111990060,  115283106,
+    118576083,  121868991,  125161827,  128454590,  131747276,  135039886,
+    138332416,  141624864,  144917230,  148209510,  151501702,  154793806,
+    158085819,  161377738,  164669563,  167961291,  171252920,  174544448,
+    177835874,  181127195,  184418409,  187709515,  191000511,  194291394,
+    197582163,  200872815,  204163350,  207453764,  210744057,  214034225,
+    217324267,  220614182,  223903967,  227193620,  230483139,  233772523,
+    237061769,  240350876,  243639842,  246928664,  250217341,  253505870,
+    256794251,  260082480,  263370557,  266658479,  269946243,  273233849,
+    276521294,  279808577,  283095695,  286382646,  289669429,  292956041,
+    296242481,  299528747,  302814837,  306100748,  309386480,  312672029,
+    315957395,  319242574,  322527566,  325812368,  329096979,  332381396,
+    335665617,  338949641,  342233465,  345517088,  348800508,  352083723,
+    355366730,  358649529,  361932116,  365214491,  368496651,  371778594,
+    375060318,  378341821,  381623102,  384904159,  388184989,  391465591,
+    394745962,  398026102,  401306007,  404585676,  407865107,  411144298,
+    414423247,  417701952,  420980412,  424258624,  427536587,  430814298,
+    434091755,  437368957,  440645902,  443922588,  447199012,  450475174,
+    453751070,  457026700,  460302060,  463577150,  466851967,  470126510,
+    473400776,  476674763,  479948470,  483221895,  486495035,  489767889,
+    493040456,  496312732,  499584716,  502856406,  506127800,  509398897,
+    512669694,  515940189,  519210381,  522480268,  525749847,  529019116,
+    532288075,  535556720,  538825051,  542093064,  545360759,  548628133,
+    551895183,  555161910,  558428309,  561694381,  564960121,  568225530,
+    571490604,  574755342,  578019742,  581283802,  584547519,  587810893,
+    591073921,  594336602,  597598933,  600860912,  604122538,  607383808,
+    610644721,  613905275,  617165468,  620425298,  623684762,  626943860,
+    630202589,  633460947,  636718933,  639976544,  643233779,  646490635,
+    649747111,  653003204,  656258914,  659514237,  662769172,  666023718,
+    669277872,  672531632,  675784996,  679037963,  682290530,  685542696,
+    688794459,  692045817,  695296767,  698547308,  701797439,  705047156,
+    708296459,  711545345,  714793813,  718041860,  721289485,  724536685,
+    727783459,  731029805,  734275721,  737521205,  740766255,  744010870,
+    747255046,  750498783,  753742079,  756984931,  760227338,  763469298,
+    766710808,  769951868,  773192474,  776432626,  779672321,  782911557,
+    786150333,  789388646,  792626495,  795863877,  799100792,  802337236,
+    805573208,  808808707,  812043729,  815278274,  818512339,  821745923,
+    824979024,  828211639,  831443766,  834675405,  837906553,  841137208,
+    844367368,  847597031,  850826195,  854054860,  857283021,  860510679,
+    863737830,  866964473,  870190606,  873416227,  876641334,  879865926,
+    883090000,  886313554,  889536587,  892759097,  895981082,  899202539,
+    902423468,  905643866,  908863731,  912083061,  915301854,  918520110,
+    921737825,  924954997,  928171626,  931387708,  934603243,  937818228,
+    941032661,  944246541,  947459865,  950672631,  953884839,  957096485,
+    960307568,  963518087,  966728038,  969937421,  973146233,  976354473,
+    979562138,  982769227,  985975738,  989181669,  992387019,  995591784,
+    998795963,  1001999555, 1005202558, 1008404969, 1011606787, 1014808010,
+    1018008636, 1021208663, 1024408090, 1027606913, 1030805132, 1034002745,
+    1037199750, 1040396144, 1043591926, 1046787095, 1049981647, 1053175582,
+    1056368897, 1059561591, 1062753662, 1065945107, 1069135926, 1072326115,
+    1075515674, 1078704600, 1081892891, 1085080546, 1088267562, 1091453939,
+    1094639673, 1097824763, 1101009208, 1104193004, 1107376152, 1110558647,
+    1113740490, 1116921677, 1120102207, 1123282079, 1126461289, 1129639837,
+    1132817720, 1135994937, 1139171486, 1142347364, 1145522571, 1148697103,
+    1151870960, 1155044139, 1158216639, 1161388457, 1164559593, 1167730043,
+    1170899806, 1174068880, 1177237264, 1180404955, 1183571952, 1186738252,
+    1189903854, 1193068757, 1196232957, 1199396454, 1202559245, 1205721329,
+    1208882703, 1212043367, 1215203317, 1218362552, 1221521071, 1224678871,
+    1227835951, 1230992308, 1234147941, 1237302848, 1240457028, 1243610477,
+    1246763195, 1249915180, 1253066429, 1256216941, 1259366714, 1262515747,
+    1265664036, 1268811581, 1271958380, 1275104430, 1278249730, 1281394278,
+    1284538073, 1287681112, 1290823393, 1293964915, 1297105676, 1300245673,
+    1303384906, 1306523372, 1309661069, 1312797996, 1315934151, 1319069531,
+    1322204136, 1325337963, 1328471010, 1331603275, 1334734758, 1337865455,
+    1340995365, 1344124486, 1347252816, 1350380354, 1353507098, 1356633045,
+    1359758194, 1362882543, 1366006091, 1369128835, 1372250773, 1375371905,
+    1378492227, 1381611738, 1384730436, 1387848320, 1390965388, 1394081637,
+    1397197066, 1400311673, 1403425456, 1406538414, 1409650544, 1412761845,
+    1415872315, 1418981952, 1422090755, 1425198720, 1428305848, 1431412135,
+    1434517580, 1437622181, 1440725936, 1443828844, 1446930903, 1450032110,
+    1453132464, 1456231964, 1459330606, 1462428391, 1465525315, 1468621377,
+    1471716574, 1474810907, 1477904371, 1480996966, 1484088690, 1487179541,
+    1490269517, 1493358616, 1496446837, 1499534177, 1502620636, 1505706210,
+    1508790899, 1511874700, 1514957611, 1518039632, 1521120759, 1524200992,
+    1527280328, 1530358765, 1533436302, 1536512937, 1539588668, 1542663494,
+    1545737412, 1548810421, 1551882518, 1554953703, 1558023973, 1561093326,
+    1564161761, 1567229276, 1570295869, 1573361538, 1576426281, 1579490097,
+    1582552984, 1585614940, 1588675964, 1591736052, 1594795204, 1597853419,
+    1600910693, 1603967025, 1607022414, 1610076857, 1613130353, 1616182901,
+    1619234497, 1622285141, 1625334831, 1628383564, 1631431340, 1634478156,
+    1637524010, 1640568901, 1643612827, 1646655786, 1649697776, 1652738796,
+    1655778843, 1658817917, 1661856014, 1664893135, 1667929275, 1670964435,
+    1673998611, 1677031803, 1680064008, 1683095225, 1686125451, 1689154686,
+    1692182927, 1695210173, 1698236421, 1701261670, 1704285919, 1707309165,
+    1710331406, 1713352642, 1716372869, 1719392087, 1722410293, 1725427486,
+    1728443664, 1731458825, 1734472968, 1737486090, 1740498191, 1743509267,
+    1746519318, 1749528341, 1752536335, 1755543298, 1758549228, 1761554124,
+    1764557983, 1767560805, 1770562587, 1773563327, 1776563023, 1779561675,
+    1782559280, 1785555836, 1788551342, 1791545795, 1794539195, 1797531539,
+    1800522825, 1803513053, 1806502219, 1809490323, 1812477362, 1815463335,
+    1818448240, 1821432075, 1824414839, 1827396529, 1830377145, 1833356683,
+    1836335144, 1839312523, 1842288821, 1845264035, 1848238164, 1851211205,
+    1854183158, 1857154019, 1860123788, 1863092463, 1866060042, 1869026523,
+    1871991904, 1874956184, 1877919361, 1880881434, 1883842400, 1886802258,
+    1889761006, 1892718642, 1895675165, 1898630572, 1901584863, 1904538035,
+    1907490086, 1910441016, 1913390821, 1916339501, 1919287054, 1922233478,
+    1925178771, 1928122931, 1931065957, 1934007847, 1936948599, 1939888212,
+    1942826684, 1945764012, 1948700196, 1951635234, 1954569124, 1957501863,
+    1960433452, 1963363887, 1966293167, 1969221290, 1972148255, 1975074059,
+    1977998702, 1980922181, 1983844495, 1986765642, 1989685620, 1992604427,
+    1995522063, 1998438524, 2001353810, 2004267918, 2007180848, 2010092597,
+    2013003163, 2015912545, 2018820741, 2021727749, 2024633568, 2027538196,
+    2030441631, 2033343872, 2036244917, 2039144764, 2042043411, 2044940857,
+    2047837100, 2050732138, 2053625970, 2056518594, 2059410008, 2062300210,
+    2065189200, 2068076974, 2070963532, 2073848871, 2076732991, 2079615889,
+    2082497563, 2085378012, 2088257235, 2091135229, 2094011993, 2096887525,
+    2099761824, 2102634887, 2105506713, 2108377301, 2111246649, 2114114754,
+    2116981616, 2119847232, 2122711602, 2125574722, 2128436593, 2131297211,
+    2134156575, 2137014684, 2139871536, 2142727128, 2145581461, 2148434531,
+    2151286337, 2154136878, 2156986152, 2159834156, 2162680890, 2165526352,
+    2168370540, 2171213452, 2174055087, 2176895444, 2179734519, 2182572312,
+    2185408821, 2188244045, 2191077981, 2193910629, 2196741986, 2199572050,
+    2202400821, 2205228295, 2208054473, 2210879352, 2213702930, 2216525206,
+    2219346178, 2222165844, 2224984203, 2227801253, 2230616993, 2233431420,
+    2236244534, 2239056332, 2241866812, 2244675974, 2247483816, 2250290335,
+    2253095531, 2255899401, 2258701944, 2261503158, 2264303042, 2267101594,
+    2269898812, 2272694695, 2275489241, 2278282449, 2281074316, 2283864841,
+    2286654023, 2289441859, 2292228349, 2295013490, 2297797281, 2300579720,
+    2303360806, 2306140537, 2308918911, 2311695927, 2314471584, 2317245878,
+    2320018810, 2322790376, 2325560576, 2328329408, 2331096871, 2333862962,
+    2336627680, 2339391024, 2342152991, 2344913580, 2347672791, 2350430620,
+    2353187066, 2355942128, 2358695804, 2361448092, 2364198992, 2366948500,
+    2369696616, 2372443338, 2375188665, 2377932594, 2380675124, 2383416254,
+    2386155981, 2388894305, 2391631224, 2394366736, 2397100839, 2399833532,
+    2402564813, 2405294681, 2408023134, 2410750170, 2413475788, 2416199987,
+    2418922764, 2421644118, 2424364047, 2427082550, 2429799626, 2432515272,
+    2435229487, 2437942269, 2440653617, 2443363530, 2446072005, 2448779041,
+    2451484637, 2454188790, 2456891500, 2459592764, 2462292582, 2464990951,
+    2467687870, 2470383337, 2473077351, 2475769910, 2478461013, 2481150657,
+    2483838842, 2486525566, 2489210827, 2491894624, 2494576955, 2497257818,
+    2499937213, 2502615136, 2505291588, 2507966565, 2510640068, 2513312093,
+    2515982640, 2518651707, 2521319292, 2523985393, 2526650010, 2529313141,
+    2531974784, 2534634937, 2537293599, 2539950769, 2542606444, 2545260624,
+    2547913306, 2550564490, 2553214173, 2555862354, 2558509031, 2561154203,
+    2563797869, 2566440027, 2569080674, 2571719811, 2574357434, 2576993543,
+    2579628136, 2582261212, 2584892768, 2587522804, 2590151318, 2592778308,
+    2595403773, 2598027711, 2600650120, 2603271000, 2605890348, 2608508163,
+    2611124444, 2613739189, 2616352396, 2618964064, 2621574191, 2624182776,
+    2626789817, 2629395313, 2631999263, 2634601664, 2637202515, 2639801814,
+    2642399561, 2644995753, 2647590390, 2650183468, 2652774988, 2655364947,
+    2657953344, 2660540178, 2663125446, 2665709148, 2668291281, 2670871845,
+    2673450838, 2676028258, 2678604104, 2681178373, 2683751066, 2686322180,
+    2688891714, 2691459665, 2694026034, 2696590818, 2699154015, 2701715624,
+    2704275644, 2706834074, 2709390911, 2711946154, 2714499801, 2717051852,
+    2719602305, 2722151157, 2724698408, 2727244057, 2729788101, 2732330539,
+    2734871369, 2737410591, 2739948203, 2742484202, 2745018589, 2747551360,
+    2750082515, 2752612053, 2755139971, 2757666268, 2760190943, 2762713995,
+    2765235421, 2767755220, 2770273391, 2772789933, 2775304843, 2777818121,
+    2780329764, 2782839772, 2785348143, 2787854876, 2790359968, 2792863419,
+    2795365227, 2797865390, 2800363908, 2802860778, 2805355999, 2807849570,
+    2810341489, 2812831755, 2815320366, 2817807321, 2820292619, 2822776257,
+    2825258235, 2827738550, 2830217203, 2832694190, 2835169511, 2837643164,
+    2840115147, 2842585460, 2845054101, 2847521068, 2849986360, 2852449975,
+    2854911913, 2857372171, 2859830747, 2862287642, 2864742853, 2867196378,
+    2869648217, 2872098368, 2874546829, 2876993599, 2879438676, 2881882060,
+    2884323748, 2886763740, 2889202033, 2891638627, 2894073520, 2896506710,
+    2898938196, 2901367977, 2903796051, 2906222417, 2908647073, 2911070018,
+    2913491250, 2915910769, 2918328572, 2920744659, 2923159027, 2925571676,
+    2927982603, 2930391809, 2932799290, 2935205046, 2937609075, 2940011376,
+    2942411948, 2944810789, 2947207897, 2949603272, 2951996911, 2954388814,
+    2956778979, 2959167404, 2961554089, 2963939031, 2966322230, 2968703684,
+    2971083391, 2973461351, 2975837561, 2978212021, 2980584729, 2982955683,
+    2985324883, 2987692326, 2990058012, 2992421939, 2994784105, 2997144510,
+    2999503152, 3001860029, 3004215140, 3006568483, 3008920059, 3011269864,
+    3013617897, 3015964158, 3018308645, 3020651356, 3022992289, 3025331445,
+    3027668821, 3030004416, 3032338228, 3034670257, 3037000500, 3039328957,
+    3041655625, 3043980505, 3046303593, 3048624890, 3050944393, 3053262102,
+    3055578014, 3057892129, 3060204445, 3062514960, 3064823674, 3067130585,
+    3069435692, 3071738993, 3074040487, 3076340173, 3078638049, 3080934114,
+    3083228366, 3085520805, 3087811428, 3090100236, 3092387225, 3094672395,
+    3096955744, 3099237272, 3101516976, 3103794856, 3106070910, 3108345137,
+    3110617535, 3112888104, 3115156841, 3117423746, 3119688816, 3121952052,
+    3124213451, 3126473012, 3128730733, 3130986614, 3133240654, 3135492850,
+    3137743202, 3139991707, 3142238366, 3144483176, 3146726136, 3148967245,
+    3151206502, 3153443905, 3155679453, 3157913144, 3160144978, 3162374952,
+    3164603066, 3166829319, 3169053709, 3171276234, 3173496894, 3175715687,
+    3177932612, 3180147667, 3182360851, 3184572164, 3186781603, 3188989167,
+    3191194855, 3193398666, 3195600598, 3197800651, 3199998822, 3202195111,
+    3204389516, 3206582036, 3208772670, 3210961415, 3213148273, 3215333239,
+    3217516315, 3219697497, 3221876786, 3224054179, 3226229675, 3228403274,
+    3230574973, 3232744772, 3234912670, 3237078664, 3239242754, 3241404938,
+    3243565216, 3245723585, 3247880045, 3250034595, 3252187232, 3254337956,
+    3256486766, 3258633660, 3260778637, 3262921696, 3265062836, 3267202055,
+    3269339351, 3271474725, 3273608174, 3275739697, 3277869293, 3279996961,
+    3282122699, 3284246506, 3286368382, 3288488324, 3290606332, 3292722403,
+    3294836538, 3296948735, 3299058992, 3301167308, 3303273682, 3305378113,
+    3307480600, 3309581141, 3311679735, 3313776381, 3315871077, 3317963823,
+    3320054617, 3322143457, 3324230344, 3326315275, 3328398249, 3330479265,
+    3332558322, 3334635418, 3336710553, 3338783724, 3340854932, 3342924174,
+    3344991450, 3347056758, 3349120097, 3351181466, 3353240863, 3355298288,
+    3357353739, 3359407215, 3361458715, 3363508237, 3365555780, 3367601344,
+    3369644927, 3371686527, 3373726144, 3375763776, 3377799422, 3379833081,
+    3381864752, 3383894434, 3385922125, 3387947824, 3389971529, 3391993241,
+    3394012957, 3396030677, 3398046399, 3400060122, 3402071844, 3404081566,
+    3406089285, 3408095000, 3410098710, 3412100414, 3414100111, 3416097799,
+    3418093478, 3420087146, 3422078802, 3424068445, 3426056074, 3428041687,
+    3430025284, 3432006863, 3433986423, 3435963962, 3437939481, 3439912977,
+    3441884449, 3443853897, 3445821319, 3447786713, 3449750080, 3451711417,
+    3453670723, 3455627998, 3457583240, 3459536447, 3461487620, 3463436756,
+    3465383855, 3467328916, 3469271936, 3471212916, 3473151854, 3475088748,
+    3477023598, 3478956403, 3480887161, 3482815872, 3484742533, 3486667145,
+    3488589706, 3490510214, 3492428669, 3494345069, 3496259414, 3498171702,
+    3500081932, 3501990103, 3503896214, 3505800264, 3507702251, 3509602175,
+    3511500034, 3513395828, 3515289554, 3517181213, 3519070803, 3520958322,
+    3522843770, 3524727146, 3526608449, 3528487676, 3530364828, 3532239903,
+    3534112901, 3535983819, 3537852657, 3539719414, 3541584088, 3543446679,
+    3545307186, 3547165607, 3549021941, 3550876187, 3552728345, 3554578412,
+    3556426389, 3558272273, 3560116064, 3561957761, 3563797363, 3565634868,
+    3567470275, 3569303584, 3571134792, 3572963901, 3574790907, 3576615810,
+    3578438609, 3580259304, 3582077892, 3583894372, 3585708745, 3587521008,
+    3589331160, 3591139201, 3592945130, 3594748945, 3596550645, 3598350229,
+    3600147697, 3601943047, 3603736278, 3605527388, 3607316378, 3609103246,
+    3610887990, 3612670611, 3614451106, 3616229475, 3618005716, 3619779829,
+    3621551813, 3623321666, 3625089388, 3626854977, 3628618433, 3630379754,
+    3632138939, 3633895988, 3635650898, 3637403671, 3639154303, 3640902794,
+    3642649144, 3644393351, 3646135414, 3647875332, 3649613104, 3651348729,
+    3653082206, 3654813534, 3656542712, 3658269739, 3659994613, 3661717335,
+    3663437903, 3665156316, 3666872572, 3668586671, 3670298613, 3672008395,
+    3673716017, 3675421477, 3677124776, 3678825911, 3680524883, 3682221689,
+    3683916329, 3685608802, 3687299106, 3688987242, 3690673207, 3692357002,
+    3694038624, 3695718073, 3697395348, 3699070448, 3700743371, 3702414118,
+    3704082687, 3705749076, 3707413286, 3709075315, 3710735162, 3712392826,
+    3714048305, 3715701601, 3717352710, 3719001632, 3720648367, 3722292913,
+    3723935269, 3725575434, 3727213408, 3728849189, 3730482776, 3732114169,
+    3733743367, 3735370368, 3736995171, 3738617777, 3740238183, 3741856388,
+    3743472393, 3745086195, 3746697794, 3748307189, 3749914379, 3751519363,
+    3753122140, 3754722709, 3756321069, 3757917220, 3759511160, 3761102888,
+    3762692404, 3764279706, 3765864794, 3767447666, 3769028322, 3770606761,
+    3772182982, 3773756984, 3775328765, 3776898326, 3778465665, 3780030781,
+    3781593674, 3783154341, 3784712784, 3786269000, 3787822988, 3789374748,
+    3790924279, 3792471580, 3794016650, 3795559488, 3797100093, 3798638465,
+    3800174601, 3801708503, 3803240167, 3804769595, 3806296784, 3807821734,
+    3809344444, 3810864913, 3812383140, 3813899125, 3815412866, 3816924362,
+    3818433613, 3819940618, 3821445375, 3822947885, 3824448145, 3825946156,
+    3827441916, 3828935424, 3830426680, 3831915683, 3833402431, 3834886924,
+    3836369162, 3837849142, 3839326865, 3840802329, 3842275534, 3843746478,
+    3845215161, 3846681583, 3848145741, 3849607636, 3851067265, 3852524630,
+    3853979728, 3855432559, 3856883122, 3858331416, 3859777440, 3861221193,
+    3862662676, 3864101885, 3865538822, 3866973485, 3868405873, 3869835985,
+    3871263820, 3872689379, 3874112659, 3875533660, 3876952381, 3878368821,
+    3879782980, 3881194857, 3882604450, 3884011759, 3885416784, 3886819522,
+    3888219974, 3889618139, 3891014016, 3892407604, 3893798902, 3895187909,
+    3896574625, 3897959048, 3899341179, 3900721015, 3902098557, 3903473804,
+    3904846754, 3906217407, 3907585762, 3908951818, 3910315575, 3911677032,
+    3913036187, 3914393040, 3915747591, 3917099838, 3918449781, 3919797419,
+    3921142750, 3922485775, 3923826493, 3925164902, 3926501002, 3927834793,
+    3929166272, 3930495441, 3931822297, 3933146840, 3934469069, 3935788984,
+    3937106583, 3938421867, 3939734833, 3941045482, 3942353812, 3943659823,
+    3944963515, 3946264885, 3947563934, 3948860661, 3950155065, 3951447145,
+    3952736900, 3954024331, 3955309435, 3956592212, 3957872662, 3959150783,
+    3960426576, 3961700038, 3962971170, 3964239971, 3965506439, 3966770575,
+    3968032378, 3969291846, 3970548979, 3971803776, 3973056236, 3974306360,
+    3975554145, 3976799592, 3978042699, 3979283466, 3980521892, 3981757977,
+    3982991719, 3984223118, 3985452174, 3986678884, 3987903250, 3989125269,
+    3990344942, 3991562267, 3992777245, 3993989873, 3995200152, 3996408080,
+    3997613658, 3998816884, 4000017757, 4001216278, 4002412444, 4003606256,
+    4004797713, 4005986814, 4007173558, 4008357945, 4009539974, 4010719645,
+    4011896955, 4013071906, 4014244496, 4015414725, 4016582591, 4017748094,
+    4018911234, 4020072010, 4021230421, 4022386466, 4023540145, 4024691457,
+    4025840401, 4026986978, 4028131185, 4029273022, 4030412489, 4031549585,
+    4032684310, 4033816662, 4034946641, 4036074247, 4037199478, 4038322334,
+    4039442815, 4040560919, 4041676647, 4042789996, 4043900968, 4045009560,
+    4046115773, 4047219606, 4048321058, 4049420128, 4050516816, 4051611122,
+    4052703044, 4053792581, 4054879734, 4055964502, 4057046884, 4058126879,
+    4059204486, 4060279706, 4061352537, 4062422979, 4063491032, 4064556693,
+    4065619964, 4066680843, 4067739330, 4068795423, 4069849124, 4070900430,
+    4071949341, 4072995856, 4074039976, 4075081699, 4076121025, 4077157953,
+    4078192482, 4079224613, 4080254343, 4081281674, 4082306603, 4083329131,
+    4084349257, 4085366980, 4086382299, 4087395215, 4088405726, 4089413833,
+    4090419533, 4091422827, 4092423715, 4093422195, 4094418266, 4095411930,
+    4096403184, 4097392028, 4098378461, 4099362484, 4100344095, 4101323295,
+    4102300081, 4103274454, 4104246413, 4105215958, 4106183088, 4107147802,
+    4108110101, 4109069982, 4110027446, 4110982493, 4111935121, 4112885330,
+    4113833119, 4114778489, 4115721438, 4116661965, 4117600071, 4118535755,
+    4119469016, 4120399853, 4121328267, 4122254256, 4123177820, 4124098959,
+    4125017671, 4125933957, 4126847815, 4127759246, 4128668249, 4129574823,
+    4130478967, 4131380682, 4132279966, 4133176819, 4134071241, 4134963231,
+    4135852789, 4136739913, 4137624604, 4138506861, 4139386683, 4140264070,
+    4141139022, 4142011537, 4142881616, 4143749258, 4144614462, 4145477228,
+    4146337555, 4147195443, 4148050891, 4148903899, 4149754467, 4150602593,
+    4151448277, 4152291520, 4153132319, 4153970676, 4154806588, 4155640057,
+    4156471081, 4157299660, 4158125793, 4158949480, 4159770720, 4160589514,
+    4161405860, 4162219757, 4163031206, 4163840207, 4164646757, 4165450858,
+    4166252509, 4167051708, 4167848456, 4168642752, 4169434596, 4170223987,
+    4171010925, 4171795410, 4172577440, 4173357015, 4174134136, 4174908800,
+    4175681009, 4176450762, 4177218057, 4177982895, 4178745276, 4179505198,
+    4180262661, 4181017665, 4181770210, 4182520295, 4183267919, 4184013082,
+    4184755784, 4185496024, 4186233802, 4186969118, 4187701970, 4188432359,
+    4189160283, 4189885744, 4190608739, 4191329269, 4192047334, 4192762933,
+    4193476065, 4194186730, 4194894928, 4195600658, 4196303920, 4197004713,
+    4197703038, 4198398893, 4199092278, 4199783193, 4200471637, 4201157610,
+    4201841112, 4202522142, 4203200700, 4203876785, 4204550397, 4205221536,
+    4205890201, 4206556392, 4207220108, 4207881349, 4208540114, 4209196404,
+    4209850218, 4210501555, 4211150416, 4211796798, 4212440704, 4213082131,
+    4213721080, 4214357550, 4214991540, 4215623051, 4216252083, 4216878633,
+    4217502704, 4218124293, 4218743401, 4219360027, 4219974170, 4220585832,
+    4221195010, 4221801705, 4222405917, 4223007645, 4223606888, 4224203647,
+    4224797921, 4225389709, 4225979012, 4226565829, 4227150159, 4227732003,
+    4228311359, 4228888229, 4229462610, 4230034503, 4230603908, 4231170824,
+    4231735252, 4232297189, 4232856637, 4233413595, 4233968062, 4234520039,
+    4235069525, 4235616519, 4236161021, 4236703032, 4237242550, 4237779576,
+    4238314108, 4238846147, 4239375693, 4239902745, 4240427302, 4240949365,
+    4241468933, 4241986006, 4242500584, 4243012666, 4243522251, 4244029341,
+    4244533933, 4245036029, 4245535628, 4246032729, 4246527332, 4247019437,
+    4247509043, 4247996151, 4248480760, 4248962870, 4249442480, 4249919590,
+    4250394200, 4250866310, 4251335919, 4251803027, 4252267634, 4252729740,
+    4253189343, 4253646445, 4254101044, 4254553141, 4255002735, 4255449825,
+    4255894413, 4256336496, 4256776076, 4257213152, 4257647723, 4258079790,
+    4258509352, 4258936408, 4259360959, 4259783005, 4260202544, 4260619577,
+    4261034104, 4261446125, 4261855638, 4262262644, 4262667143, 4263069134,
+    4263468618, 4263865593, 4264260060, 4264652018, 4265041468, 4265428409,
+    4265812840, 4266194762, 4266574174, 4266951076, 4267325469, 4267697350,
+    4268066722, 4268433582, 4268797931, 4269159770, 4269519096, 4269875912,
+    4270230215, 4270582006, 4270931285, 4271278051, 4271622305, 4271964046,
+    4272303274, 4272639988, 4272974189, 4273305877, 4273635050, 4273961709,
+    4274285855, 4274607485, 4274926601, 4275243202, 4275557289, 4275868860,
+    4276177915, 4276484455, 4276788480, 4277089988, 4277388980, 4277685456,
+    4277979416, 4278270859, 4278559785, 4278846194, 4279130086, 4279411461,
+    4279690318, 4279966657, 4280240479, 4280511783, 4280780569, 4281046836,
+    4281310585, 4281571816, 4281830528, 4282086720, 4282340394, 4282591549,
+    4282840184, 4283086300, 4283329896, 4283570972, 4283809529, 4284045565,
+    4284279082, 4284510077, 4284738553, 4284964508, 4285187942, 4285408855,
+    4285627247, 4285843118, 4286056468, 4286267297, 4286475604, 4286681389,
+    4286884652, 4287085394, 4287283614, 4287479312, 4287672487, 4287863140,
+    4288051271, 4288236879, 4288419964, 4288600527, 4288778567, 4288954084,
+    4289127078, 4289297548, 4289465495, 4289630919, 4289793820, 4289954197,
+    4290112050, 4290267379, 4290420185, 4290570466, 4290718224, 4290863458,
+    4291006167, 4291146352, 4291284012, 4291419149, 4291551760, 4291681847,
+    4291809410, 4291934447, 4292056960, 4292176948, 4292294411, 4292409348,
+    4292521761, 4292631649, 4292739011, 4292843848, 4292946160, 4293045946,
+    4293143206, 4293237942, 4293330151, 4293419835, 4293506993, 4293591626,
+    4293673732, 4293753313, 4293830368, 4293904897, 4293976900, 4294046376,
+    4294113327, 4294177752, 4294239650, 4294299023, 4294355869, 4294410189,
+    4294461982, 4294511249, 4294557990, 4294602205, 4294643893, 4294683055,
+    4294719690, 4294753798, 4294785381, 4294814436, 4294840966, 4294864968,
+    4294886444, 4294905394, 4294921817, 4294935713, 4294947083, 4294955926,
+    4294962243, 4294966033, 4294967295,
+};
+#elif QUADRANT_SIZE == 4096 && FAST_SINCOS_TABLE_BITS == 8
+static const uint8_t sineTable[4097] PROGMEM = {
+    0,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+    1,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   3,   3,   3,   3,
+    3,   3,   3,   3,   3,   3,   4,   4,   4,   4,   4,   4,   4,   4,   4,
+    4,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   6,   6,   6,
+    6,   6,   6,   6,   6,   6,   6,   7,   7,   7,   7,   7,   7,   7,   7,
+    7,   7,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   9,   9,   9,
+    9,   9,   9,   9,   9,   9,   9,   10,  10,  10,  10,  10,  10,  10,  10,
+    10,  10,  11,  11,  11,  11,  11,  11,  11,  11,  11,  11,  11,  12,  12,
+    12,  12,  12,  12,  12,  12,  12,  12,  13,  13,  13,  13,  13,  13,  13,
+    13,  13,  13,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  15,  15,
+    15,  15,  15,  15,  15,  15,  15,  15,  16,  16,  16,  16,  16,  16,  16,
+    16,  16,  16,  16,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  18,
+    18,  18,  18,  18,  18,  18,  18,  18,  18,  19,  19,  19,  19,  19,  19,
+    19,  19,  19,  19,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,
+    21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  22,  22,  22,  22,  22,
+    22,  22,  22,  22,  22,  23,  23,  23,  23,  23,  23,  23,  23,  23,  23,
+    24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  25,  25,  25,  25,  25,
+    25,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+    26,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  28,  28,  28,  28,
+    28,  28,  28,  28,  28,  28,  29,  29,  29,  29,  29,  29,  29,  29,  29,
+    29,  29,  30,  30,  30,  30,  30,  30,  30,  30,  30,  30,  31,  31,  31,
+    31,  31,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  32,  32,  32,
+    32,  32,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  34,  34,
+    34,  34,  34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,
+    35,  35,  35,  36,  36,  36,  36,  36,  36,  36,  36,  36,  36,  36,  37,
+    37,  37,  37,  37,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  38,
+    38,  38,  38,  38,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  40,
+    40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,
+    41,  41,  41,  41,  41,  42,  42,  42,  42,  42,  42,  42,  42,  42,  42,
+    43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  44,  44,  44,  44,
+    44,  44,  44,  44,  44,  44,  45,  45,  45,  45,  45,  45,  45,  45,  45,
+    45,  46,  46,  46,  46,  46,  46,  46,  46,  46,  46,  46,  47,  47,  47,
+    47,  47,  47,  47,  47,  47,  47,  48,  48,  48,  48,  48,  48,  48,  48,
+    48,  48,  48,  49,  49,  49,  49,  49,  49,  49,  49,  49,  49,  50,  50,
+    50,  50,  50,  50,  50,  50,  50,  50,  51,  51,  51,  51,  51,  51,  51,
+    51,  51,  51,  51,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  53,
+    53,  53,  53,  53,  53,  53,  53,  53,  53,  54,  54,  54,  54,  54,  54,
+    54,  54,  54,  54,  54,  55,  55,  55,  55,  55,  55,  55,  55,  55,  55,
+    56,  56,  56,  56,  56,  56,  56,  56,  56,  56,  56,  57,  57,  57,  57,
+    57,  57,  57,  57,  57,  57,  58,  58,  58,  58,  58,  58,  58,  58,  58,
+    58,  58,  59,  59,  59,  59,  59,  59,  59,  59,  59,  59,  60,  60,  60,
+    60,  60,  60,  60,  60,  60,  60,  60,  61,  61,  61,  61,  61,  61,  61,
+    61,  61,  61,  62,  62,  62,  62,  62,  62,  62,  62,  62,  62,  62,  63,
+    63,  63,  63,  63,  63,  63,  63,  63,  63,  64,  64,  64,  64,  64,  64,
+    64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+    66,  66,  66,  66,  66,  66,  66,  66,  66,  66,  66,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  68,  68,  68,  68,
+    68,  68,  69,  69,  69,  69,  69,  69,  69,  69,  69,  69,  70,  70,  70,
+    70,  70,  70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,
+    71,  71,  71,  71,  72,  72,  72,  72,  72,  72,  72,  72,  72,  72,  73,
+    73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,
+    74,  74,  74,  74,  74,  75,  75,  75,  75,  75,  75,  75,  75,  75,  75,
+    75,  76,  76,  76,  76,  76,  76,  76,  76,  76,  76,  76,  77,  77,  77,
+    77,  77,  77,  77,  77,  77,  77,  78,  78,  78,  78,  78,  78,  78,  78,
+    78,  78,  78,  79,  79,  79,  79,  79,  79,  79,  79,  79,  79,  79,  80,
+    80,  80,  80,  80,  80,  80,  80,  80,  80,  80,  81,  81,  81,  81,  81,
+    81,  81,  81,  81,  81,  82,  82,  82,  82,  82,  82,  82,  82,  82,  82,
+    82,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  84,  84,  84,
+    84,  84,  84,  84,  84,  84,  84,  84,  85,  85,  85,  85,  85,  85,  85,
+    85,  85,  85,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  88,  88,  88,  88,  88,
+    88,  88,  88,  88,  88,  88,  89,  89,  89,  89,  89,  89,  89,  89,  89,
+    89,  89,  90,  90,  90,  90,  90,  90,  90,  90,  90,  90,  90,  91,  91,
+    91,  91,  91,  91,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  92,
+    92,  92,  92,  92,  92,  93,  93,  93,  93,  93,  93,  93,  93,  93,  93,
+    94,  94,  94,  94,  94,  94,  94,  94,  94,  94,  94,  95,  95,  95,  95,
+    95,  95,  95,  95,  95,  95,  95,  96,  96,  96,  96,  96,  96,  96,  96,
+    96,  96,  96,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  98,
+    98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  99,  99,  99,  99,  99,
+    99,  99,  99,  99,  99,  99,  100, 100, 100, 100, 100, 100, 100, 100, 100,
+    100, 100, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 102,
+    102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 106, 106,
+    106, 106, 106, 106, 106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107,
+    107, 107, 107, 107, 107, 107, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+    108, 108, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110, 110, 111, 111, 111, 111, 111, 111,
+    111, 111, 111, 111, 111, 111, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+    112, 112, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 114, 114,
+    114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 115, 115, 115, 115, 115,
+    115, 115, 115, 115, 115, 115, 116, 116, 116, 116, 116, 116, 116, 116, 116,
+    116, 116, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 118,
+    118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 119, 119, 119, 119, 119,
+    119, 119, 119, 119, 119, 119, 119, 120, 120, 120, 120, 120, 120, 120, 120,
+    120, 120, 120, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+    122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 123, 123, 123,
+    123, 123, 123, 123, 123, 123, 123, 123, 124, 124, 124, 124, 124, 124, 124,
+    124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+    125, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 127, 127,
+    127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 129, 129, 129, 129, 129, 129, 129, 129,
+    129, 129, 129, 129, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+    131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132, 132,
+    132, 132, 132, 132, 132, 132, 132, 132, 132, 133, 133, 133, 133, 133, 133,
+    133, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+    134, 134, 134, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135,
+    136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 137, 137, 137,
+    137, 137, 137, 137, 137, 137, 137, 137, 137, 138, 138, 138, 138, 138, 138,
+    138, 138, 138, 138, 138, 138, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+    139, 139, 139, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+    141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 143, 143, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 144, 144, 144, 144, 144, 144, 144, 144,
+    144, 144, 144, 144, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    145, 145, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 147,
+    147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 148, 148, 148,
+    148, 148, 148, 148, 148, 148, 148, 148, 148, 149, 149, 149, 149, 149, 149,
+    149, 149, 149, 149, 149, 149, 149, 150, 150, 150, 150, 150, 150, 150, 150,
+    150, 150, 150, 150, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+    151, 151, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152,
+    153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 154, 154, 154,
+    154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 155, 155, 155, 155, 155,
+    155, 155, 155, 155, 155, 155, 155, 155, 156, 156, 156, 156, 156, 156, 156,
+    156, 156, 156, 156, 156, 156, 157, 157, 157, 157, 157, 157, 157, 157, 157,
+    157, 157, 157, 157, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    158, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 160,
+    160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 161, 161,
+    161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162, 162, 162,
+    162, 162, 162, 162, 162, 162, 162, 162, 162, 163, 163, 163, 163, 163, 163,
+    163, 163, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 164, 164, 164,
+    164, 164, 164, 164, 164, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+    165, 165, 165, 165, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+    166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+    168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 170, 170, 170,
+    170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 172, 172, 172, 172, 172,
+    172, 172, 172, 172, 172, 172, 172, 172, 173, 173, 173, 173, 173, 173, 173,
+    173, 173, 173, 173, 173, 173, 173, 174, 174, 174, 174, 174, 174, 174, 174,
+    174, 174, 174, 174, 174, 174, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+    175, 175, 175, 175, 175, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+    176, 176, 176, 176, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+    177, 177, 177, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178,
+    178, 178, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179,
+    179, 179, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180,
+    180, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+    182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 184,
+    184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 185,
+    185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 186,
+    186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 187,
+    187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 188,
+    188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 189,
+    189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 190,
+    190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 191,
+    191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 192,
+    192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+    193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193,
+    194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194,
+    194, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+    195, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+    196, 196, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197,
+    197, 197, 197, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198,
+    198, 198, 198, 198, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199,
+    199, 199, 199, 199, 199, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200,
+    200, 200, 200, 200, 200, 200, 200, 201, 201, 201, 201, 201, 201, 201, 201,
+    201, 201, 201, 201, 201, 201, 201, 201, 202, 202, 202, 202, 202, 202, 202,
+    202, 202, 202, 202, 202, 202, 202, 202, 202, 202, 203, 203, 203, 203, 203,
+    203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 204, 204, 204,
+    204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 205, 205,
+    205, 205, 205, 205, 205, 205, 205, 205, 205, 205, 205, 205, 205, 205, 205,
+    206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206,
+    206, 206, 206, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207,
+    207, 207, 207, 207, 207, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208,
+    208, 208, 208, 208, 208, 208, 208, 209, 209, 209, 209, 209, 209, 209, 209,
+    209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 211, 211,
+    211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211,
+    211, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212,
+    212, 212, 212, 212, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213,
+    213, 213, 213, 213, 213, 213, 213, 214, 214, 214, 214, 214, 214, 214, 214,
+    214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 215, 215, 215, 215,
+    215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217,
+    217, 217, 217, 217, 217, 217, 217, 217, 218, 218, 218, 218, 218, 218, 218,
+    218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 219, 219, 219,
+    219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219,
+    219, 219, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+    220, 220, 220, 220, 220, 220, 220, 221, 221, 221, 221, 221, 221, 221, 221,
+    221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 222, 222, 222,
+    222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222,
+    222, 222, 222, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223,
+    223, 223, 223, 223, 223, 223, 223, 223, 224, 224, 224, 224, 224, 224, 224,
+    224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 225,
+    225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+    225, 225, 225, 225, 225, 225, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+    226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 227, 227, 227,
+    227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+    227, 227, 227, 227, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228,
+    228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 229, 229, 229,
+    229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229,
+    229, 229, 229, 229, 229, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 231, 231,
+    231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231,
+    231, 231, 231, 231, 231, 231, 232, 232, 232, 232, 232, 232, 232, 232, 232,
+    232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232,
+    233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233,
+    233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235,
+    235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235,
+    235, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236,
+    236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 237, 237, 237,
+    237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237,
+    237, 237, 237, 237, 237, 237, 237, 237, 237, 238, 238, 238, 238, 238, 238,
+    238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238,
+    238, 238, 238, 238, 238, 238, 238, 239, 239, 239, 239, 239, 239, 239, 239,
+    239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239,
+    239, 239, 239, 239, 239, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240,
+    240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240,
+    240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+    241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+    241, 241, 241, 241, 241, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242,
+    242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242,
+    242, 242, 242, 242, 242, 242, 243, 243, 243, 243, 243, 243, 243, 243, 243,
+    243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243,
+    243, 243, 243, 243, 243, 243, 243, 243, 244, 244, 244, 244, 244, 244, 244,
+    244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+    244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 245, 245, 245,
+    245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245,
+    245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245,
+    245, 245, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246,
+    246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246,
+    246, 246, 246, 246, 246, 246, 246, 246, 246, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    247, 247, 247, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
+    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
+    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 249,
+    249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249,
+    249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249,
+    249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 250, 250,
+    250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250,
+    250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250,
+    250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250,
+    251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251,
+    251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251,
+    251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251,
+    251, 251, 251, 251, 251, 251, 251, 252, 252, 252, 252, 252, 252, 252, 252,
+    252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252,
+    252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252,
+    252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252,
+    252, 252, 252, 252, 252, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 254, 254, 254,
+    254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+    254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+    254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+    254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+    254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+    254, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255,
+};
+#elif QUADRANT_SIZE == 4096 && FAST_SINCOS_TABLE_BITS == 16
+static const uint16_t sineTable[4097] PROGMEM = {
+    0,     25,    50,    75,    101,   126,   151,   176,   201,   226,
+    251,   276,   302,   327,   352,   377,   402,   427,   452,   478,
+    503,   528,   553,   578,   603,   628,   653,   679,   704,   729,
+    754,   779,   804,   829,   854,   880,   905,   930,   955,   980,
+    1005,  1030,  1056,  1081,  1106,  1131,  1156,  1181,  1206,  1231,
+    1257,  1282,  1307,  1332,  1357,  1382,  1407,  1432,  1458,  1483,
+    1508,  1533,  1558,  1583,  1608,  1633,  1659,  1684,  1709,  1734,
+    1759,  1784,  1809,  1834,  1860,  1885,  1910,  1935,  1960,  1985,
+    2010,  2035,  2061,  2086,  2111,  2136,  2161,  2186,  2211,  2236,
+    2261,  2287,  2312,  2337,  2362,  2387,  2412,  2437,  2462,  2488,
+    2513,  2538,  2563,  2588,  2613,  2638,  2663,  2688,  2714,  2739,
+    2764,  2789,  2814,  2839,  2864,  2889,  2914,  2940,  2965,  2990,
+    3015,  3040,  3065,  3090,  3115,  3140,  3165,  3191,  3216,  3241,
+    3266,  3291,  3316,  3341,  3366,  3391,  3417,  3442,  3467,  3492,
+    3517,  3542,  3567,  3592,  3617,  3642,  3667,  3693,  3718,  3743,
+    3768,  3793,  3818,  3843,  3868,  3893,  3918,  3943,  3969,  3994,
+    4019,  4044,  4069,  4094,  4119,  4144,  4169,  4194,  4219,  4244,
+    4270,  4295,  4320,  4345,  4370,  4395,  4420,  4445,  4470,  4495,
+    4520,  4545,  4570,  4596,  4621,  4646,  4671,  4696,  4721,  4746,
+    4771,  4796,  4821,  4846,  4871,  4896,  4921,  4946,  4972,  4997,
+    5022,  5047,  5072,  5097,  5122,  5147,  5172,  5197,  5222,  5247,
+    5272,  5297,  5322,  5347,  5372,  5397,  5422,  5448,  5473,  5498,
+    5523,  5548,  5573,  5598,  5623,  5648,  5673,  5698,  5723,  5748,
+    5773,  5798,  5823,  5848,  5873,  5898,  5923,  5948,  5973,  5998,
+    6023,  6048,  6073,  6098,  6123,  6148,  6173,  6199,  6224,  6249,
+    6274,  6299,  6324,  6349,  6374,  6399,  6424,  6449,  6474,  6499,
+    6524,  6549,  6574,  6599,  6624,  6649,  6674,  6699,  6724,  6749,
+    6774,  6799,  6824,  6849,  6874,  6899,  6924,  6949,  6974,  6999,
+    7024,  7049,  7074,  7099,  7124,  7149,  7174,  7199,  7224,  7249,
+    7273,  7298,  7323,  7348,  7373,  7398,  7423,  7448,  7473,  7498,
+    7523,  7548,  7573,  7598,  7623,  7648,  7673,  7698,  7723,  7748,
+    7773,  7798,  7823,  7848,  7873,  7898,  7923,  7947,  7972,  7997,
+    8022,  8047,  8072,  8097,  8122,  8147,  8172,  8197,  8222,  8247,
+    8272,  8297,  8322,  8346,  8371,  8396,  8421,  8446,  8471,  8496,
+    8521,  8546,  8571,  8596,  8621,  8646,  8670,  8695,  8720,  8745,
+    8770,  8795,  8820,  8845,  8870,  8895,  8919,  8944,  8969,  8994,
+    9019,  9044,  9069,  9094,  9119,  9144,  9168,  9193,  9218,  9243,
+    9268,  9293,  9318,  9343,  9367,  9392,  9417,  9442,  9467,  9492,
+    9517,  9542,  9566,  9591,  9616,  9641,  9666,  9691,  9716,  9740,
+    9765,  9790,  9815,  9840,  9865,  9890,  9914,  9939,  9964,  9989,
+    10014, 10039, 10063, 10088, 10113, 10138, 10163, 10188, 10212, 10237,
+    10262, 10287, 10312, 10336, 10361, 10386, 10411, 10436, 10461, 10485,
+    10510, 10535, 10560, 10585, 10609, 10634, 10659, 10684, 10709, 10733,
+    10758, 10783, 10808, 10833, 10857, 10882, 10907, 10932, 10956, 10981,
+    11006, 11031, 11056, 11080, 11105, 11130, 11155, 11179, 11204, 11229,
+    11254, 11278, 11303, 11328, 11353, 11377, 11402, 11427, 11452, 11476,
+    11501, 11526, 11551, 11575, 11600, 11625, 11650, 11674, 11699, 11724,
+    11749, 11773, 11798, 11823, 11847, 11872, 11897, 11922, 11946, 11971,
+    11996, 12020, 12045, 12070, 12095, 12119, 12144, 12169, 12193, 12218,
+    12243, 12267, 12292, 12317, 12341, 12366, 12391, 12415, 12440, 12465,
+    12490, 12514, 12539, 12564, 12588, 12613, 12638, 12662, 12687, 12711,
+    12736, 12761, 12785, 12810, 12835, 12859, 12884, 12909, 12933, 12958,
+    12983, 13007, 13032, 13056, 13081, 13106, 13130, 13155, 13180, 13204,
+    13229, 13253, 13278, 13303, 13327, 13352, 13376, 13401, 13426, 13450,
+    13475, 13499, 13524, 13549, 13573, 13598, 13622, 13647, 13672, 13696,
+    13721, 13745, 13770, 13794, 13819, 13844, 13868, 13893, 13917, 13942,
+    13966, 13991, 14016, 14040, 14065, 14089, 14114, 14138, 14163, 14187,
+    14212, 14236, 14261, 14285, 14310, 14334, 14359, 14384, 14408, 14433,
+    14457, 14482, 14506, 14531, 14555, 14580, 14604, 14629, 14653, 14678,
+    14702, 14727, 14751, 14776, 14800, 14825, 14849, 14874, 14898, 14922,
+    14947, 14971, 14996, 15020, 15045, 15069, 15094, 15118, 15143, 15167,
+    15192, 15216, 15240, 15265, 15289, 15314, 15338, 15363, 15387, 15411,
+    15436, 15460, 15485, 15509, 15534, 15558, 15582, 15607, 15631, 15656,
+    15680, 15704, 15729, 15753, 15778, 15802, 15826, 15851, 15875, 15900,
+    15924, 15948, 15973, 15997, 16021, 16046, 16070, 16095, 16119, 16143,
+    16168, 16192, 16216, 16241, 16265, 16289, 16314, 16338, 16362, 16387,
+    16411, 16435, 16460, 16484, 16508, 16533, 16557, 16581, 16606, 16630,
+    16654, 16679, 16703, 16727, 16751, 16776, 16800, 16824, 16849, 16873,
+    16897, 16922, 16946, 16970, 16994, 17019, 17043, 17067, 17091, 17116,
+    17140, 17164, 17188, 17213, 17237, 17261, 17285, 17310, 17334, 17358,
+    17382, 17407, 17431, 17455, 17479, 17504, 17528, 17552, 17576, 17600,
+    17625, 17649, 17673, 17697, 17721, 17746, 17770, 17794, 17818, 17842,
+    17867, 17891, 17915, 17939, 17963, 17987, 18012, 18036, 18060, 18084,
+    18108, 18132, 18156, 18181, 18205, 18229, 18253, 18277, 18301, 18325,
+    18350, 18374, 18398, 18422, 18446, 18470, 18494, 18518, 18543, 18567,
+    18591, 18615, 18639, 18663, 18687, 18711, 18735, 18759, 18783, 18808,
+    18832, 18856, 18880, 18904, 18928, 18952, 18976, 19000, 19024, 19048,
+    19072, 19096, 19120, 19144, 19168, 19192, 19216, 19240, 19264, 19288,
+    19313, 19337, 19361, 19385, 19409, 19433, 19457, 19481, 19505, 19529,
+    19553, 19577, 19600, 19624, 19648, 19672, 19696, 19720, 19744, 19768,
+    19792, 19816, 19840, 19864, 19888, 19912, 19936, 19960, 19984, 20008,
+    20032, 20056, 20080, 20103, 20127, 20151, 20175, 20199, 20223, 20247,
+    20271, 20295, 20319, 20343, 20366, 20390, 20414, 20438, 20462, 20486,
+    20510, 20534, 20557, 20581, 20605, 20629, 20653, 20677, 20701, 20724,
+    20748, 20772, 20796, 20820, 20844, 20867, 20891, 20915, 20939, 20963,
+    20987, 21010, 21034, 21058, 21082, 21106, 21129, 21153, 21177, 21201,
+    21224, 21248, 21272, 21296, 21320, 21343, 21367, 21391, 21415, 21438,
+    21462, 21486, 21510, 21533, 21557, 21581, 21604, 21628, 21652, 21676,
+    21699, 21723, 21747, 21771, 21794, 21818, 21842, 21865, 21889, 21913,
+    21936, 21960, 21984, 22007, 22031, 22055, 22078, 22102, 22126, 22149,
+    22173, 22197, 22220, 22244, 22268, 22291, 22315, 22339, 22362, 22386,
+    22409, 22433, 22457, 22480, 22504, 22527, 22551, 22575, 22598, 22622,
+    22645, 22669, 22693, 22716, 22740, 22763, 22787, 22810, 22834, 22858,
+    22881, 22905, 22928, 22952, 22975, 22999, 23022, 23046, 23069, 23093,
+    23116, 23140, 23163, 23187, 23210, 23234, 23257, 23281, 23304, 23328,
+    23351, 23375, 23398, 23422, 23445, 23469, 23492, 23516, 23539, 23563,
+    23586, 23610, 23633, 23656, 23680, 23703, 23727, 23750, 23774, 23797,
+    23820, 23844, 23867, 23891, 23914, 23937, 23961, 23984, 24008, 24031,
+    24054, 24078, 24101, 24124, 24148, 24171, 24195, 24218, 24241, 24265,
+    24288, 24311, 24335, 24358, 24381, 24405, 24428, 24451, 24475, 24498,
+    24521, 24545, 24568, 24591, 24614, 24638, 24661, 24684, 24708, 24731,
+    24754, 24777, 24801, 24824, 24847, 24870, 24894, 24917, 24940, 24963,
+    24987, 25010, 25033, 25056, 25080, 25103, 25126, 25149, 25172, 25196,
+    25219, 25242, 25265, 25288, 25312, 25335, 25358, 25381, 25404, 25427,
+    25451, 25474, 25497, 25520, 25543, 25566, 25589, 25613, 25636, 25659,
+    25682, 25705, 25728, 25751, 25774, 25798, 25821, 25844, 25867, 25890,
+    25913, 25936, 25959, 25982, 26005, 26028, 26051, 26075, 26098, 26121,
+    26144, 26167, 26190, 26213, 26236, 26259, 26282, 26305, 26328, 26351,
+    26374, 26397, 26420, 26443, 26466, 26489, 26512, 26535, 26558, 26581,
+    26604, 26627, 26650, 26673, 26696, 26719, 26742, 26765, 26787, 26810,
+    26833, 26856, 26879, 26902, 26925, 26948, 26971, 26994, 27017, 27040,
+    27062, 27085, 27108, 27131, 27154, 27177, 27200, 27223, 27245, 27268,
+    27291, 27314, 27337, 27360, 27382, 27405, 27428, 27451, 27474, 27497,
+    27519, 27542, 27565, 27588, 27611, 27633, 27656, 27679, 27702, 27725,
+    27747, 27770, 27793, 27816, 27838, 27861, 27884, 27907, 27929, 27952,
+    27975, 27998, 28020, 28043, 28066, 28088, 28111, 28134, 28156, 28179,
+    28202, 28225, 28247, 28270, 28293, 28315, 28338, 28361, 28383, 28406,
+    28429, 28451, 28474, 28496, 28519, 28542, 28564, 28587, 28610, 28632,
+    28655, 28677, 28700, 28723, 28745, 28768, 28790, 28813, 28835, 28858,
+    28881, 28903, 28926, 28948, 28971, 28993, 29016, 29038, 29061, 29083,
+    29106, 29129, 29151, 29174, 29196, 29219, 29241, 29264, 29286, 29308,
+    29331, 29353, 29376, 29398, 29421, 29443, 29466, 29488, 29511, 29533,
+    29555, 29578, 29600, 29623, 29645, 29668, 29690, 29712, 29735, 29757,
+    29780, 29802, 29824, 29847, 29869, 29891, 29914, 29936, 29959, 29981,
+    30003, 30026, 30048, 30070, 30093, 30115, 30137, 30160, 30182, 30204,
+    30226, 30249, 30271, 30293, 30316, 30338, 30360, 30382, 30405, 30427,
+    30449, 30472, 30494, 30516, 30538, 30560, 30583, 30605, 30627, 30649,
+    30672, 30694, 30716, 30738, 30760, 30783, 30805, 30827, 30849, 30871,
+    30893, 30916, 30938, 30960, 30982, 31004, 31026, 31049, 31071, 31093,
+    31115, 31137, 31159, 31181, 31203, 31225, 31248, 31270, 31292, 31314,
+    31336, 31358, 31380, 31402, 31424, 31446, 31468, 31490, 31512, 31534,
+    31556, 31578, 31600, 31622, 31644, 31666, 31688, 31710, 31732, 31754,
+    31776, 31798, 31820, 31842, 31864, 31886, 31908, 31930, 31952, 31974,
+    31996, 32018, 32040, 32062, 32084, 32106, 32127, 32149, 32171, 32193,
+    32215, 32237, 32259, 32281, 32303, 32324, 32346, 32368, 32390, 32412,
+    32434, 32456, 32477, 32499, 32521, 32543, 32565, 32586, 32608, 32630,
+    32652, 32674, 32695, 32717, 32739, 32761, 32783, 32804, 32826, 32848,
+    32870, 32891, 32913, 32935, 32956, 32978, 33000, 33022, 33043, 33065,
+    33087, 33108, 33130, 33152, 33173, 33195, 33217, 33238, 33260, 33282,
+    33303, 33325, 33347, 33368, 33390, 33412, 33433, 33455, 33476, 33498,
+    33520, 33541, 33563, 33584, 33606, 33628, 33649, 33671, 33692, 33714,
+    33735, 33757, 33778, 33800, 33821, 33843, 33865, 33886, 33908, 33929,
+    33951, 33972, 33994, 34015, 34037, 34058, 34079, 34101, 34122, 34144,
+    34165, 34187, 34208, 34230, 34251, 34272, 34294, 34315, 34337, 34358,
+    34380, 34401, 34422, 34444, 34465, 34486, 34508, 34529, 34551, 34572,
+    34593, 34615, 34636, 34657, 34679, 34700, 34721, 34743, 34764, 34785,
+    34806, 34828, 34849, 34870, 34892, 34913, 34934, 34955, 34977, 34998,
+    35019, 35040, 35062, 35083, 35104, 35125, 35146, 35168, 35189, 35210,
+    35231, 35252, 35274, 35295, 35316, 35337, 35358, 35380, 35401, 35422,
+    35443, 35464, 35485, 35506, 35527, 35549, 35570, 35591, 35612, 35633,
+    35654, 35675, 35696, 35717, 35738, 35759, 35781, 35802, 35823, 35844,
+    35865, 35886, 35907, 35928, 35949, 35970, 35991, 36012, 36033, 36054,
+    36075, 36096, 36117, 36138, 36159, 36180, 36201, 36222, 36243, 36263,
+    36284, 36305, 36326, 36347, 36368, 36389, 36410, 36431, 36452, 36473,
+    36493, 36514, 36535, 36556, 36577, 36598, 36619, 36639, 36660, 36681,
+    36702, 36723, 36744, 36764, 36785, 36806, 36827, 36848, 36868, 36889,
+    36910, 36931, 36951, 36972, 36993, 37014, 37034, 37055, 37076, 37097,
+    37117, 37138, 37159, 37179, 37200, 37221, 37241, 37262, 37283, 37303,
+    37324, 37345, 37365, 37386, 37407, 37427, 37448, 37469, 37489, 37510,
+    37530, 37551, 37572, 37592, 37613, 37633, 37654, 37674, 37695, 37716,
+    37736, 37757, 37777, 37798, 37818, 37839, 37859, 37880, 37900, 37921,
+    37941, 37962, 37982, 38003, 38023, 38044, 38064, 38085, 38105, 38126,
+    38146, 38166, 38187, 38207, 38228, 38248, 38269, 38289, 38309, 38330,
+    38350, 38370, 38391, 38411, 38432, 38452, 38472, 38493, 38513, 38533,
+    38554, 38574, 38594, 38615, 38635, 38655, 38675, 38696, 38716, 38736,
+    38757, 38777, 38797, 38817, 38838, 38858, 38878, 38898, 38919, 38939,
+    38959, 38979, 38999, 39020, 39040, 39060, 39080, 39100, 39120, 39141,
+    39161, 39181, 39201, 39221, 39241, 39261, 39282, 39302, 39322, 39342,
+    39362, 39382, 39402, 39422, 39442, 39462, 39482, 39503, 39523, 39543,
+    39563, 39583, 39603, 39623, 39643, 39663, 39683, 39703, 39723, 39743,
+    39763, 39783, 39803, 39823, 39843, 39863, 39882, 39902, 39922, 39942,
+    39962, 39982, 40002, 40022, 40042, 40062, 40082, 40102, 40121, 40141,
+    40161, 40181, 40201, 40221, 40241, 40260, 40280, 40300, 40320, 40340,
+    40359, 40379, 40399, 40419, 40439, 40458, 40478, 40498, 40518, 40537,
+    40557, 40577, 40597, 40616, 40636, 40656, 40675, 40695, 40715, 40735,
+    40754, 40774, 40794, 40813, 40833, 40853, 40872, 40892, 40912, 40931,
+    40951, 40970, 40990, 41010, 41029, 41049, 41068, 41088, 41108, 41127,
+    41147, 41166, 41186, 41205, 41225, 41244, 41264, 41283, 41303, 41323,
+    41342, 41362, 41381, 41401, 41420, 41439, 41459, 41478, 41498, 41517,
+    41537, 41556, 41576, 41595, 41614, 41634, 41653, 41673, 41692, 41711,
+    41731, 41750, 41770, 41789, 41808, 41828, 41847, 41866, 41886, 41905,
+    41924, 41944, 41963, 41982, 42002, 42021, 42040, 42059, 42079, 42098,
+    42117, 42136, 42156, 42175, 42194, 42213, 42233, 42252, 42271, 42290,
+    42309, 42329, 42348, 42367, 42386, 42405, 42424, 42444, 42463, 42482,
+    42501, 42520, 42539, 42558, 42578, 42597, 42616, 42635, 42654, 42673,
+    42692, 42711, 42730, 42749, 42768, 42787, 42806, 42825, 42844, 42863,
+    42882, 42901, 42920, 42939, 42958, 42977, 42996, 43015, 43034, 43053,
+    43072, 43091, 43110, 43129, 43148, 43167, 43186, 43205, 43223, 43242,
+    43261, 43280, 43299, 43318, 43337, 43356, 43374, 43393, 43412, 43431,
+    43450, 43469, 43487, 43506, 43525, 43544, 43562, 43581, 43600, 43619,
+    43638, 43656, 43675, 43694, 43713, 43731, 43750, 43769, 43787, 43806,
+    43825, 43843, 43862, 43881, 43899, 43918, 43937, 43955, 43974, 43993,
+    44011, 44030, 44049, 44067, 44086, 44104, 44123, 44141, 44160, 44179,
+    44197, 44216, 44234, 44253, 44271, 44290, 44308, 44327, 44345, 44364,
+    44382, 44401, 44419, 44438, 44456, 44475, 44493, 44512, 44530, 44549,
+    44567, 44585, 44604, 44622, 44641, 44659, 44677, 44696, 44714, 44733,
+    44751, 44769, 44788, 44806, 44824, 44843, 44861, 44879, 44898, 44916,
+    44934, 44953, 44971, 44989, 45007, 45026, 45044, 45062, 45080, 45099,
+    45117, 45135, 45153, 45172, 45190, 45208, 45226, 45244, 45262, 45281,
+    45299, 45317, 45335, 45353, 45371, 45390, 45408, 45426, 45444, 45462,
+    45480, 45498, 45516, 45534, 45552, 45571, 45589, 45607, 45625, 45643,
+    45661, 45679, 45697, 45715, 45733, 45751, 45769, 45787, 45805, 45823,
+    45841, 45859, 45877, 45895, 45912, 45930, 45948, 45966, 45984, 46002,
+    46020, 46038, 46056, 46074, 46091, 46109, 46127, 46145, 46163, 46181,
+    46199, 46216, 46234, 46252, 46270, 46288, 46305, 46323, 46341, 46359,
+    46376, 46394, 46412, 46430, 46447, 46465, 46483, 46501, 46518, 46536,
+    46554, 46571, 46589, 46607, 46624, 46642, 46660, 46677, 46695, 46713,
+    46730, 46748, 46765, 46783, 46801, 46818, 46836, 46853, 46871, 46889,
+    46906, 46924, 46941, 46959, 46976, 46994, 47011, 47029, 47046, 47064,
+    47081, 47099, 47116, 47134, 47151, 47169, 47186, 47204, 47221, 47238,
+    47256, 47273, 47291, 47308, 47325, 47343, 47360, 47378, 47395, 47412,
+    47430, 47447, 47464, 47482, 47499, 47516, 47534, 47551, 47568, 47585,
+    47603, 47620, 47637, 47654, 47672, 47689, 47706, 47723, 47741, 47758,
+    47775, 47792, 47809, 47827, 47844, 47861, 47878, 47895, 47912, 47930,
+    47947, 47964, 47981, 47998, 48015, 48032, 48049, 48067, 48084, 48101,
+    48118, 48135, 48152, 48169, 48186, 48203, 48220, 48237, 48254, 48271,
+    48288, 48305, 48322, 48339, 48356, 48373, 48390, 48407, 48424, 48441,
+    48458, 48474, 48491, 48508, 48525, 48542, 48559, 48576, 48593, 48610,
+    48626, 48643, 48660, 48677, 48694, 48711, 48727, 48744, 48761, 48778,
+    48795, 48811, 48828, 48845, 48862, 48878, 48895, 48912, 48929, 48945,
+    48962, 48979, 48995, 49012, 49029, 49045, 49062, 49079, 49095, 49112,
+    49129, 49145, 49162, 49179, 49195, 49212, 49228, 49245, 49262, 49278,
+    49295, 49311, 49328, 49344, 49361, 49377, 49394, 49410, 49427, 49443,
+    49460, 49476, 49493, 49509, 49526, 49542, 49559, 49575, 49592, 49608,
+    49624, 49641, 49657, 49674, 49690, 49706, 49723, 49739, 49756, 49772,
+    49788, 49805, 49821, 49837, 49854, 49870, 49886, 49902, 49919, 49935,
+    49951, 49968, 49984, 50000, 50016, 50033, 50049, 50065, 50081, 50097,
+    50114, 50130, 50146, 50162, 50178, 50195, 50211, 50227, 50243, 50259,
+    50275, 50291, 50307, 50324, 50340, 50356, 50372, 50388, 50404, 50420,
+    50436, 50452, 50468, 50484, 50500, 50516, 50532, 50548, 50564, 50580,
+    50596, 50612, 50628, 50644, 50660, 50676, 50692, 50708, 50724, 50740,
+    50756, 50771, 50787, 50803, 50819, 50835, 50851, 50867, 50882, 50898,
+    50914, 50930, 50946, 50962, 50977, 50993, 51009, 51025, 51041, 51056,
+    51072, 51088, 51104, 51119, 51135, 51151, 51166, 51182, 51198, 51213,
+    51229, 51245, 51260, 51276, 51292, 51307, 51323, 51339, 51354, 51370,
+    51386, 51401, 51417, 51432, 51448, 51463, 51479, 51495, 51510, 51526,
+    51541, 51557, 51572, 51588, 51603, 51619, 51634, 51650, 51665, 51681,
+    51696, 51711, 51727, 51742, 51758, 51773, 51789, 51804, 51819, 51835,
+    51850, 51865, 51881, 51896, 51911, 51927, 51942, 51957, 51973, 51988,
+    52003, 52019, 52034, 52049, 52065, 52080, 52095, 52110, 52126, 52141,
+    52156, 52171, 52186, 52202, 52217, 52232, 52247, 52262, 52277, 52293,
+    52308, 52323, 52338, 52353, 52368, 52383, 52398, 52414, 52429, 52444,
+    52459, 52474, 52489, 52504, 52519, 52534, 52549, 52564, 52579, 52594,
+    52609, 52624, 52639, 52654, 52669, 52684, 52699, 52714, 52729, 52744,
+    52759, 52773, 52788, 52803, 52818, 52833, 52848, 52863, 52878, 52892,
+    52907, 52922, 52937, 52952, 52967, 52981, 52996, 53011, 53026, 53040,
+    53055, 53070, 53085, 53099, 53114, 53129, 53144, 53158, 53173, 53188,
+    53202, 53217, 53232, 53246, 53261, 53276, 53290, 53305, 53319, 53334,
+    53349, 53363, 53378, 53392, 53407, 53422, 53436, 53451, 53465, 53480,
+    53494, 53509, 53523, 53538, 53552, 53567, 53581, 53596, 53610, 53625,
+    53639, 53653, 53668, 53682, 53697, 53711, 53726, 53740, 53754, 53769,
+    53783, 53797, 53812, 53826, 53840, 53855, 53869, 53883, 53898, 53912,
+    53926, 53941, 53955, 53969, 53983, 53998, 54012, 54026, 54040, 54054,
+    54069, 54083, 54097, 54111, 54125, 54140, 54154, 54168, 54182, 54196,
+    54210, 54224, 54239, 54253, 54267, 54281, 54295, 54309, 54323, 54337,
+    54351, 54365, 54379, 54393, 54407, 54421, 54435, 54449, 54463, 54477,
+    54491, 54505, 54519, 54533, 54547, 54561, 54575, 54589, 54603, 54617,
+    54630, 54644, 54658, 54672, 54686, 54700, 54714, 54727, 54741, 54755,
+    54769, 54783, 54796, 54810, 54824, 54838, 54852, 54865, 54879, 54893,
+    54906, 54920, 54934, 54948, 54961, 54975, 54989, 55002, 55016, 55030,
+    55043, 55057, 55071, 55084, 55098, 55111, 55125, 55139, 55152, 55166,
+    55179, 55193, 55206, 55220, 55233, 55247, 55260, 55274, 55288, 55301,
+    55314, 55328, 55341, 55355, 55368, 55382, 55395, 55409, 55422, 55435,
+    55449, 55462, 55476, 55489, 55502, 55516, 55529, 55542, 55556, 55569,
+    55582, 55596, 55609, 55622, 55636, 55649, 55662, 55675, 55689, 55702,
+    55715, 55728, 55742, 55755, 55768, 55781, 55794, 55808, 55821, 55834,
+    55847, 55860, 55873, 55887, 55900, 55913, 55926, 55939, 55952, 55965,
+    55978, 55991, 56004, 56017, 56030, 56043, 56056, 56069, 56082, 56095,
+    56108, 56121, 56134, 56147, 56160, 56173, 56186, 56199, 56212, 56225,
+    56238, 56251, 56264, 56277, 56289, 56302, 56315, 56328, 56341, 56354,
+    56367, 56379, 56392, 56405, 56418, 56431, 56443, 56456, 56469, 56482,
+    56494, 56507, 56520, 56533, 56545, 56558, 56571, 56583, 56596, 56609,
+    56621, 56634, 56647, 56659, 56672, 56684, 56697, 56710, 56722, 56735,
+    56747, 56760, 56773, 56785, 56798, 56810, 56823, 56835, 56848, 56860,
+    56873, 56885, 56898, 56910, 56923, 56935, 56948, 56960, 56972, 56985,
+    56997, 57010, 57022, 57034, 57047, 57059, 57072, 57084, 57096, 57109,
+    57121, 57133, 57145, 57158, 57170, 57182, 57195, 57207, 57219, 57231,
+    57244, 57256, 57268, 57280, 57293, 57305, 57317, 57329, 57341, 57353,
+    57366, 57378, 57390, 57402, 57414, 57426, 57438, 57450, 57463, 57475,
+    57487, 57499, 57511, 57523, 57535, 57547, 57559, 57571, 57583, 57595,
+    57607, 57619, 57631, 57643, 57655, 57667, 57679, 57691, 57703, 57714,
+    57726, 57738, 57750, 57762, 57774, 57786, 57798, 57809, 57821, 57833,
+    57845, 57857, 57869, 57880, 57892, 57904, 57916, 57927, 57939, 57951,
+    57963, 57974, 57986, 57998, 58009, 58021, 58033, 58045, 58056, 58068,
+    58079, 58091, 58103, 58114, 58126, 58138, 58149, 58161, 58172, 58184,
+    58195, 58207, 58219, 58230, 58242, 58253, 58265, 58276, 58288, 58299,
+    58311, 58322, 58334, 58345, 58356, 58368, 58379, 58391, 58402, 58414,
+    58425, 58436, 58448, 58459, 58470, 58482, 58493, 58504, 58516, 58527,
+    58538, 58550, 58561, 58572, 58583, 58595, 58606, 58617, 58628, 58640,
+    58651, 58662, 58673, 58685, 58696, 58707, 58718, 58729, 58740, 58751,
+    58763, 58774, 58785, 58796, 58807, 58818, 58829, 58840, 58851, 58862,
+    58873, 58885, 58896, 58907, 58918, 58929, 58940, 58951, 58962, 58972,
+    58983, 58994, 59005, 59016, 59027, 59038, 59049, 59060, 59071, 59082,
+    59093, 59103, 59114, 59125, 59136, 59147, 59158, 59168, 59179, 59190,
+    59201, 59212, 59222, 59233, 59244, 59255, 59265, 59276, 59287, 59297,
+    59308, 59319, 59330, 59340, 59351, 59362, 59372, 59383, 59393, 59404,
+    59415, 59425, 59436, 59446, 59457, 59468, 59478, 59489, 59499, 59510,
+    59520, 59531, 59541, 59552, 59562, 59573, 59583, 59594, 59604, 59615,
+    59625, 59635, 59646, 59656, 59667, 59677, 59687, 59698, 59708, 59719,
+    59729, 59739, 59750, 59760, 59770, 59781, 59791, 59801, 59811, 59822,
+    59832, 59842, 59852, 59863, 59873, 59883, 59893, 59903, 59914, 59924,
+    59934, 59944, 59954, 59964, 59975, 59985, 59995, 60005, 60015, 60025,
+    60035, 60045, 60055, 60065, 60075, 60086, 60096, 60106, 60116, 60126,
+    60136, 60146, 60156, 60166, 60175, 60185, 60195, 60205, 60215, 60225,
+    60235, 60245, 60255, 60265, 60275, 60284, 60294, 60304, 60314, 60324,
+    60334, 60343, 60353, 60363, 60373, 60383, 60392, 60402, 60412, 60422,
+    60431, 60441, 60451, 60460, 60470, 60480, 60490, 60499, 60509, 60518,
+    60528, 60538, 60547, 60557, 60567, 60576, 60586, 60595, 60605, 60614,
+    60624, 60634, 60643, 60653, 60662, 60672, 60681, 60691, 60700, 60710,
+    60719, 60728, 60738, 60747, 60757, 60766, 60776, 60785, 60794, 60804,
+    60813, 60823, 60832, 60841, 60851, 60860, 60869, 60879, 60888, 60897,
+    60906, 60916, 60925, 60934, 60943, 60953, 60962, 60971, 60980, 60990,
+    60999, 61008, 61017, 61026, 61035, 61045, 61054, 61063, 61072, 61081,
+    61090, 61099, 61108, 61117, 61127, 61136, 61145, 61154, 61163, 61172,
+    61181, 61190, 61199, 61208, 61217, 61226, 61235, 61244, 61253, 61261,
+    61270, 61279, 61288, 61297, 61306, 61315, 61324, 61333, 61341, 61350,
+    61359, 61368, 61377, 61386, 61394, 61403, 61412, 61421, 61429, 61438,
+    61447, 61456, 61464, 61473, 61482, 61491, 61499, 61508, 61517, 61525,
+    61534, 61543, 61551, 61560, 61568, 61577, 61586, 61594, 61603, 61611,
+    61620, 61628, 61637, 61646, 61654, 61663, 61671, 61680, 61688, 61697,
+    61705, 61713, 61722, 61730, 61739, 61747, 61756, 61764, 61772, 61781,
+    61789, 61798, 61806, 61814, 61823, 61831, 61839, 61848, 61856, 61864,
+    61873, 61881, 61889, 61897, 61906, 61914, 61922, 61930, 61939, 61947,
+    61955, 61963, 61971, 61979, 61988, 61996, 62004, 62012, 62020, 62028,
+    62036, 62045, 62053, 62061, 62069, 62077, 62085, 62093, 62101, 62109,
+    62117, 62125, 62133, 62141, 62149, 62157, 62165, 62173, 62181, 62189,
+    62197, 62205, 62212, 62220, 62228, 62236, 62244, 62252, 62260, 62268,
+    62275, 62283, 62291, 62299, 62307, 62314, 62322, 62330, 62338, 62346,
+    62353, 62361, 62369, 62376, 62384, 62392, 62400, 62407, 62415, 62423,
+    62430, 62438, 62445, 62453, 62461, 62468, 62476, 62483, 62491, 62499,
+    62506, 62514, 62521, 62529, 62536, 62544, 62551, 62559, 62566, 62574,
+    62581, 62589, 62596, 62604, 62611, 62618, 62626, 62633, 62641, 62648,
+    62655, 62663, 62670, 62677, 62685, 62692, 62699, 62707, 62714, 62721,
+    62729, 62736, 62743, 62750, 62758, 62765, 62772, 62779, 62787, 62794,
+    62801, 62808, 62815, 62822, 62830, 62837, 62844, 62851, 62858, 62865,
+    62872, 62879, 62886, 62894, 62901, 62908, 62915, 62922, 62929, 62936,
+    62943, 62950, 62957, 62964, 62971, 62978, 62985, 62992, 62998, 63005,
+    63012, 63019, 63026, 63033, 63040, 63047, 63054, 63060, 63067, 63074,
+    63081, 63088, 63095, 63101, 63108, 63115, 63122, 63128, 63135, 63142,
+    63149, 63155, 63162, 63169, 63175, 63182, 63189, 63195, 63202, 63209,
+    63215, 63222, 63229, 63235, 63242, 63248, 63255, 63262, 63268, 63275,
+    63281, 63288, 63294, 63301, 63307, 63314, 63320, 63327, 63333, 63340,
+    63346, 63353, 63359, 63365, 63372, 63378, 63385, 63391, 63397, 63404,
+    63410, 63416, 63423, 63429, 63435, 63442, 63448, 63454, 63461, 63467,
+    63473, 63479, 63486, 63492, 63498, 63504, 63510, 63517, 63523, 63529,
+    63535, 63541, 63547, 63554, 63560, 63566, 63572, 63578, 63584, 63590,
+    63596, 63602, 63608, 63614, 63621, 63627, 63633, 63639, 63645, 63651,
+    63657, 63663, 63668, 63674, 63680, 63686, 63692, 63698, 63704, 63710,
+    63716, 63722, 63728, 63733, 63739, 63745, 63751, 63757, 63763, 63768,
+    63774, 63780, 63786, 63792, 63797, 63803, 63809, 63814, 63820, 63826,
+    63832, 63837, 63843, 63849, 63854, 63860, 63866, 63871, 63877, 63882,
+    63888, 63894, 63899, 63905, 63910, 63916, 63922, 63927, 63933, 63938,
+    63944, 63949, 63955, 63960, 63966, 63971, 63976, 63982, 63987, 63993,
+    63998, 64004, 64009, 64014, 64020, 64025, 64031, 64036, 64041, 64047,
+    64052, 64057, 64062, 64068, 64073, 64078, 64084, 64089, 64094, 64099,
+    64105, 64110, 64115, 64120, 64125, 64131, 64136, 64141, 64146, 64151,
+    64156, 64161, 64167, 64172, 64177, 64182, 64187, 64192, 64197, 64202,
+    64207, 64212, 64217, 64222, 64227, 64232, 64237, 64242, 64247, 64252,
+    64257, 64262, 64267, 64272, 64277, 64282, 64287, 64291, 64296, 64301,
+    64306, 64311, 64316, 64320, 64325, 64330, 64335, 64340, 64344, 64349,
+    64354, 64359, 64363, 64368, 64373, 64378, 64382, 64387, 64392, 64396,
+    64401, 64406, 64410, 64415, 64420, 64424, 64429, 64433, 64438, 64443,
+    64447, 64452, 64456, 64461, 64465, 64470, 64474, 64479, 64483, 64488,
+    64492, 64497, 64501, 64506, 64510, 64514, 64519, 64523, 64528, 64532,
+    64536, 64541, 64545, 64550, 64554, 64558, 64563, 64567, 64571, 64575,
+    64580, 64584, 64588, 64593, 64597, 64601, 64605, 64609, 64614, 64618,
+    64622, 64626, 64630, 64635, 64639, 64643, 64647, 64651, 64655, 64659,
+    64663, 64667, 64672, 64676, 64680, 64684, 64688, 64692, 64696, 64700,
+    64704, 64708, 64712, 64716, 64720, 64724, 64728, 64732, 64735, 64739,
+    64743, 64747, 64751, 64755, 64759, 64763, 64766, 64770, 64774, 64778,
+    64782, 64786, 64789, 64793, 64797, 64801, 64804, 64808, 64812, 64816,
+    64819, 64823, 64827, 64830, 64834, 64838, 64841, 64845, 64849, 64852,
+    64856, 64859, 64863, 64867, 64870, 64874, 64877, 64881, 64884, 64888,
+    64892, 64895, 64899, 64902, 64905, 64909, 64912, 64916, 64919, 64923,
+    64926, 64930, 64933, 64936, 64940, 64943, 64947, 64950, 64953, 64957,
+    64960, 64963, 64967, 64970, 64973, 64976, 64980, 64983, 64986, 64989,
+    64993, 64996, 64999, 65002, 65006, 65009, 65012, 65015, 65018, 65021,
+    65025, 65028, 65031, 65034, 65037, 65040, 65043, 65046, 65049, 65052,
+    65055, 65058, 65061, 65064, 65067, 65070, 65073, 65076, 65079, 65082,
+    65085, 65088, 65091, 65094, 65097, 65100, 65103, 65106, 65109, 65111,
+    65114, 65117, 65120, 65123, 65126, 65128, 65131, 65134, 65137, 65139,
+    65142, 65145, 65148, 65150, 65153, 65156, 65159, 65161, 65164, 65167,
+    65169, 65172, 65175, 65177, 65180, 65182, 65185, 65188, 65190, 65193,
+    65195, 65198, 65200, 65203, 65205, 65208, 65210, 65213, 65215, 65218,
+    65220, 65223, 65225, 65228, 65230, 65233, 65235, 65237, 65240, 65242,
+    65245, 65247, 65249, 65252, 65254, 65256, 65259, 65261, 65263, 65265,
+    65268, 65270, 65272, 65275, 65277, 65279, 65281, 65283, 65286, 65288,
+    65290, 65292, 65294, 65296, 65299, 65301, 65303, 65305, 65307, 65309,
+    65311, 65313, 65315, 65317, 65320, 65322, 65324, 65326, 65328, 65330,
+    65332, 65334, 65336, 65338, 65339, 65341, 65343, 65345, 65347, 65349,
+    65351, 65353, 65355, 65357, 65358, 65360, 65362, 65364, 65366, 65368,
+    65369, 65371, 65373, 65375, 65376, 65378, 65380, 65382, 65383, 65385,
+    65387, 65388, 65390, 65392, 65393, 65395, 65397, 65398, 65400, 65402,
+    65403, 65405, 65406, 65408, 65410, 65411, 65413, 65414, 65416, 65417,
+    65419, 65420, 65422, 65423, 65425, 65426, 65428, 65429, 65430, 65432,
+    65433, 65435, 65436, 65437, 65439, 65440, 65442, 65443, 65444, 65446,
+    65447, 65448, 65449, 65451, 65452, 65453, 65455, 65456, 65457, 65458,
+    65460, 65461, 65462, 65463, 65464, 65465, 65467, 65468, 65469, 65470,
+    65471, 65472, 65473, 65474, 65476, 65477, 65478, 65479, 65480, 65481,
+    65482, 65483, 65484, 65485, 65486, 65487, 65488, 65489, 65490, 65491,
+    65492, 65493, 65493, 65494, 65495, 65496, 65497, 65498, 65499, 65500,
+    65500, 65501, 65502, 65503, 65504, 65504, 65505, 65506, 65507, 65507,
+    65508, 65509, 65510, 65510, 65511, 65512, 65512, 65513, 65514, 65514,
+    65515, 65516, 65516, 65517, 65517, 65518, 65519, 65519, 65520, 65520,
+    65521, 65521, 65522, 65522, 65523, 65523, 65524, 65524, 65525, 65525,
+    65526, 65526, 65527, 65527, 65527, 65528, 65528, 65529, 65529, 65529,
+    65530, 65530, 65530, 65531, 65531, 65531, 65532, 65532, 65532, 65532,
+    65533, 65533, 65533, 65533, 65534, 65534, 65534, 65534, 65534, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535,
+};
+#elif QUADRANT_SIZE == 4096 && FAST_SINCOS_TABLE_BITS == 32
+static const uint32_t sineTable[4097] PROGMEM = {
+    0,          1647099,    3294198,    4941297,    6588395,    8235492,
+    9882587,    11529681,   13176774,   14823865,   16470953,   18118039,
+    19765122,   21412203,   23059280,   24706354,   26353424,   28000490,
+    29647552,   31294610,   32941664,   34588712,   36235755,   37882793,
+    39529826,   41176852,   42823873,   44470887,   46117895,   47764896,
+    49411890,   51058876,   52705856,   54352827,   55999790,   57646746,
+    59293692,   60940630,   62587559,   64234479,   65881389,   67528290,
+    69175181,   70822061,   72468931,   74115791,   75762639,   77409477,
+    79056303,   80703117,   82349920,   83996710,   85643488,   87290254,
+    88937007,   90583746,   92230472,   93877185,   95523884,   97170569,
+    98817239,   100463895,  102110537,  103757163,  105403774,  107050369,
+    108696949,  110343513,  111990060,  113636591,  115283106,  116929603,
+    118576083,  120222546,  121868991,  123515418,  125161827,  126808218,
+    128454590,  130100943,  131747276,  133393591,  135039886,  136686161,
+    138332416,  139978650,  141624864,  143271058,  144917230,  146563380,
+    148209510,  149855617,  151501702,  153147766,  154793806,  156439824,
+    158085819,  159731790,  161377738,  163023663,  164669563,  166315439,
+    167961291,  169607118,  171252920,  172898697,  174544448,  176190174,
+    177835874,  179481548,  181127195,  182772816,  184418409,  186063976,
+    187709515,  189355027,  191000511,  192645966,  194291394,  195936793,
+    197582163,  199227504,  200872815,  202518098,  204163350,  205808572,
+    207453764,  209098926,  210744057,  212389156,  214034225,  215679262,
+    217324267,  218969241,  220614182,  222259091,  223903967,  225548810,
+    227193620,  228838396,  230483139,  232127848,  233772523,  235417164,
+    237061769,  238706340,  240350876,  241995377,  243639842,  245284271,
+    246928664,  248573021,  250217341,  251861624,  253505870,  255150079,
+    256794251,  258438385,  260082480,  261726538,  263370557,  265014537,
+    266658479,  268302381,  269946243,  271590066,  273233849,  274877592,
+    276521294,  278164956,  279808577,  281452156,  283095695,  284739191,
+    286382646,  288026059,  289669429,  291312756,  292956041,  294599283,
+    296242481,  297885636,  299528747,  301171814,  302814837,  304457815,
+    306100748,  307743637,  309386480,  311029277,  312672029,  314314735,
+    315957395,  317600008,  319242574,  320885094,  322527566,  324169991,
+    325812368,  327454698,  329096979,  330739212,  332381396,  334023531,
+    335665617,  337307654,  338949641,  340591578,  342233465,  343875302,
+    345517088,  347158824,  348800508,  350442141,  352083723,  353725253,
+    355366730,  357008156,  358649529,  360290849,  361932116,  363573330,
+    365214491,  366855598,  368496651,  370137649,  371778594,  373419483,
+    375060318,  376701097,  378341821,  379982490,  381623102,  383263659,
+    384904159,  386544603,  388184989,  389825319,  391465591,  393105806,
+    394745962,  396386061,  398026102,  399666084,  401306007,  402945871,
+    404585676,  406225421,  407865107,  409504732,  411144298,  412783803,
+    414423247,  416062630,  417701952,  419341213,  420980412,  422619549,
+    424258624,  425897637,  427536587,  429175474,  430814298,  432453058,
+    434091755,  435730388,  437368957,  439007462,  440645902,  442284277,
+    443922588,  445560833,  447199012,  448837126,  450475174,  452113155,
+    453751070,  455388918,  457026700,  458664414,  460302060,  461939639,
+    463577150,  465214593,  466851967,  468489273,  470126510,  471763677,
+    473400776,  475037804,  476674763,  478311652,  479948470,  481585218,
+    483221895,  484858501,  486495035,  488131498,  489767889,  491404209,
+    493040456,  494676630,  496312732,  497948760,  499584716,  501220598,
+    502856406,  504492140,  506127800,  507763386,  509398897,  511034333,
+    512669694,  514304979,  515940189,  517575323,  519210381,  520845363,
+    522480268,  524115096,  525749847,  527384520,  529019116,  530653635,
+    532288075,  533922437,  535556720,  537190925,  538825051,  540459097,
+    542093064,  543726952,  545360759,  546994486,  548628133,  550261698,
+    551895183,  553528587,  555161910,  556795151,  558428309,  560061386,
+    561694381,  563327292,  564960121,  566592867,  568225530,  569858109,
+    571490604,  573123015,  574755342,  576387584,  578019742,  579651814,
+    581283802,  582915703,  584547519,  586179249,  587810893,  589442451,
+    591073921,  592705305,  594336602,  595967811,  597598933,  599229966,
+    600860912,  602491769,  604122538,  605753218,  607383808,  609014310,
+    610644721,  612275043,  613905275,  615535417,  617165468,  618795428,
+    620425298,  622055076,  623684762,  625314357,  626943860,  628573271,
+    630202589,  631831815,  633460947,  635089987,  636718933,  638347785,
+    639976544,  641605208,  643233779,  644862254,  646490635,  648118920,
+    649747111,  651375205,  653003204,  654631107,  656258914,  657886624,
+    659514237,  661141753,  662769172,  664396494,  666023718,  667650844,
+    669277872,  670904801,  672531632,  674158363,  675784996,  677411529,
+    679037963,  680664297,  682290530,  683916664,  685542696,  687168628,
+    688794459,  690420189,  692045817,  693671343,  695296767,  696922089,
+    698547308,  700172425,  701797439,  703422349,  705047156,  706671860,
+    708296459,  709920954,  711545345,  713169632,  714793813,  716417889,
+    718041860,  719665725,  721289485,  722913138,  724536685,  726160125,
+    727783459,  729406686,  731029805,  732652817,  734275721,  735898517,
+    737521205,  739143784,  740766255,  742388617,  744010870,  745633013,
+    747255046,  748876970,  750498783,  752120486,  753742079,  755363561,
+    756984931,  758606190,  760227338,  761848374,  763469298,  765090109,
+    766710808,  768331394,  769951868,  771572228,  773192474,  774812607,
+    776432626,  778052530,  779672321,  781291996,  782911557,  784531002,
+    786150333,  787769547,  789388646,  791007628,  792626495,  794245244,
+    795863877,  797482393,  799100792,  800719073,  802337236,  803955281,
+    805573208,  807191017,  808808707,  810426278,  812043729,  813661061,
+    815278274,  816895367,  818512339,  820129192,  821745923,  823362534,
+    824979024,  826595392,  828211639,  829827764,  831443766,  833059647,
+    834675405,  836291040,  837906553,  839521942,  841137208,  842752350,
+    844367368,  845982261,  847597031,  849211676,  850826195,  852440590,
+    854054860,  855669003,  857283021,  858896913,  860510679,  862124318,
+    863737830,  865351215,  866964473,  868577603,  870190606,  871803480,
+    873416227,  875028845,  876641334,  878253695,  879865926,  881478028,
+    883090000,  884701842,  886313554,  887925136,  889536587,  891147908,
+    892759097,  894370155,  895981082,  897591877,  899202539,  900813070,
+    902423468,  904033733,  905643866,  907253865,  908863731,  910473463,
+    912083061,  913692525,  915301854,  916911050,  918520110,  920129035,
+    921737825,  923346479,  924954997,  926563380,  928171626,  929779736,
+    931387708,  932995544,  934603243,  936210804,  937818228,  939425514,
+    941032661,  942639670,  944246541,  945853272,  947459865,  949066318,
+    950672631,  952278805,  953884839,  955490732,  957096485,  958702097,
+    960307568,  961912898,  963518087,  965123133,  966728038,  968332801,
+    969937421,  971541899,  973146233,  974750425,  976354473,  977958378,
+    979562138,  981165755,  982769227,  984372555,  985975738,  987578777,
+    989181669,  990784417,  992387019,  993989474,  995591784,  997193947,
+    998795963,  1000397833, 1001999555, 1003601131, 1005202558, 1006803838,
+    1008404969, 1010005953, 1011606787, 1013207473, 1014808010, 1016408398,
+    1018008636, 1019608725, 1021208663, 1022808452, 1024408090, 1026007577,
+    1027606913, 1029206098, 1030805132, 1032404015, 1034002745, 1035601324,
+    1037199750, 1038798023, 1040396144, 1041994112, 1043591926, 1045189587,
+    1046787095, 1048384448, 1049981647, 1051578692, 1053175582, 1054772317,
+    1056368897, 1057965322, 1059561591, 1061157705, 1062753662, 1064349463,
+    1065945107, 1067540595, 1069135926, 1070731099, 1072326115, 1073920973,
+    1075515674, 1077110216, 1078704600, 1080298825, 1081892891, 1083486798,
+    1085080546, 1086674134, 1088267562, 1089860831, 1091453939, 1093046886,
+    1094639673, 1096232299, 1097824763, 1099417066, 1101009208, 1102601187,
+    1104193004, 1105784659, 1107376152, 1108967481, 1110558647, 1112149650,
+    1113740490, 1115331166, 1116921677, 1118512025, 1120102207, 1121692226,
+    1123282079, 1124871767, 1126461289, 1128050646, 1129639837, 1131228862,
+    1132817720, 1134406412, 1135994937, 1137583295, 1139171486, 1140759509,
+    1142347364, 1143935052, 1145522571, 1147109921, 1148697103, 1150284116,
+    1151870960, 1153457635, 1155044139, 1156630474, 1158216639, 1159802634,
+    1161388457, 1162974111, 1164559593, 1166144903, 1167730043, 1169315010,
+    1170899806, 1172484429, 1174068880, 1175653158, 1177237264, 1178821196,
+    1180404955, 1181988540, 1183571952, 1185155189, 1186738252, 1188321141,
+    1189903854, 1191486393, 1193068757, 1194650945, 1196232957, 1197814794,
+    1199396454, 1200977938, 1202559245, 1204140376, 1205721329, 1207302105,
+    1208882703, 1210463124, 1212043367, 1213623431, 1215203317, 1216783024,
+    1218362552, 1219941901, 1221521071, 1223100061, 1224678871, 1226257501,
+    1227835951, 1229414220, 1230992308, 1232570215, 1234147941, 1235725486,
+    1237302848, 1238880029, 1240457028, 1242033844, 1243610477, 1245186928,
+    1246763195, 1248339279, 1249915180, 1251490897, 1253066429, 1254641777,
+    1256216941, 1257791920, 1259366714, 1260941323, 1262515747, 1264089984,
+    1265664036, 1267237902, 1268811581, 1270385074, 1271958380, 1273531498,
+    1275104430, 1276677174, 1278249730, 1279822098, 1281394278, 1282966270,
+    1284538073, 1286109687, 1287681112, 1289252347, 1290823393, 1292394249,
+    1293964915, 1295535390, 1297105676, 1298675770, 1300245673, 1301815385,
+    1303384906, 1304954235, 1306523372, 1308092317, 1309661069, 1311229629,
+    1312797996, 1314366170, 1315934151, 1317501938, 1319069531, 1320636931,
+    1322204136, 1323771147, 1325337963, 1326904584, 1328471010, 1330037241,
+    1331603275, 1333169115, 1334734758, 1336300205, 1337865455, 1339430508,
+    1340995365, 1342560024, 1344124486, 1345688750, 1347252816, 1348816684,
+    1350380354, 1351943825, 1353507098, 1355070171, 1356633045, 1358195719,
+    1359758194, 1361320469, 1362882543, 1364444417, 1366006091, 1367567563,
+    1369128835, 1370689905, 1372250773, 1373811440, 1375371905, 1376932167,
+    1378492227, 1380052084, 1381611738, 1383171189, 1384730436, 1386289480,
+    1387848320, 1389406956, 1390965388, 1392523615, 1394081637, 1395639454,
+    1397197066, 1398754472, 1400311673, 1401868668, 1403425456, 1404982039,
+    1406538414, 1408094583, 1409650544, 1411206299, 1412761845, 1414317184,
+    1415872315, 1417427238, 1418981952, 1420536458, 1422090755, 1423644842,
+    1425198720, 1426752389, 1428305848, 1429859096, 1431412135, 1432964963,
+    1434517580, 1436069986, 1437622181, 1439174164, 1440725936, 1442277496,
+    1443828844, 1445379980, 1446930903, 1448481613, 1450032110, 1451582394,
+    1453132464, 1454682321, 1456231964, 1457781392, 1459330606, 1460879606,
+    1462428391, 1463976960, 1465525315, 1467073454, 1468621377, 1470169084,
+    1471716574, 1473263849, 1474810907, 1476357747, 1477904371, 1479450777,
+    1480996966, 1482542937, 1484088690, 1485634225, 1487179541, 1488724638,
+    1490269517, 1491814176, 1493358616, 1494902837, 1496446837, 1497990617,
+    1499534177, 1501077517, 1502620636, 1504163534, 1505706210, 1507248665,
+    1508790899, 1510332910, 1511874700, 1513416267, 1514957611, 1516498733,
+    1518039632, 1519580307, 1521120759, 1522660987, 1524200992, 1525740772,
+    1527280328, 1528819659, 1530358765, 1531897646, 1533436302, 1534974733,
+    1536512937, 1538050916, 1539588668, 1541126195, 1542663494, 1544200566,
+    1545737412, 1547274030, 1548810421, 1550346583, 1551882518, 1553418225,
+    1554953703, 1556488952, 1558023973, 1559558764, 1561093326, 1562627658,
+    1564161761, 1565695633, 1567229276, 1568762687, 1570295869, 1571828819,
+    1573361538, 1574894025, 1576426281, 1577958305, 1579490097, 1581021657,
+    1582552984, 1584084079, 1585614940, 1587145569, 1588675964, 1590206125,
+    1591736052, 1593265745, 1594795204, 1596324429, 1597853419, 1599382173,
+    1600910693, 1602438977, 1603967025, 1605494837, 1607022414, 1608549754,
+    1610076857, 1611603724, 1613130353, 1614656746, 1616182901, 1617708818,
+    1619234497, 1620759938, 1622285141, 1623810105, 1625334831, 1626859317,
+    1628383564, 1629907572, 1631431340, 1632954868, 1634478156, 1636001203,
+    1637524010, 1639046576, 1640568901, 1642090985, 1643612827, 1645134427,
+    1646655786, 1648176902, 1649697776, 1651218407, 1652738796, 1654258941,
+    1655778843, 1657298502, 1658817917, 1660337088, 1661856014, 1663374697,
+    1664893135, 1666411327, 1667929275, 1669446978, 1670964435, 1672481646,
+    1673998611, 1675515330, 1677031803, 1678548029, 1680064008, 1681579740,
+    1683095225, 1684610462, 1686125451, 1687640193, 1689154686, 1690668931,
+    1692182927, 1693696674, 1695210173, 1696723421, 1698236421, 1699749171,
+    1701261670, 1702773920, 1704285919, 1705797667, 1707309165, 1708820411,
+    1710331406, 1711842150, 1713352642, 1714862881, 1716372869, 1717882604,
+    1719392087, 1720901317, 1722410293, 1723919016, 1725427486, 1726935702,
+    1728443664, 1729951372, 1731458825, 1732966024, 1734472968, 1735979657,
+    1737486090, 1738992268, 1740498191, 1742003857, 1743509267, 1745014421,
+    1746519318, 1748023958, 1749528341, 1751032467, 1752536335, 1754039945,
+    1755543298, 1757046392, 1758549228, 1760051805, 1761554124, 1763056183,
+    1764557983, 1766059524, 1767560805, 1769061826, 1770562587, 1772063087,
+    1773563327, 1775063306, 1776563023, 1778062480, 1779561675, 1781060608,
+    1782559280, 1784057689, 1785555836, 1787053720, 1788551342, 1790048700,
+    1791545795, 1793042627, 1794539195, 1796035499, 1797531539, 1799027314,
+    1800522825, 1802018072, 1803513053, 1805007769, 1806502219, 1807996404,
+    1809490323, 1810983976, 1812477362, 1813970482, 1815463335, 1816955921,
+    1818448240, 1819940291, 1821432075, 1822923591, 1824414839, 1825905818,
+    1827396529, 1828886971, 1830377145, 1831867049, 1833356683, 1834846048,
+    1836335144, 1837823969, 1839312523, 1840800808, 1842288821, 1843776564,
+    1845264035, 1846751235, 1848238164, 1849724821, 1851211205, 1852697318,
+    1854183158, 1855668725, 1857154019, 1858639040, 1860123788, 1861608262,
+    1863092463, 1864576389, 1866060042, 1867543419, 1869026523, 1870509351,
+    1871991904, 1873474182, 1874956184, 1876437911, 1877919361, 1879400536,
+    1880881434, 1882362055, 1883842400, 1885322468, 1886802258, 1888281771,
+    1889761006, 1891239963, 1892718642, 1894197043, 1895675165, 1897153008,
+    1898630572, 1900107857, 1901584863, 1903061589, 1904538035, 1906014201,
+    1907490086, 1908965691, 1910441016, 1911916059, 1913390821, 1914865302,
+    1916339501, 1917813419, 1919287054, 1920760407, 1922233478, 1923706266,
+    1925178771, 1926650992, 1928122931, 1929594586, 1931065957, 1932537044,
+    1934007847, 1935478365, 1936948599, 1938418548, 1939888212, 1941357590,
+    1942826684, 1944295491, 1945764012, 1947232247, 1948700196, 1950167859,
+    1951635234, 1953102322, 1954569124, 1956035637, 1957501863, 1958967802,
+    1960433452, 1961898813, 1963363887, 1964828671, 1966293167, 1967757373,
+    1969221290, 1970684917, 1972148255, 1973611302, 1975074059, 1976536526,
+    1977998702, 1979460587, 1980922181, 1982383484, 1983844495, 1985305214,
+    1986765642, 1988225777, 1989685620, 1991145170, 1992604427, 1994063392,
+    1995522063, 1996980440, 1998438524, 1999896314, 2001353810, 2002811012,
+    2004267918, 2005724531, 2007180848, 2008636870, 2010092597, 2011548027,
+    2013003163, 2014458002, 2015912545, 2017366791, 2018820741, 2020274393,
+    2021727749, 2023180807, 2024633568, 2026086031, 2027538196, 2028990063,
+    2030441631, 2031892901, 2033343872, 2034794544, 2036244917, 2037694990,
+    2039144764, 2040594237, 2042043411, 2043492284, 2044940857, 2046389129,
+    2047837100, 2049284770, 2050732138, 2052179205, 2053625970, 2055072433,
+    2056518594, 2057964452, 2059410008, 2060855261, 2062300210, 2063744857,
+    2065189200, 2066633239, 2068076974, 2069520405, 2070963532, 2072406354,
+    2073848871, 2075291084, 2076732991, 2078174592, 2079615889, 2081056879,
+    2082497563, 2083937941, 2085378012, 2086817777, 2088257235, 2089696386,
+    2091135229, 2092573765, 2094011993, 2095449913, 2096887525, 2098324829,
+    2099761824, 2101198510, 2102634887, 2104070955, 2105506713, 2106942162,
+    2108377301, 2109812130, 2111246649, 2112680857, 2114114754, 2115548341,
+    2116981616, 2118414580, 2119847232, 2121279573, 2122711602, 2124143318,
+    2125574722, 2127005814, 2128436593, 2129867058, 2131297211, 2132727050,
+    2134156575, 2135585787, 2137014684, 2138443267, 2139871536, 2141299490,
+    2142727128, 2144154452, 2145581461, 2147008154, 2148434531, 2149860592,
+    2151286337, 2152711766, 2154136878, 2155561673, 2156986152, 2158410313,
+    2159834156, 2161257682, 2162680890, 2164103780, 2165526352, 2166948605,
+    2168370540, 2169792156, 2171213452, 2172634430, 2174055087, 2175475425,
+    2176895444, 2178315141, 2179734519, 2181153576, 2182572312, 2183990727,
+    2185408821, 2186826594, 2188244045, 2189661174, 2191077981, 2192494466,
+    2193910629, 2195326469, 2196741986, 2198157179, 2199572050, 2200986597,
+    2202400821, 2203814720, 2205228295, 2206641547, 2208054473, 2209467075,
+    2210879352, 2212291304, 2213702930, 2215114231, 2216525206, 2217935855,
+    2219346178, 2220756174, 2222165844, 2223575187, 2224984203, 2226392892,
+    2227801253, 2229209287, 2230616993, 2232024371, 2233431420, 2234838141,
+    2236244534, 2237650597, 2239056332, 2240461737, 2241866812, 2243271558,
+    2244675974, 2246080060, 2247483816, 2248887241, 2250290335, 2251693099,
+    2253095531, 2254497632, 2255899401, 2257300839, 2258701944, 2260102717,
+    2261503158, 2262903267, 2264303042, 2265702485, 2267101594, 2268500370,
+    2269898812, 2271296921, 2272694695, 2274092136, 2275489241, 2276886012,
+    2278282449, 2279678550, 2281074316, 2282469746, 2283864841, 2285259600,
+    2286654023, 2288048109, 2289441859, 2290835272, 2292228349, 2293621088,
+    2295013490, 2296405554, 2297797281, 2299188670, 2300579720, 2301970432,
+    2303360806, 2304750841, 2306140537, 2307529894, 2308918911, 2310307589,
+    2311695927, 2313083926, 2314471584, 2315858901, 2317245878, 2318632514,
+    2320018810, 2321404764, 2322790376, 2324175647, 2325560576, 2326945164,
+    2328329408, 2329713311, 2331096871, 2332480088, 2333862962, 2335245493,
+    2336627680, 2338009524, 2339391024, 2340772179, 2342152991, 2343533458,
+    2344913580, 2346293358, 2347672791, 2349051878, 2350430620, 2351809016,
+    2353187066, 2354564770, 2355942128, 2357319139, 2358695804, 2360072122,
+    2361448092, 2362823716, 2364198992, 2365573920, 2366948500, 2368322732,
+    2369696616, 2371070152, 2372443338, 2373816176, 2375188665, 2376560804,
+    2377932594, 2379304034, 2380675124, 2382045864, 2383416254, 2384786293,
+    2386155981, 2387525319, 2388894305, 2390262940, 2391631224, 2392999156,
+    2394366736, 2395733963, 2397100839, 2398467362, 2399833532, 2401199349,
+    2402564813, 2403929924, 2405294681, 2406659084, 2408023134, 2409386829,
+    2410750170, 2412113157, 2413475788, 2414838065, 2416199987, 2417561553,
+    2418922764, 2420283619, 2421644118, 2423004261, 2424364047, 2425723477,
+    2427082550, 2428441266, 2429799626, 2431157627, 2432515272, 2433872558,
+    2435229487, 2436586057, 2437942269, 2439298123, 2440653617, 2442008753,
+    2443363530, 2444717947, 2446072005, 2447425703, 2448779041, 2450132019,
+    2451484637, 2452836894, 2454188790, 2455540326, 2456891500, 2458242313,
+    2459592764, 2460942854, 2462292582, 2463641948, 2464990951, 2466339592,
+    2467687870, 2469035785, 2470383337, 2471730526, 2473077351, 2474423812,
+    2475769910, 2477115644, 2478461013, 2479806017, 2481150657, 2482494932,
+    2483838842, 2485182387, 2486525566, 2487868380, 2489210827, 2490552909,
+    2491894624, 2493235973, 2494576955, 2495917570, 2497257818, 2498597699,
+    2499937213, 2501276359, 2502615136, 2503953546, 2505291588, 2506629261,
+    2507966565, 2509303501, 2510640068, 2511976265, 2513312093, 2514647551,
+    2515982640, 2517317358, 2518651707, 2519985684, 2521319292, 2522652528,
+    2523985393, 2525317888, 2526650010, 2527981762, 2529313141, 2530644149,
+    2531974784, 2533305047, 2534634937, 2535964455, 2537293599, 2538622371,
+    2539950769, 2541278793, 2542606444, 2543933721, 2545260624, 2546587152,
+    2547913306, 2549239085, 2550564490, 2551889519, 2553214173, 2554538451,
+    2555862354, 2557185880, 2558509031, 2559831805, 2561154203, 2562476225,
+    2563797869, 2565119136, 2566440027, 2567760539, 2569080674, 2570400432,
+    2571719811, 2573038812, 2574357434, 2575675678, 2576993543, 2578311029,
+    2579628136, 2580944864, 2582261212, 2583577180, 2584892768, 2586207977,
+    2587522804, 2588837252, 2590151318, 2591465004, 2592778308, 2594091231,
+    2595403773, 2596715933, 2598027711, 2599339107, 2600650120, 2601960751,
+    2603271000, 2604580865, 2605890348, 2607199447, 2608508163, 2609816496,
+    2611124444, 2612432008, 2613739189, 2615045985, 2616352396, 2617658422,
+    2618964064, 2620269320, 2621574191, 2622878676, 2624182776, 2625486490,
+    2626789817, 2628092759, 2629395313, 2630697482, 2631999263, 2633300657,
+    2634601664, 2635902283, 2637202515, 2638502358, 2639801814, 2641100882,
+    2642399561, 2643697852, 2644995753, 2646293266, 2647590390, 2648887124,
+    2650183468, 2651479423, 2652774988, 2654070163, 2655364947, 2656659341,
+    2657953344, 2659246957, 2660540178, 2661833008, 2663125446, 2664417493,
+    2665709148, 2667000411, 2668291281, 2669581760, 2670871845, 2672161538,
+    2673450838, 2674739745, 2676028258, 2677316378, 2678604104, 2679891436,
+    2681178373, 2682464917, 2683751066, 2685036821, 2686322180, 2687607144,
+    2688891714, 2690175887, 2691459665, 2692743048, 2694026034, 2695308624,
+    2696590818, 2697872615, 2699154015, 2700435018, 2701715624, 2702995833,
+    2704275644, 2705555058, 2706834074, 2708112691, 2709390911, 2710668731,
+    2711946154, 2713223177, 2714499801, 2715776026, 2717051852, 2718327278,
+    2719602305, 2720876931, 2722151157, 2723424983, 2724698408, 2725971433,
+    2727244057, 2728516279, 2729788101, 2731059520, 2732330539, 2733601155,
+    2734871369, 2736141181, 2737410591, 2738679598, 2739948203, 2741216404,
+    2742484202, 2743751597, 2745018589, 2746285176, 2747551360, 2748817140,
+    2750082515, 2751347487, 2752612053, 2753876214, 2755139971, 2756403322,
+    2757666268, 2758928809, 2760190943, 2761452672, 2762713995, 2763974911,
+    2765235421, 2766495524, 2767755220, 2769014509, 2770273391, 2771531866,
+    2772789933, 2774047592, 2775304843, 2776561686, 2777818121, 2779074147,
+    2780329764, 2781584973, 2782839772, 2784094163, 2785348143, 2786601714,
+    2787854876, 2789107627, 2790359968, 2791611899, 2792863419, 2794114528,
+    2795365227, 2796615514, 2797865390, 2799114855, 2800363908, 2801612549,
+    2802860778, 2804108595, 2805355999, 2806602991, 2807849570, 2809095736,
+    2810341489, 2811586829, 2812831755, 2814076268, 2815320366, 2816564051,
+    2817807321, 2819050177, 2820292619, 2821534645, 2822776257, 2824017454,
+    2825258235, 2826498600, 2827738550, 2828978085, 2830217203, 2831455905,
+    2832694190, 2833932059, 2835169511, 2836406546, 2837643164, 2838879364,
+    2840115147, 2841350513, 2842585460, 2843819990, 2845054101, 2846287794,
+    2847521068, 2848753924, 2849986360, 2851218377, 2852449975, 2853681154,
+    2854911913, 2856142252, 2857372171, 2858601669, 2859830747, 2861059405,
+    2862287642, 2863515458, 2864742853, 2865969826, 2867196378, 2868422509,
+    2869648217, 2870873503, 2872098368, 2873322809, 2874546829, 2875770425,
+    2876993599, 2878216349, 2879438676, 2880660580, 2881882060, 2883103116,
+    2884323748, 2885543956, 2886763740, 2887983099, 2889202033, 2890420543,
+    2891638627, 2892856286, 2894073520, 2895290328, 2896506710, 2897722666,
+    2898938196, 2900153300, 2901367977, 2902582227, 2903796051, 2905009447,
+    2906222417, 2907434959, 2908647073, 2909858759, 2911070018, 2912280848,
+    2913491250, 2914701224, 2915910769, 2917119885, 2918328572, 2919536830,
+    2920744659, 2921952058, 2923159027, 2924365567, 2925571676, 2926777355,
+    2927982603, 2929187421, 2930391809, 2931595765, 2932799290, 2934002384,
+    2935205046, 2936407277, 2937609075, 2938810442, 2940011376, 2941211879,
+    2942411948, 2943611585, 2944810789, 2946009560, 2947207897, 2948405801,
+    2949603272, 2950800308, 2951996911, 2953193080, 2954388814, 2955584114,
+    2956778979, 2957973409, 2959167404, 2960360964, 2961554089, 2962746778,
+    2963939031, 2965130849, 2966322230, 2967513175, 2968703684, 2969893756,
+    2971083391, 2972272590, 2973461351, 2974649675, 2975837561, 2977025010,
+    2978212021, 2979398594, 2980584729, 2981770425, 2982955683, 2984140502,
+    2985324883, 2986508824, 2987692326, 2988875389, 2990058012, 2991240195,
+    2992421939, 2993603242, 2994784105, 2995964528, 2997144510, 2998324051,
+    2999503152, 3000681811, 3001860029, 3003037805, 3004215140, 3005392033,
+    3006568483, 3007744492, 3008920059, 3010095182, 3011269864, 3012444102,
+    3013617897, 3014791249, 3015964158, 3017136623, 3018308645, 3019480222,
+    3020651356, 3021822045, 3022992289, 3024162090, 3025331445, 3026500356,
+    3027668821, 3028836841, 3030004416, 3031171545, 3032338228, 3033504466,
+    3034670257, 3035835602, 3037000500, 3038164952, 3039328957, 3040492515,
+    3041655625, 3042818289, 3043980505, 3045142273, 3046303593, 3047464466,
+    3048624890, 3049784866, 3050944393, 3052103472, 3053262102, 3054420283,
+    3055578014, 3056735296, 3057892129, 3059048512, 3060204445, 3061359928,
+    3062514960, 3063669543, 3064823674, 3065977355, 3067130585, 3068283364,
+    3069435692, 3070587569, 3071738993, 3072889966, 3074040487, 3075190556,
+    3076340173, 3077489337, 3078638049, 3079786308, 3080934114, 3082081467,
+    3083228366, 3084374812, 3085520805, 3086666344, 3087811428, 3088956059,
+    3090100236, 3091243957, 3092387225, 3093530037, 3094672395, 3095814297,
+    3096955744, 3098096736, 3099237272, 3100377352, 3101516976, 3102656145,
+    3103794856, 3104933112, 3106070910, 3107208252, 3108345137, 3109481565,
+    3110617535, 3111753049, 3112888104, 3114022701, 3115156841, 3116290522,
+    3117423746, 3118556510, 3119688816, 3120820663, 3121952052, 3123082981,
+    3124213451, 3125343461, 3126473012, 3127602102, 3128730733, 3129858904,
+    3130986614, 3132113864, 3133240654, 3134366982, 3135492850, 3136618256,
+    3137743202, 3138867685, 3139991707, 3141115268, 3142238366, 3143361002,
+    3144483176, 3145604887, 3146726136, 3147846922, 3148967245, 3150087105,
+    3151206502, 3152325435, 3153443905, 3154561911, 3155679453, 3156796530,
+    3157913144, 3159029293, 3160144978, 3161260197, 3162374952, 3163489242,
+    3164603066, 3165716426, 3166829319, 3167941747, 3169053709, 3170165205,
+    3171276234, 3172386797, 3173496894, 3174606524, 3175715687, 3176824383,
+    3177932612, 3179040373, 3180147667, 3181254493, 3182360851, 3183466742,
+    3184572164, 3185677117, 3186781603, 3187885619, 3188989167, 3190092246,
+    3191194855, 3192296995, 3193398666, 3194499867, 3195600598, 3196700860,
+    3197800651, 3198899972, 3199998822, 3201097202, 3202195111, 3203292549,
+    3204389516, 3205486012, 3206582036, 3207677589, 3208772670, 3209867279,
+    3210961415, 3212055080, 3213148273, 3214240992, 3215333239, 3216425014,
+    3217516315, 3218607143, 3219697497, 3220787378, 3221876786, 3222965719,
+    3224054179, 3225142164, 3226229675, 3227316712, 3228403274, 3229489361,
+    3230574973, 3231660111, 3232744772, 3233828959, 3234912670, 3235995905,
+    3237078664, 3238160947, 3239242754, 3240324084, 3241404938, 3242485315,
+    3243565216, 3244644639, 3245723585, 3246802054, 3247880045, 3248957559,
+    3250034595, 3251111152, 3252187232, 3253262833, 3254337956, 3255412601,
+    3256486766, 3257560453, 3258633660, 3259706389, 3260778637, 3261850407,
+    3262921696, 3263992506, 3265062836, 3266132685, 3267202055, 3268270943,
+    3269339351, 3270407278, 3271474725, 3272541690, 3273608174, 3274674176,
+    3275739697, 3276804736, 3277869293, 3278933368, 3279996961, 3281060071,
+    3282122699, 3283184844, 3284246506, 3285307686, 3286368382, 3287428595,
+    3288488324, 3289547570, 3290606332, 3291664610, 3292722403, 3293779713,
+    3294836538, 3295892879, 3296948735, 3298004106, 3299058992, 3300113393,
+    3301167308, 3302220738, 3303273682, 3304326141, 3305378113, 3306429600,
+    3307480600, 3308531114, 3309581141, 3310630681, 3311679735, 3312728301,
+    3313776381, 3314823973, 3315871077, 3316917694, 3317963823, 3319009464,
+    3320054617, 3321099281, 3322143457, 3323187145, 3324230344, 3325273054,
+    3326315275, 3327357006, 3328398249, 3329439002, 3330479265, 3331519038,
+    3332558322, 3333597115, 3334635418, 3335673231, 3336710553, 3337747384,
+    3338783724, 3339819574, 3340854932, 3341889799, 3342924174, 3343958058,
+    3344991450, 3346024350, 3347056758, 3348088674, 3349120097, 3350151028,
+    3351181466, 3352211411, 3353240863, 3354269823, 3355298288, 3356326261,
+    3357353739, 3358380724, 3359407215, 3360433212, 3361458715, 3362483723,
+    3363508237, 3364532256, 3365555780, 3366578810, 3367601344, 3368623383,
+    3369644927, 3370665975, 3371686527, 3372706583, 3373726144, 3374745208,
+    3375763776, 3376781847, 3377799422, 3378816500, 3379833081, 3380849165,
+    3381864752, 3382879842, 3383894434, 3384908528, 3385922125, 3386935223,
+    3387947824, 3388959926, 3389971529, 3390982635, 3391993241, 3393003349,
+    3394012957, 3395022067, 3396030677, 3397038788, 3398046399, 3399053510,
+    3400060122, 3401066233, 3402071844, 3403076955, 3404081566, 3405085676,
+    3406089285, 3407092393, 3408095000, 3409097106, 3410098710, 3411099813,
+    3412100414, 3413100513, 3414100111, 3415099206, 3416097799, 3417095890,
+    3418093478, 3419090564, 3420087146, 3421083226, 3422078802, 3423073876,
+    3424068445, 3425062512, 3426056074, 3427049133, 3428041687, 3429033738,
+    3430025284, 3431016326, 3432006863, 3432996895, 3433986423, 3434975445,
+    3435963962, 3436951974, 3437939481, 3438926482, 3439912977, 3440898966,
+    3441884449, 3442869426, 3443853897, 3444837861, 3445821319, 3446804269,
+    3447786713, 3448768650, 3449750080, 3450731002, 3451711417, 3452691324,
+    3453670723, 3454649614, 3455627998, 3456605873, 3457583240, 3458560098,
+    3459536447, 3460512288, 3461487620, 3462462443, 3463436756, 3464410561,
+    3465383855, 3466356640, 3467328916, 3468300681, 3469271936, 3470242681,
+    3471212916, 3472182640, 3473151854, 3474120556, 3475088748, 3476056429,
+    3477023598, 3477990256, 3478956403, 3479922038, 3480887161, 3481851773,
+    3482815872, 3483779459, 3484742533, 3485705096, 3486667145, 3487628682,
+    3488589706, 3489550216, 3490510214, 3491469698, 3492428669, 3493387126,
+    3494345069, 3495302498, 3496259414, 3497215815, 3498171702, 3499127074,
+    3500081932, 3501036275, 3501990103, 3502943416, 3503896214, 3504848497,
+    3505800264, 3506751515, 3507702251, 3508652471, 3509602175, 3510551363,
+    3511500034, 3512448189, 3513395828, 3514342949, 3515289554, 3516235642,
+    3517181213, 3518126267, 3519070803, 3520014821, 3520958322, 3521901305,
+    3522843770, 3523785717, 3524727146, 3525668057, 3526608449, 3527548322,
+    3528487676, 3529426512, 3530364828, 3531302625, 3532239903, 3533176662,
+    3534112901, 3535048620, 3535983819, 3536918498, 3537852657, 3538786295,
+    3539719414, 3540652011, 3541584088, 3542515644, 3543446679, 3544377193,
+    3545307186, 3546236657, 3547165607, 3548094035, 3549021941, 3549949325,
+    3550876187, 3551802527, 3552728345, 3553653640, 3554578412, 3555502662,
+    3556426389, 3557349593, 3558272273, 3559194431, 3560116064, 3561037175,
+    3561957761, 3562877824, 3563797363, 3564716377, 3565634868, 3566552833,
+    3567470275, 3568387192, 3569303584, 3570219451, 3571134792, 3572049609,
+    3572963901, 3573877667, 3574790907, 3575703621, 3576615810, 3577527473,
+    3578438609, 3579349220, 3580259304, 3581168861, 3582077892, 3582986395,
+    3583894372, 3584801822, 3585708745, 3586615140, 3587521008, 3588426348,
+    3589331160, 3590235445, 3591139201, 3592042430, 3592945130, 3593847302,
+    3594748945, 3595650059, 3596550645, 3597450702, 3598350229, 3599249228,
+    3600147697, 3601045637, 3601943047, 3602839927, 3603736278, 3604632098,
+    3605527388, 3606422148, 3607316378, 3608210077, 3609103246, 3609995884,
+    3610887990, 3611779566, 3612670611, 3613561124, 3614451106, 3615340556,
+    3616229475, 3617117861, 3618005716, 3618893039, 3619779829, 3620666087,
+    3621551813, 3622437006, 3623321666, 3624205794, 3625089388, 3625972449,
+    3626854977, 3627736972, 3628618433, 3629499360, 3630379754, 3631259613,
+    3632138939, 3633017730, 3633895988, 3634773710, 3635650898, 3636527552,
+    3637403671, 3638279254, 3639154303, 3640028816, 3640902794, 3641776237,
+    3642649144, 3643521515, 3644393351, 3645264650, 3646135414, 3647005641,
+    3647875332, 3648744486, 3649613104, 3650481185, 3651348729, 3652215736,
+    3653082206, 3653948138, 3654813534, 3655678391, 3656542712, 3657406494,
+    3658269739, 3659132445, 3659994613, 3660856244, 3661717335, 3662577888,
+    3663437903, 3664297379, 3665156316, 3666014713, 3666872572, 3667729891,
+    3668586671, 3669442912, 3670298613, 3671153774, 3672008395, 3672862476,
+    3673716017, 3674569017, 3675421477, 3676273397, 3677124776, 3677975614,
+    3678825911, 3679675668, 3680524883, 3681373556, 3682221689, 3683069280,
+    3683916329, 3684762836, 3685608802, 3686454225, 3687299106, 3688143445,
+    3688987242, 3689830496, 3690673207, 3691515376, 3692357002, 3693198084,
+    3694038624, 3694878620, 3695718073, 3696556982, 3697395348, 3698233170,
+    3699070448, 3699907181, 3700743371, 3701579017, 3702414118, 3703248675,
+    3704082687, 3704916154, 3705749076, 3706581454, 3707413286, 3708244573,
+    3709075315, 3709905511, 3710735162, 3711564267, 3712392826, 3713220839,
+    3714048305, 3714875226, 3715701601, 3716527428, 3717352710, 3718177444,
+    3719001632, 3719825273, 3720648367, 3721470913, 3722292913, 3723114364,
+    3723935269, 3724755625, 3725575434, 3726394695, 3727213408, 3728031572,
+    3728849189, 3729666257, 3730482776, 3731298747, 3732114169, 3732929043,
+    3733743367, 3734557142, 3735370368, 3736183044, 3736995171, 3737806749,
+    3738617777, 3739428255, 3740238183, 3741047560, 3741856388, 3742664666,
+    3743472393, 3744279569, 3745086195, 3745892270, 3746697794, 3747502767,
+    3748307189, 3749111059, 3749914379, 3750717146, 3751519363, 3752321027,
+    3753122140, 3753922700, 3754722709, 3755522165, 3756321069, 3757119421,
+    3757917220, 3758714466, 3759511160, 3760307300, 3761102888, 3761897922,
+    3762692404, 3763486331, 3764279706, 3765072527, 3765864794, 3766656507,
+    3767447666, 3768238271, 3769028322, 3769817819, 3770606761, 3771395149,
+    3772182982, 3772970260, 3773756984, 3774543152, 3775328765, 3776113823,
+    3776898326, 3777682273, 3778465665, 3779248501, 3780030781, 3780812505,
+    3781593674, 3782374286, 3783154341, 3783933841, 3784712784, 3785491170,
+    3786269000, 3787046272, 3787822988, 3788599147, 3789374748, 3790149792,
+    3790924279, 3791698209, 3792471580, 3793244394, 3794016650, 3794788348,
+    3795559488, 3796330070, 3797100093, 3797869558, 3798638465, 3799406812,
+    3800174601, 3800941831, 3801708503, 3802474615, 3803240167, 3804005161,
+    3804769595, 3805533469, 3806296784, 3807059539, 3807821734, 3808583369,
+    3809344444, 3810104959, 3810864913, 3811624307, 3812383140, 3813141413,
+    3813899125, 3814656276, 3815412866, 3816168894, 3816924362, 3817679268,
+    3818433613, 3819187396, 3819940618, 3820693277, 3821445375, 3822196911,
+    3822947885, 3823698296, 3824448145, 3825197432, 3825946156, 3826694317,
+    3827441916, 3828188951, 3828935424, 3829681334, 3830426680, 3831171463,
+    3831915683, 3832659339, 3833402431, 3834144960, 3834886924, 3835628325,
+    3836369162, 3837109434, 3837849142, 3838588286, 3839326865, 3840064879,
+    3840802329, 3841539214, 3842275534, 3843011289, 3843746478, 3844481103,
+    3845215161, 3845948655, 3846681583, 3847413945, 3848145741, 3848876971,
+    3849607636, 3850337734, 3851067265, 3851796231, 3852524630, 3853252462,
+    3853979728, 3854706427, 3855432559, 3856158124, 3856883122, 3857607552,
+    3858331416, 3859054712, 3859777440, 3860499601, 3861221193, 3861942219,
+    3862662676, 3863382565, 3864101885, 3864820638, 3865538822, 3866256438,
+    3866973485, 3867689963, 3868405873, 3869121213, 3869835985, 3870550187,
+    3871263820, 3871976884, 3872689379, 3873401303, 3874112659, 3874823444,
+    3875533660, 3876243305, 3876952381, 3877660886, 3878368821, 3879076186,
+    3879782980, 3880489204, 3881194857, 3881899939, 3882604450, 3883308390,
+    3884011759, 3884714557, 3885416784, 3886118439, 3886819522, 3887520034,
+    3888219974, 3888919343, 3889618139, 3890316364, 3891014016, 3891711096,
+    3892407604, 3893103539, 3893798902, 3894493692, 3895187909, 3895881553,
+    3896574625, 3897267123, 3897959048, 3898650400, 3899341179, 3900031384,
+    3900721015, 3901410073, 3902098557, 3902786468, 3903473804, 3904160566,
+    3904846754, 3905532368, 3906217407, 3906901872, 3907585762, 3908269078,
+    3908951818, 3909633984, 3910315575, 3910996591, 3911677032, 3912356897,
+    3913036187, 3913714901, 3914393040, 3915070604, 3915747591, 3916424003,
+    3917099838, 3917775098, 3918449781, 3919123888, 3919797419, 3920470373,
+    3921142750, 3921814551, 3922485775, 3923156423, 3923826493, 3924495986,
+    3925164902, 3925833241, 3926501002, 3927168186, 3927834793, 3928500821,
+    3929166272, 3929831146, 3930495441, 3931159158, 3931822297, 3932484857,
+    3933146840, 3933808244, 3934469069, 3935129316, 3935788984, 3936448073,
+    3937106583, 3937764515, 3938421867, 3939078639, 3939734833, 3940390447,
+    3941045482, 3941699937, 3942353812, 3943007108, 3943659823, 3944311959,
+    3944963515, 3945614490, 3946264885, 3946914700, 3947563934, 3948212588,
+    3948860661, 3949508153, 3950155065, 3950801395, 3951447145, 3952092313,
+    3952736900, 3953380906, 3954024331, 3954667173, 3955309435, 3955951114,
+    3956592212, 3957232728, 3957872662, 3958512014, 3959150783, 3959788971,
+    3960426576, 3961063598, 3961700038, 3962335896, 3962971170, 3963605862,
+    3964239971, 3964873497, 3965506439, 3966138799, 3966770575, 3967401768,
+    3968032378, 3968662403, 3969291846, 3969920704, 3970548979, 3971176669,
+    3971803776, 3972430298, 3973056236, 3973681590, 3974306360, 3974930545,
+    3975554145, 3976177161, 3976799592, 3977421438, 3978042699, 3978663375,
+    3979283466, 3979902972, 3980521892, 3981140228, 3981757977, 3982375141,
+    3982991719, 3983607712, 3984223118, 3984837939, 3985452174, 3986065822,
+    3986678884, 3987291360, 3987903250, 3988514553, 3989125269, 3989735399,
+    3990344942, 3990953898, 3991562267, 3992170050, 3992777245, 3993383853,
+    3993989873, 3994595306, 3995200152, 3995804410, 3996408080, 3997011163,
+    3997613658, 3998215565, 3998816884, 3999417615, 4000017757, 4000617312,
+    4001216278, 4001814655, 4002412444, 4003009645, 4003606256, 4004202279,
+    4004797713, 4005392558, 4005986814, 4006580481, 4007173558, 4007766047,
+    4008357945, 4008949255, 4009539974, 4010130104, 4010719645, 4011308595,
+    4011896955, 4012484726, 4013071906, 4013658496, 4014244496, 4014829906,
+    4015414725, 4015998953, 4016582591, 4017165638, 4017748094, 4018329960,
+    4018911234, 4019491918, 4020072010, 4020651511, 4021230421, 4021808739,
+    4022386466, 4022963601, 4023540145, 4024116097, 4024691457, 4025266225,
+    4025840401, 4026413986, 4026986978, 4027559377, 4028131185, 4028702400,
+    4029273022, 4029843052, 4030412489, 4030981334, 4031549585, 4032117244,
+    4032684310, 4033250783, 4033816662, 4034381948, 4034946641, 4035510741,
+    4036074247, 4036637159, 4037199478, 4037761203, 4038322334, 4038882872,
+    4039442815, 4040002164, 4040560919, 4041119080, 4041676647, 4042233619,
+    4042789996, 4043345779, 4043900968, 4044455561, 4045009560, 4045562964,
+    4046115773, 4046667987, 4047219606, 4047770630, 4048321058, 4048870891,
+    4049420128, 4049968770, 4050516816, 4051064267, 4051611122, 4052157381,
+    4052703044, 4053248110, 4053792581, 4054336456, 4054879734, 4055422416,
+    4055964502, 4056505991, 4057046884, 4057587180, 4058126879, 4058665981,
+    4059204486, 4059742395, 4060279706, 4060816420, 4061352537, 4061888057,
+    4062422979, 4062957304, 4063491032, 4064024161, 4064556693, 4065088628,
+    4065619964, 4066150703, 4066680843, 4067210385, 4067739330, 4068267676,
+    4068795423, 4069322573, 4069849124, 4070375076, 4070900430, 4071425185,
+    4071949341, 4072472898, 4072995856, 4073518216, 4074039976, 4074561137,
+    4075081699, 4075601662, 4076121025, 4076639789, 4077157953, 4077675517,
+    4078192482, 4078708847, 4079224613, 4079739778, 4080254343, 4080768308,
+    4081281674, 4081794438, 4082306603, 4082818167, 4083329131, 4083839494,
+    4084349257, 4084858418, 4085366980, 4085874940, 4086382299, 4086889058,
+    4087395215, 4087900771, 4088405726, 4088910080, 4089413833, 4089916984,
+    4090419533, 4090921481, 4091422827, 4091923572, 4092423715, 4092923256,
+    4093422195, 4093920532, 4094418266, 4094915399, 4095411930, 4095907858,
+    4096403184, 4096897907, 4097392028, 4097885546, 4098378461, 4098870774,
+    4099362484, 4099853591, 4100344095, 4100833997, 4101323295, 4101811989,
+    4102300081, 4102787569, 4103274454, 4103760735, 4104246413, 4104731488,
+    4105215958, 4105699825, 4106183088, 4106665747, 4107147802, 4107629253,
+    4108110101, 4108590343, 4109069982, 4109549016, 4110027446, 4110505272,
+    4110982493, 4111459109, 4111935121, 4112410528, 4112885330, 4113359527,
+    4113833119, 4114306106, 4114778489, 4115250266, 4115721438, 4116192004,
+    4116661965, 4117131321, 4117600071, 4118068216, 4118535755, 4119002688,
+    4119469016, 4119934738, 4120399853, 4120864363, 4121328267, 4121791565,
+    4122254256, 4122716341, 4123177820, 4123638693, 4124098959, 4124558618,
+    4125017671, 4125476117, 4125933957, 4126391189, 4126847815, 4127303834,
+    4127759246, 4128214051, 4128668249, 4129121839, 4129574823, 4130027199,
+    4130478967, 4130930128, 4131380682, 4131830628, 4132279966, 4132728697,
+    4133176819, 4133624334, 4134071241, 4134517540, 4134963231, 4135408314,
+    4135852789, 4136296655, 4136739913, 4137182563, 4137624604, 4138066037,
+    4138506861, 4138947076, 4139386683, 4139825681, 4140264070, 4140701851,
+    4141139022, 4141575584, 4142011537, 4142446881, 4142881616, 4143315742,
+    4143749258, 4144182165, 4144614462, 4145046150, 4145477228, 4145907696,
+    4146337555, 4146766804, 4147195443, 4147623472, 4148050891, 4148477700,
+    4148903899, 4149329488, 4149754467, 4150178835, 4150602593, 4151025740,
+    4151448277, 4151870204, 4152291520, 4152712225, 4153132319, 4153551803,
+    4153970676, 4154388937, 4154806588, 4155223628, 4155640057, 4156055875,
+    4156471081, 4156885676, 4157299660, 4157713032, 4158125793, 4158537942,
+    4158949480, 4159360406, 4159770720, 4160180423, 4160589514, 4160997993,
+    4161405860, 4161813114, 4162219757, 4162625788, 4163031206, 4163436013,
+    4163840207, 4164243788, 4164646757, 4165049114, 4165450858, 4165851990,
+    4166252509, 4166652415, 4167051708, 4167450389, 4167848456, 4168245911,
+    4168642752, 4169038981, 4169434596, 4169829599, 4170223987, 4170617763,
+    4171010925, 4171403474, 4171795410, 4172186731, 4172577440, 4172967534,
+    4173357015, 4173745882, 4174134136, 4174521775, 4174908800, 4175295212,
+    4175681009, 4176066193, 4176450762, 4176834717, 4177218057, 4177600783,
+    4177982895, 4178364393, 4178745276, 4179125544, 4179505198, 4179884237,
+    4180262661, 4180640471, 4181017665, 4181394245, 4181770210, 4182145560,
+    4182520295, 4182894415, 4183267919, 4183640808, 4184013082, 4184384741,
+    4184755784, 4185126212, 4185496024, 4185865221, 4186233802, 4186601768,
+    4186969118, 4187335852, 4187701970, 4188067472, 4188432359, 4188796629,
+    4189160283, 4189523321, 4189885744, 4190247550, 4190608739, 4190969312,
+    4191329269, 4191688610, 4192047334, 4192405442, 4192762933, 4193119807,
+    4193476065, 4193831706, 4194186730, 4194541137, 4194894928, 4195248101,
+    4195600658, 4195952598, 4196303920, 4196654625, 4197004713, 4197354184,
+    4197703038, 4198051274, 4198398893, 4198745894, 4199092278, 4199438044,
+    4199783193, 4200127724, 4200471637, 4200814933, 4201157610, 4201499670,
+    4201841112, 4202181936, 4202522142, 4202861730, 4203200700, 4203539052,
+    4203876785, 4204213901, 4204550397, 4204886276, 4205221536, 4205556178,
+    4205890201, 4206223606, 4206556392, 4206888559, 4207220108, 4207551038,
+    4207881349, 4208211041, 4208540114, 4208868569, 4209196404, 4209523621,
+    4209850218, 4210176196, 4210501555, 4210826295, 4211150416, 4211473917,
+    4211796798, 4212119061, 4212440704, 4212761727, 4213082131, 4213401915,
+    4213721080, 4214039624, 4214357550, 4214674855, 4214991540, 4215307606,
+    4215623051, 4215937877, 4216252083, 4216565668, 4216878633, 4217190979,
+    4217502704, 4217813808, 4218124293, 4218434157, 4218743401, 4219052024,
+    4219360027, 4219667409, 4219974170, 4220280311, 4220585832, 4220890731,
+    4221195010, 4221498668, 4221801705, 4222104122, 4222405917, 4222707091,
+    4223007645, 4223307577, 4223606888, 4223905578, 4224203647, 4224501095,
+    4224797921, 4225094126, 4225389709, 4225684671, 4225979012, 4226272731,
+    4226565829, 4226858305, 4227150159, 4227441392, 4227732003, 4228021992,
+    4228311359, 4228600105, 4228888229, 4229175730, 4229462610, 4229748868,
+    4230034503, 4230319517, 4230603908, 4230887677, 4231170824, 4231453349,
+    4231735252, 4232016532, 4232297189, 4232577224, 4232856637, 4233135427,
+    4233413595, 4233691140, 4233968062, 4234244362, 4234520039, 4234795093,
+    4235069525, 4235343333, 4235616519, 4235889082, 4236161021, 4236432338,
+    4236703032, 4236973103, 4237242550, 4237511374, 4237779576, 4238047154,
+    4238314108, 4238580439, 4238846147, 4239111232, 4239375693, 4239639531,
+    4239902745, 4240165335, 4240427302, 4240688646, 4240949365, 4241209461,
+    4241468933, 4241727782, 4241986006, 4242243607, 4242500584, 4242756937,
+    4243012666, 4243267771, 4243522251, 4243776108, 4244029341, 4244281949,
+    4244533933, 4244785293, 4245036029, 4245286141, 4245535628, 4245784490,
+    4246032729, 4246280342, 4246527332, 4246773697, 4247019437, 4247264552,
+    4247509043, 4247752910, 4247996151, 4248238768, 4248480760, 4248722128,
+    4248962870, 4249202987, 4249442480, 4249681348, 4249919590, 4250157208,
+    4250394200, 4250630568, 4250866310, 4251101427, 4251335919, 4251569786,
+    4251803027, 4252035643, 4252267634, 4252499000, 4252729740, 4252959854,
+    4253189343, 4253418207, 4253646445, 4253874057, 4254101044, 4254327405,
+    4254553141, 4254778251, 4255002735, 4255226593, 4255449825, 4255672432,
+    4255894413, 4256115768, 4256336496, 4256556599, 4256776076, 4256994927,
+    4257213152, 4257430751, 4257647723, 4257864070, 4258079790, 4258294884,
+    4258509352, 4258723193, 4258936408, 4259148997, 4259360959, 4259572295,
+    4259783005, 4259993088, 4260202544, 4260411374, 4260619577, 4260827154,
+    4261034104, 4261240428, 4261446125, 4261651195, 4261855638, 4262059454,
+    4262262644, 4262465207, 4262667143, 4262868452, 4263069134, 4263269189,
+    4263468618, 4263667419, 4263865593, 4264063140, 4264260060, 4264456353,
+    4264652018, 4264847057, 4265041468, 4265235252, 4265428409, 4265620938,
+    4265812840, 4266004115, 4266194762, 4266384782, 4266574174, 4266762939,
+    4266951076, 4267138586, 4267325469, 4267511723, 4267697350, 4267882350,
+    4268066722, 4268250466, 4268433582, 4268616071, 4268797931, 4268979164,
+    4269159770, 4269339747, 4269519096, 4269697818, 4269875912, 4270053377,
+    4270230215, 4270406424, 4270582006, 4270756959, 4270931285, 4271104982,
+    4271278051, 4271450492, 4271622305, 4271793490, 4271964046, 4272133974,
+    4272303274, 4272471945, 4272639988, 4272807403, 4272974189, 4273140347,
+    4273305877, 4273470778, 4273635050, 4273798694, 4273961709, 4274124096,
+    4274285855, 4274446984, 4274607485, 4274767358, 4274926601, 4275085216,
+    4275243202, 4275400560, 4275557289, 4275713389, 4275868860, 4276023702,
+    4276177915, 4276331500, 4276484455, 4276636782, 4276788480, 4276939548,
+    4277089988, 4277239799, 4277388980, 4277537533, 4277685456, 4277832751,
+    4277979416, 4278125452, 4278270859, 4278415636, 4278559785, 4278703304,
+    4278846194, 4278988455, 4279130086, 4279271088, 4279411461, 4279551204,
+    4279690318, 4279828802, 4279966657, 4280103883, 4280240479, 4280376446,
+    4280511783, 4280646491, 4280780569, 4280914017, 4281046836, 4281179026,
+    4281310585, 4281441516, 4281571816, 4281701487, 4281830528, 4281958939,
+    4282086720, 4282213872, 4282340394, 4282466286, 4282591549, 4282716181,
+    4282840184, 4282963557, 4283086300, 4283208413, 4283329896, 4283450749,
+    4283570972, 4283690566, 4283809529, 4283927862, 4284045565, 4284162638,
+    4284279082, 4284394894, 4284510077, 4284624630, 4284738553, 4284851845,
+    4284964508, 4285076540, 4285187942, 4285298713, 4285408855, 4285518366,
+    4285627247, 4285735498, 4285843118, 4285950108, 4286056468, 4286162197,
+    4286267297, 4286371765, 4286475604, 4286578811, 4286681389, 4286783336,
+    4286884652, 4286985339, 4287085394, 4287184819, 4287283614, 4287381778,
+    4287479312, 4287576215, 4287672487, 4287768129, 4287863140, 4287957521,
+    4288051271, 4288144390, 4288236879, 4288328737, 4288419964, 4288510561,
+    4288600527, 4288689862, 4288778567, 4288866641, 4288954084, 4289040896,
+    4289127078, 4289212628, 4289297548, 4289381837, 4289465495, 4289548523,
+    4289630919, 4289712685, 4289793820, 4289874324, 4289954197, 4290033439,
+    4290112050, 4290190030, 4290267379, 4290344098, 4290420185, 4290495641,
+    4290570466, 4290644661, 4290718224, 4290791156, 4290863458, 4290935128,
+    4291006167, 4291076575, 4291146352, 4291215498, 4291284012, 4291351896,
+    4291419149, 4291485770, 4291551760, 4291617119, 4291681847, 4291745944,
+    4291809410, 4291872244, 4291934447, 4291996019, 4292056960, 4292117270,
+    4292176948, 4292235995, 4292294411, 4292352195, 4292409348, 4292465870,
+    4292521761, 4292577021, 4292631649, 4292685646, 4292739011, 4292791745,
+    4292843848, 4292895319, 4292946160, 4292996368, 4293045946, 4293094892,
+    4293143206, 4293190890, 4293237942, 4293284362, 4293330151, 4293375309,
+    4293419835, 4293463730, 4293506993, 4293549625, 4293591626, 4293632995,
+    4293673732, 4293713838, 4293753313, 4293792156, 4293830368, 4293867948,
+    4293904897, 4293941214, 4293976900, 4294011954, 4294046376, 4294080168,
+    4294113327, 4294145855, 4294177752, 4294209017, 4294239650, 4294269652,
+    4294299023, 4294327762, 4294355869, 4294383344, 4294410189, 4294436401,
+    4294461982, 4294486932, 4294511249, 4294534936, 4294557990, 4294580413,
+    4294602205, 4294623365, 4294643893, 4294663790, 4294683055, 4294701688,
+    4294719690, 4294737060, 4294753798, 4294769905, 4294785381, 4294800224,
+    4294814436, 4294828017, 4294840966, 4294853283, 4294864968, 4294876022,
+    4294886444, 4294896235, 4294905394, 4294913921, 4294921817, 4294929081,
+    4294935713, 4294941714, 4294947083, 4294951820, 4294955926, 4294959400,
+    4294962243, 4294964454, 4294966033, 4294966980, 4294967295,
+};
+#else
+#error "No sine table for this QUADRANT_SIZE and FAST_SINCOS_TABLE_BITS"
+#endif
+// clang-format on
+
+#endif // FAST_SINCOS_TABLE_H
@@ -1,6 +1,10 @@
 
 #include "genetic.h"
 
+#ifdef GENETIC_FAST_MATH
+#include "fast_math.h"
+#endif
+
 /**
  * @brief Converts an unsigned integer digit to a char of the same number
  *
@@ -189,7 +193,11 @@ unsigned int randomPoissonGenerator(genetic_real expectedValue) {
 
   // This value is the target that the multiplication of random numbers cannot
   // go below
+#ifdef GENETIC_FAST_MATH
+  genetic_real cutoff = fastExp(-expectedValue, GENETIC_FAST_MATH);
+#else
   genetic_real cutoff = exp(-expectedValue);
+#endif
 
   for (; number > cutoff; value++) {
     number *= linear_congruential_random_generator();
@@ -8,6 +8,9 @@
 #include <stdint.h>
 #include <string.h>
 
+// Define GENETIC_FAST_MATH to a fast_math degree for the Poisson generator to
+// use fastExp instead of exp
+
 // We define a type for the fitness evaluation function that is passed in
 // parameters to the algorithm
 #ifndef genetic_real
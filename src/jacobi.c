@@ -1,15 +1,13 @@
 #include "jacobi.h"
+#include "matrix.h"
 
-/**
- * Converts a 2d coordinate in a square matrix to an index in a 2d array
- */
-static inline vec_size coordToIndex(vec_size row, vec_size col, vec_size size) {
-  return row * size + col;
-}
-
-static inline vec_size isDiagonal(vec_size index, vec_size size) {
-  return ((index / size) == (index % size));
-}
+// The loops of jacobiParallel are shared between threads when compiled with
+// OpenMP (-fopenmp), and run serially otherwise
+#ifdef _OPENMP
+#define JACOBI_PARALLEL_FOR _Pragma("omp parallel for schedule(static)")
+#else
+#define JACOBI_PARALLEL_FOR
+#endif
 
 /**
  * Finds the index of the element with the highest absolute value. Matrix must
@@ -26,7 +24,7 @@ void jacobiMaxIndex(real_number* matrix, vec_size size, vec_size* maxRow,
                     vec_size* maxCol) {
 
   real_number maxElement =
-      matrix[1]; // Cannot be first element since it's on the diagonal
+      fabs(matrix[1]); // Cannot be first element since it's on the diagonal
   vec_size currentMaxRow = 0;
   vec_size currentMaxCol = 1;
 
@@ -56,11 +54,15 @@ void jacobiMaxIndex(real_number* matrix, vec_size size, vec_size* maxRow,
 /**
  * Multiplies 2 matrices together using this equation : output = firstMatrix x
  * secondMatrix
- * @param firstMatrix first matrix to multiply of size m * n
+ * When real_number is the type of the matrix module, the blocked
+ * matrixMultiply is used. Otherwise, the rows of the output are accumulated
+ * from the rows of the second matrix.
+ * @param firstMatrix first matrix to multiply of size m * n, or n * m when it
+ * is transposed
  * @param secondMatrix second matrix to multiply of size n * p
  * @param size array of size 3 containing m, n and p
  * @param output matrix resulting of the matrix multiplication of the given
- * matrices
+ * matrices. Must not overlap the input matrices
  * @param transposeFirstMatrix whether to transpose the first matrix when
  * multiplying the matrices
  */
@@ -71,29 +73,46 @@ void jacobiMatrixMultiply(real_number* firstMatrix, real_number* secondMatrix,
   vec_size m = size[0];
   vec_size n = size[1];
   vec_size p = size[2];
+
+  // Resolved at compile time
+  if (sizeof(real_number) == sizeof(matrix_real_number)) {
+    const matrix_size sizes[3] = {m, n, p};
+    matrixMultiply((const matrix_real_number*)firstMatrix,
+                   (const matrix_real_number*)secondMatrix, sizes,
+                   (matrix_real_number*)output, transposeFirstMatrix);
+    return;
+  }
+
+  const vec_size depthStride = transposeFirstMatrix ? m : 1;
+  const vec_size rowStride = transposeFirstMatrix ? 1 : n;
   for (vec_size i = 0; i < m; ++i) {
+    const real_number* row = firstMatrix + i * rowStride;
+    real_number* outputRow = output + i * p;
     for (vec_size j = 0; j < p; ++j) {
-      real_number sum = 0.0;
-      for (register vec_size k = 0; k < n; ++k) {
-        sum += (transposeFirstMatrix ? firstMatrix[coordToIndex(k, i, n)]
-                                     : firstMatrix[coordToIndex(i, k, n)]) *
-               secondMatrix[coordToIndex(k, j, n)];
+      outputRow[j] = 0.0;
+    }
+    for (vec_size k = 0; k < n; ++k) {
+      const real_number element = row[k * depthStride];
+      const real_number* secondRow = secondMatrix + k * p;
+      for (vec_size j = 0; j < p; ++j) {
+        outputRow[j] += element * secondRow[j];
       }
-      output[coordToIndex(i, j, p)] = sum;
     }
   }
 }
 
 /**
- * Creates a jacobi rotation matrix (1 on the diagonal and the value of
- * cos(angle) and sin(angle) at row p and q)
- * @param row row where to put the c and s values
- * @param col column where to put the c and s values
- * @param output output matrix (must be square)
- * @param size size of the output matrix
+ * Computes the cosine and sine of the jacobi rotation that zeroes the element
+ * at (row, col) of the input matrix
+ * @param row row of the element to zero
+ * @param col column of the element to zero
+ * @param size size of the input matrix
+ * @param c pointer where the cosine will be stored
+ * @param s pointer where the sine will be stored
  */
-void jacobiCreateRotationMatrix(real_number* input, vec_size row, vec_size col,
-                                real_number* output, vec_size size) {
+static void jacobiRotationAngle(real_number* input, vec_size row, vec_size col,
+                                vec_size size, real_number* c,
+                                real_number* s) {
 
   real_number aqq = input[coordToIndex(col, col, size)];
   real_number app = input[coordToIndex(row, row, size)];
@@ -104,8 +123,54 @@ void jacobiCreateRotationMatrix(real_number* input, vec_size row, vec_size col,
   real_number t2 = -tau + sqrt(1 + tau * tau);
   real_number t = fabs(t1) > fabs(t2) ? t1 : t2;
 
-  real_number c = 1.0 / (sqrt(1 + t * t));
-  real_number s = c * t;
+  *c = 1.0 / (sqrt(1 + t * t));
+  *s = *c * t;
+}
+
+/**
+ * Computes the cosine and sine of the jacobi rotation that zeroes the element
+ * at (row, col) of the input matrix, with the smallest angle, at most pi / 4.
+ * jacobiRotationAngle takes the other root, which converges with the pivots of
+ * the classical version but very slowly with a fixed ordering.
+ * @param row row of the element to zero
+ * @param col column of the element to zero
+ * @param size size of the input matrix
+ * @param c pointer where the cosine will be stored
+ * @param s pointer where the sine will be stored
+ */
+static void jacobiSmallRotationAngle(real_number* input, vec_size row,
+                                     vec_size col, vec_size size,
+                                     real_number* c, real_number* s) {
+
+  real_number aqq = input[coordToIndex(col, col, size)];
+  real_number app = input[coordToIndex(row, row, size)];
+  real_number apq = input[coordToIndex(row, col, size)];
+
+  // Root of t^2 + 2 * tau * t - 1 = 0 with the smallest absolute value,
+  // written to avoid the cancellation
+  real_number tau = (aqq - app) / (2.0 * apq);
+  real_number t = 1.0 / (fabs(tau) + sqrt(1 + tau * tau));
+  if (tau < 0) {
+    t = -t;
+  }
+
+  *c = 1.0 / (sqrt(1 + t * t));
+  *s = *c * t;
+}
+
+/**
+ * Creates a jacobi rotation matrix (1 on the diagonal and the value of
+ * cos(angle) and sin(angle) at row p and q)
+ * @param row row where to put the c and s values
+ * @param col column where to put the c and s values
+ * @param output output matrix (must be square)
+ * @param size size of the output matrix
+ */
+void jacobiCreateRotationMatrix(real_number* input, vec_size row, vec_size col,
+                                real_number* output, vec_size size) {
+
+  real_number c, s;
+  jacobiRotationAngle(input, row, col, size, &c, &s);
 
   vec_size cIndex1 = coordToIndex(row, row, size);
   vec_size cIndex2 = coordToIndex(col, col, size);
@@ -128,6 +193,49 @@ void jacobiCreateRotationMatrix(real_number* input, vec_size row, vec_size col,
   }
 }
 
+/**
+ * Applies a jacobi rotation R, as created by jacobiCreateRotationMatrix, in
+ * place: matrix = transpose(R) x matrix x R and eigenVectors = eigenVectors x
+ * R. R only differs from the identity on the rows and columns row and col, so
+ * only these rows and columns change, in O(size) operations.
+ * @param matrix the matrix to rotate
+ * @param eigenVectors the matrix accumulating the rotations
+ * @param size size of the matrices
+ * @param row first row and column of the rotation
+ * @param col second row and column of the rotation
+ * @param c cosine of the rotation
+ * @param s sine of the rotation
+ */
+static void jacobiRotate(real_number* matrix, real_number* eigenVectors,
+                         vec_size size, vec_size row, vec_size col,
+                         real_number c, real_number s) {
+
+  // Columns of matrix x R and of eigenVectors x R
+  for (vec_size i = 0; i < size; ++i) {
+    real_number* matrixRow = matrix + i * size;
+    real_number aip = matrixRow[row];
+    real_number aiq = matrixRow[col];
+    matrixRow[row] = c * aip - s * aiq;
+    matrixRow[col] = s * aip + c * aiq;
+
+    real_number* vectorRow = eigenVectors + i * size;
+    real_number vip = vectorRow[row];
+    real_number viq = vectorRow[col];
+    vectorRow[row] = c * vip - s * viq;
+    vectorRow[col] = s * vip + c * viq;
+  }
+
+  // Rows of transpose(R) x matrix
+  real_number* rowP = matrix + row * size;
+  real_number* rowQ = matrix + col * size;
+  for (vec_size j = 0; j < size; ++j) {
+    real_number apj = rowP[j];
+    real_number aqj = rowQ[j];
+    rowP[j] = c * apj - s * aqj;
+    rowQ[j] = s * apj + c * aqj;
+  }
+}
+
 /**
  * Creates the identity matrix (1 on the diagonal and 0 on other coordinates)
  * @param size size of the matrix
@@ -162,6 +270,117 @@ real_number jacobiComputeOffDiagonalSum(real_number* matrix, vec_size size) {
   return sum;
 }
 
+/**
+ * Computes the absolute sum of the off diagonal elements in the rows and
+ * columns row and col, which are the only ones changed by a jacobi rotation
+ * @param matrix matrix to compute the sum on
+ * @param size size of matrix
+ * @param row first row and column
+ * @param col second row and column
+ */
+static real_number jacobiRotatedSum(real_number* matrix, vec_size size,
+                                   vec_size row, vec_size col) {
+  const real_number* rowP = matrix + row * size;
+  const real_number* rowQ = matrix + col * size;
+  real_number sum = 0;
+  for (vec_size j = 0; j < size; ++j) {
+    if (j != row) {
+      sum += fabs(rowP[j]);
+    }
+    if (j != col) {
+      sum += fabs(rowQ[j]);
+    }
+  }
+  for (vec_size i = 0; i < size; ++i) {
+    if (i != row && i != col) {
+      sum += fabs(matrix[i * size + row]) + fabs(matrix[i * size + col]);
+    }
+  }
+  return sum;
+}
+
+/**
+ * Finds the column of the off diagonal element with the highest absolute value
+ * in a row. On ties, the first column is kept, as in jacobiMaxIndex.
+ * @param matrix must be a square matrix of size at least 2
+ * @param size size of the matrix
+ * @param row row to scan
+ * @param rowMaxCols array where the column will be stored, at index row
+ */
+static void jacobiScanRowMax(real_number* matrix, vec_size size, vec_size row,
+                             vec_size* rowMaxCols) {
+  const real_number* elements = matrix + row * size;
+  vec_size maxCol = row == 0 ? 1 : 0;
+  for (vec_size j = maxCol + 1; j < size; ++j) {
+    if (j != row && fabs(elements[j]) > fabs(elements[maxCol])) {
+      maxCol = j;
+    }
+  }
+  rowMaxCols[row] = maxCol;
+}
+
+/**
+ * Updates the column of the largest off diagonal element of each row after a
+ * rotation of the rows and columns row and col. Only these two rows, and the
+ * rows whose largest element was in these columns, are scanned again.
+ * @param matrix the rotated matrix
+ * @param size size of the matrix
+ * @param row first row and column of the rotation
+ * @param col second row and column of the rotation
+ * @param rowMaxCols column of the largest off diagonal element of each row
+ */
+static void jacobiUpdateRowMax(real_number* matrix, vec_size size, vec_size row,
+                               vec_size col, vec_size* rowMaxCols) {
+  const vec_size first = row < col ? row : col;
+  const vec_size second = row < col ? col : row;
+  for (vec_size i = 0; i < size; ++i) {
+    vec_size maxCol = rowMaxCols[i];
+    if (i == row || i == col || maxCol == row || maxCol == col) {
+      jacobiScanRowMax(matrix, size, i, rowMaxCols);
+      continue;
+    }
+
+    // Only the elements in the rotated columns changed
+    const real_number* elements = matrix + i * size;
+    if (fabs(elements[first]) > fabs(elements[maxCol]) ||
+        (fabs(elements[first]) == fabs(elements[maxCol]) && first < maxCol)) {
+      maxCol = first;
+    }
+    if (fabs(elements[second]) > fabs(elements[maxCol]) ||
+        (fabs(elements[second]) == fabs(elements[maxCol]) &&
+         second < maxCol)) {
+      maxCol = second;
+    }
+    rowMaxCols[i] = maxCol;
+  }
+}
+
+/**
+ * Finds the index of the off diagonal element with the highest absolute value
+ * from the largest element of each row, in O(size). Gives the same element as
+ * jacobiMaxIndex.
+ * @param matrix must be a square matrix of size at least 2
+ * @param size size of the matrix
+ * @param rowMaxCols column of the largest off diagonal element of each row
+ * @param maxRow pointer where the row of the maximum element will be stored
+ * @param maxCol pointer where the column of the maximum element will be stored
+ */
+static void jacobiCachedMaxIndex(real_number* matrix, vec_size size,
+                                 vec_size* rowMaxCols, vec_size* maxRow,
+                                 vec_size* maxCol) {
+  vec_size currentMaxRow = 0;
+  real_number maxElement = fabs(matrix[rowMaxCols[0]]);
+  for (vec_size i = 1; i < size; ++i) {
+    real_number elem = fabs(matrix[coordToIndex(i, rowMaxCols[i], size)]);
+    if (elem > maxElement) {
+      currentMaxRow = i;
+      maxElement = elem;
+    }
+  }
+  *maxRow = currentMaxRow;
+  *maxCol = rowMaxCols[currentMaxRow];
+}
+
 /**
  * Computes the jacobi method to find the eigenvalues and eigenvectors of the
  * input matrix
@@ -174,23 +393,48 @@ real_number jacobiComputeOffDiagonalSum(real_number* matrix, vec_size size) {
  * -1 to allow any amount of iterations)
  * @param cyclic whether to use the cyclic jacobi method or the classical
  * version
+ *
+ * The off diagonal sum is updated after each rotation from the rows and
+ * columns it changed, and computed again once per sweep, and before stopping,
+ * so that the rounding errors do not accumulate. The classical version keeps
+ * the largest element of each row in a buffer of size elements, allocated on
+ * the heap, to find the pivot in O(size). The cyclic version rotates by the
+ * smallest angle, see jacobiSmallRotationAngle.
  */
 void jacobi(real_number* inputMatrix, vec_size size, real_number* outputMatrix,
             vec_size max_iterations, vec_size cyclic) {
 
-  vec_size sizes3d[3] = {size, size, size};
   vec_size sweepSize =
       (size * (size - 1) >>
        1); // A sweep is defined as a n * (n - 1) / 2 jacobi rotations
-  real_number rotationMatrix[size * size];
-  real_number vBuffer[size * size];
-  real_number aBuffer[size * size];
+  real_number c, s;
   vec_size maxRow, maxCol, indexToMinimize = 0;
   vec_size sizeSquared = size * size;
+  real_number precision = pow(10, -(DIGITS_PRECISION + 2));
+
+  // The large root only converges quickly with the pivots of the classical
+  // version, see jacobiSmallRotationAngle
+  void (*rotationAngle)(real_number*, vec_size, vec_size, vec_size,
+                        real_number*, real_number*) =
+      cyclic ? jacobiSmallRotationAngle : jacobiRotationAngle;
+
+  // Column of the largest off diagonal element of each row, for the classical
+  // version. If it cannot be allocated, the pivot is searched in the whole
+  // matrix instead
+  vec_size* rowMaxCols = NULL;
+  if (!cyclic && size > 1) {
+    rowMaxCols = malloc(size * sizeof(vec_size));
+  }
+  if (rowMaxCols != NULL) {
+    for (vec_size row = 0; row < size; ++row) {
+      jacobiScanRowMax(inputMatrix, size, row, rowMaxCols);
+    }
+  }
 
   jacobiCreateIdentityMatrix(size, outputMatrix);
   real_number currentOffDiagonalSum =
       jacobiComputeOffDiagonalSum(inputMatrix, size);
+  vec_size rotationsSinceSum = 0;
   vec_size allowInfiniteIterations = max_iterations == -1;
   for (vec_size i = 0; (allowInfiniteIterations || i < max_iterations) &&
                        currentOffDiagonalSum > EPSILON;
@@ -208,6 +452,8 @@ void jacobi(real_number* inputMatrix, vec_size size, real_number* outputMatrix,
       maxRow = indexToMinimize / size;
       maxCol = indexToMinimize % size;
 
+    } else if (rowMaxCols != NULL) {
+      jacobiCachedMaxIndex(inputMatrix, size, rowMaxCols, &maxRow, &maxCol);
     } else {
       jacobiMaxIndex(inputMatrix, size, &maxRow, &maxCol);
     }
@@ -219,11 +465,11 @@ void jacobi(real_number* inputMatrix, vec_size size, real_number* outputMatrix,
       real_number epsilon_sweep =
           0.20 * (currentOffDiagonalSum) / ((real_number)(sizeSquared));
 
-      if (fabs(inputMatrix[coordToIndex(maxRow, maxCol, size)]) >
+      if (fabs(inputMatrix[coordToIndex(maxRow, maxCol, size)]) <=
           epsilon_sweep) {
-        jacobiCreateRotationMatrix(inputMatrix, maxRow, maxCol, rotationMatrix,
-                                   size);
+        continue;
       }
+      rotationAngle(inputMatrix, maxRow, maxCol, size, &c, &s);
     } else {
 
       real_number apq = fabs(inputMatrix[coordToIndex(maxRow, maxCol, size)]);
@@ -232,21 +478,153 @@ void jacobi(real_number* inputMatrix, vec_size size, real_number* outputMatrix,
 
       // If |apq| << |app| and |apq << |aqq|, set the element to 0 and continue
       // with other element
-      real_number precision = pow(10, -(DIGITS_PRECISION + 2));
       if (apq < precision * app && apq < precision * aqq) {
         inputMatrix[coordToIndex(maxRow, maxCol, size)] = 0;
+        currentOffDiagonalSum -= apq;
+        if (rowMaxCols != NULL) {
+          jacobiScanRowMax(inputMatrix, size, maxRow, rowMaxCols);
+        }
         i--;
         continue;
       }
 
-      jacobiCreateRotationMatrix(inputMatrix, maxRow, maxCol, rotationMatrix,
-                                 size);
+      rotationAngle(inputMatrix, maxRow, maxCol, size, &c, &s);
+    }
+
+    real_number rotatedSum =
+        jacobiRotatedSum(inputMatrix, size, maxRow, maxCol);
+    jacobiRotate(inputMatrix, outputMatrix, size, maxRow, maxCol, c, s);
+    currentOffDiagonalSum +=
+        jacobiRotatedSum(inputMatrix, size, maxRow, maxCol) - rotatedSum;
+    if (rowMaxCols != NULL) {
+      jacobiUpdateRowMax(inputMatrix, size, maxRow, maxCol, rowMaxCols);
+    }
+
+    if (++rotationsSinceSum >= sweepSize || currentOffDiagonalSum <= EPSILON) {
+      currentOffDiagonalSum = jacobiComputeOffDiagonalSum(inputMatrix, size);
+      rotationsSinceSum = 0;
+    }
+  }
+
+  free(rowMaxCols);
+}
+
+/**
+ * Computes the jacobi method with the rotations of each sweep grouped in
+ * rounds of disjoint pairs, following a round-robin (chess tournament)
+ * ordering as in Brent and Luk. Each round applies up to size / 2 rotations
+ * that touch different rows and columns, so they are independent: their angles
+ * are computed from the same matrix and they are applied together, the rows
+ * and columns being shared between threads when compiled with OpenMP.
+ * Every pair of rows is visited once per sweep, and the iterations stop when
+ * the off diagonal sum is below EPSILON.
+ * The eigenpairs are the same as the ones of jacobi, within EPSILON, but they
+ * can be in another order on the diagonal and the eigenvectors can have the
+ * opposite sign.
+ * @param inputMatrix matrix whose eigenvalues and eigenvectors we are looking
+ * for (will contain the eigenvalues after this function has been called)
+ * @param size size of the matrix (matrix must be square)
+ * @param outputMatrix matrix containing every eigenvector of the input matrix
+ * (same size as the input matrix)
+ * @param max_sweeps max number of sweeps the algorithm can do (set to -1 to
+ * allow any amount of sweeps)
+ */
+void jacobiParallel(real_number* inputMatrix, vec_size size,
+                    real_number* outputMatrix, vec_size max_sweeps) {
+
+  // With an odd size, a dummy row is added and the rotations with it skipped
+  const vec_size nbPlayers = size + (size & 1);
+  const vec_size nbPairs = nbPlayers / 2;
+  vec_size rows[nbPairs + 1];
+  vec_size cols[nbPairs + 1];
+  real_number cosines[nbPairs + 1];
+  real_number sines[nbPairs + 1];
+  real_number precision = pow(10, -(DIGITS_PRECISION + 2));
+
+  jacobiCreateIdentityMatrix(size, outputMatrix);
+  real_number currentOffDiagonalSum =
+      jacobiComputeOffDiagonalSum(inputMatrix, size);
+  vec_size allowInfiniteSweeps = max_sweeps == (vec_size)-1;
+  for (vec_size sweep = 0; (allowInfiniteSweeps || sweep < max_sweeps) &&
+                           currentOffDiagonalSum > EPSILON;
+       ++sweep) {
+    for (vec_size round = 0; round + 1 < nbPlayers; ++round) {
+      // The last player stays in place and plays the player round, the
+      // others play the player at the same distance on the other side
+      rows[0] = round;
+      cols[0] = nbPlayers - 1;
+      for (vec_size k = 1; k < nbPairs; ++k) {
+        rows[k] = (round + k) % (nbPlayers - 1);
+        cols[k] = (round + nbPlayers - 1 - k) % (nbPlayers - 1);
+      }
+
+      // Each angle only depends on the elements at (p, p), (q, q) and (p, q),
+      // which no other rotation of the round changes
+      JACOBI_PARALLEL_FOR
+      for (vec_size k = 0; k < nbPairs; ++k) {
+        cosines[k] = 1.0;
+        sines[k] = 0.0;
+        vec_size row = rows[k];
+        vec_size col = cols[k];
+        if (row >= size || col >= size) {
+          continue;
+        }
+
+        real_number apq = fabs(inputMatrix[coordToIndex(row, col, size)]);
+        real_number app = fabs(inputMatrix[coordToIndex(row, row, size)]);
+        real_number aqq = fabs(inputMatrix[coordToIndex(col, col, size)]);
+        if (apq == 0.0 || (apq < precision * app && apq < precision * aqq)) {
+          inputMatrix[coordToIndex(row, col, size)] = 0;
+          inputMatrix[coordToIndex(col, row, size)] = 0;
+          continue;
+        }
+        jacobiSmallRotationAngle(inputMatrix, row, col, size, &cosines[k],
+                                 &sines[k]);
+      }
+
+      // Columns of matrix x R and of eigenVectors x R, one row per thread
+      JACOBI_PARALLEL_FOR
+      for (vec_size i = 0; i < size; ++i) {
+        real_number* matrixRow = inputMatrix + i * size;
+        real_number* vectorRow = outputMatrix + i * size;
+        for (vec_size k = 0; k < nbPairs; ++k) {
+          if (sines[k] == 0.0) {
+            continue;
+          }
+          vec_size row = rows[k];
+          vec_size col = cols[k];
+          real_number c = cosines[k];
+          real_number s = sines[k];
+          real_number aip = matrixRow[row];
+          real_number aiq = matrixRow[col];
+          matrixRow[row] = c * aip - s * aiq;
+          matrixRow[col] = s * aip + c * aiq;
+          real_number vip = vectorRow[row];
+          real_number viq = vectorRow[col];
+          vectorRow[row] = c * vip - s * viq;
+          vectorRow[col] = s * vip + c * viq;
+        }
+      }
+
+      // Rows of transpose(R) x matrix, one pair of rows per thread
+      JACOBI_PARALLEL_FOR
+      for (vec_size k = 0; k < nbPairs; ++k) {
+        if (sines[k] == 0.0) {
+          continue;
+        }
+        real_number* rowP = inputMatrix + rows[k] * size;
+        real_number* rowQ = inputMatrix + cols[k] * size;
+        real_number c = cosines[k];
+        real_number s = sines[k];
+        for (vec_size j = 0; j < size; ++j) {
+          real_number apj = rowP[j];
+          real_number aqj = rowQ[j];
+          rowP[j] = c * apj - s * aqj;
+          rowQ[j] = s * apj + c * aqj;
+        }
+      }
     }
 
-    jacobiMatrixMultiply(rotationMatrix, inputMatrix, sizes3d, aBuffer, 1);
-    jacobiMatrixMultiply(aBuffer, rotationMatrix, sizes3d, inputMatrix, 0);
-    jacobiMatrixMultiply(outputMatrix, rotationMatrix, sizes3d, vBuffer, 0);
-    memcpy(outputMatrix, vBuffer, sizeof(real_number) * sizeSquared);
     currentOffDiagonalSum = jacobiComputeOffDiagonalSum(inputMatrix, size);
   }
 }
@@ -37,6 +37,8 @@ void jacobiCreateRotationMatrix(real_number* input, vec_size row, vec_size col,
                                 real_number* output, vec_size size);
 void jacobi(real_number* inputMatrix, vec_size size, real_number* outputMatrix,
             vec_size iterations, vec_size cyclic);
+void jacobiParallel(real_number* inputMatrix, vec_size size,
+                    real_number* outputMatrix, vec_size max_sweeps);
 
 #ifdef __cplusplus
 }
@@ -17,41 +17,56 @@
  * so vectors won't be linearly dependant. Instead they should already be
  * almost orthogonal.
  */
-static void gramSchmidt(lanczos_real* vectorList, uint_least8_t nbVectors,
-                        uint_least8_t vectorLength,
-                        lanczos_real* vectorToChange) {
-  for (uint_least8_t i = 0; i < nbVectors; ++i) {
-    lanczos_real dotProduct;
-    unsigned int dims[] = {1, vectorLength, 1};
-    lanczos_real tmpVector[vectorLength];
-
-    memcpy(tmpVector, &vectorList[i * vectorLength],
-           vectorLength * sizeof(lanczos_real));
-    matrixMultiply(tmpVector, vectorToChange, dims, &dotProduct, 0);
-    vectorScale(tmpVector, vectorLength, dotProduct);
-    vectorSubstract(vectorToChange, tmpVector, vectorLength);
-  }
+static void gramSchmidt(lanczos_real* vectorList, size_t nbVectors,
+                        size_t vectorLength, lanczos_real* vectorToChange) {
+  vectorOrthogonalize(vectorToChange, vectorList, nbVectors, vectorLength);
   lanczos_real norm = computeNorm(vectorToChange, vectorLength);
   vectorScale(vectorToChange, vectorLength, 1.0 / norm);
 }
 
-static void getRandomUnitVector(lanczos_real* vector, uint_least8_t dim) {
-  for (uint_least8_t i = 0; i < dim; ++i) {
+static void getRandomUnitVector(lanczos_real* vector, size_t dim) {
+  for (size_t i = 0; i < dim; ++i) {
     vector[i] = linear_congruential_random_generator();
   }
 
   makeUnitVector(vector, dim);
 }
 
-void lanczos(lanczos_real* matrix, uint_least8_t dim, uint_least8_t nbIter,
-             lanczos_real* initialVector, lanczos_real* tMatrix,
-             lanczos_real* vMatrix) {
-  lanczos_real q0[dim];
-  lanczos_real q1[dim];
+/**
+ * Product of the matrix given to lanczos by a vector
+ */
+static void denseMultiply(void* matrix, const lanczos_real* vector,
+                          size_t dim, lanczos_real* output) {
+  matrixVectorMultiply(matrix, vector, dim, dim, output, 0);
+}
+
+/**
+ * Product of the packed matrix given to lanczosPacked by a vector
+ */
+static void packedMultiply(void* matrix, const lanczos_real* vector,
+                           size_t dim, lanczos_real* output) {
+  symmetricMatrixVectorMultiply(matrix, vector, dim, output);
+}
+
+int lanczosOperator(lanczos_operator multiply, void* context, size_t dim,
+                    size_t nbIter, lanczos_real* initialVector,
+                    lanczos_real* tMatrix, lanczos_real* vMatrix) {
+  // The vector routines of matrix.c index with matrix_size
+  if ((matrix_size)dim != dim || (matrix_size)(nbIter * dim) != nbIter * dim) {
+    return 1;
+  }
+
+  // q0, q1 and v, followed by the transpose of the V matrix, with one
+  // vector per row
+  lanczos_real* q0 = malloc((3 + nbIter) * dim * sizeof(lanczos_real));
+  if (q0 == NULL) {
+    return 1;
+  }
+  lanczos_real* q1 = q0 + dim;
+  lanczos_real* v = q1 + dim;
+  lanczos_real* vTranspose = v + dim;
 
   lanczos_real beta = 0;
-  // Temporary vector to store the transpose of the V matrix.
-  lanczos_real vTranspose[nbIter][dim];
 
   if (initialVector == NULL) {
     // q1 is a random unit vector and q0 is a vector filled with 0
@@ -62,35 +77,23 @@ void lanczos(lanczos_real* matrix, uint_least8_t dim, uint_least8_t nbIter,
   }
   memset(q0, 0, dim * sizeof(lanczos_real));
 
-  for (uint_least8_t i = 0; i < nbIter; ++i) {
+  for (size_t i = 0; i < nbIter; ++i) {
     // Store the current vector v as the ith row of the vTranspose matrix
-    memcpy(vTranspose[i], q1, dim * sizeof(lanczos_real));
+    memcpy(&vTranspose[i * dim], q1, dim * sizeof(lanczos_real));
 
     // Compute the value of v from the equation
     // v = A*qn
-    lanczos_real v[dim];
-    unsigned int dims[3] = {dim, dim, 1};
-    matrixMultiply(matrix, q1, dims, v, 0);
+    multiply(context, q1, dim, v);
 
     // Compute the value of alpha using the equation
     // alpha = transpose(q) * v
     // also, since q is a vector we do not really need to transpose it
-    lanczos_real alpha;
-    unsigned int dims2[3] = {1, dim, 1};
-    matrixMultiply(q1, v, dims2, &alpha, 0);
+    lanczos_real alpha = vectorDot(q1, v, dim);
 
     // Recompute a new v using the equation
     // v = v - beta(n-1) * q(n-1) - alpha * q(n)
-    lanczos_real alphaDotQ[dim];
-    memcpy(alphaDotQ, q1, dim * sizeof(lanczos_real));
-    vectorScale(alphaDotQ, dim, alpha);
-
-    lanczos_real betaDotQ0[dim];
-    memcpy(betaDotQ0, q0, dim * sizeof(lanczos_real));
-    vectorScale(betaDotQ0, dim, beta);
-
-    vectorSubstract(v, betaDotQ0, dim);
-    vectorSubstract(v, alphaDotQ, dim);
+    vectorAxpy(v, q0, dim, -beta);
+    vectorAxpy(v, q1, dim, -alpha);
 
     // Compute the value of beta
     // Where beta is the norm of v
@@ -111,7 +114,7 @@ void lanczos(lanczos_real* matrix, uint_least8_t dim, uint_least8_t nbIter,
     }
 
     // Reorthogonalize the vector q1 using the modified Gram-Schmidth algorithm
-    gramSchmidt(vTranspose[0], i + 1, dim, q1);
+    gramSchmidt(vTranspose, i + 1, dim, q1);
 
     // Fill the matrix T with the current alpha and beta values
     tMatrix[i * nbIter + i] = alpha;
@@ -122,5 +125,22 @@ void lanczos(lanczos_real* matrix, uint_least8_t dim, uint_least8_t nbIter,
   }
 
   matrix_size vMatrixSize[] = {nbIter, dim};
-  matrixTranspose(vTranspose[0], vMatrix, vMatrixSize);
+  matrixTranspose(vTranspose, vMatrix, vMatrixSize);
+  free(q0);
+  return 0;
+}
+
+int lanczos(lanczos_real* matrix, uint_least8_t dim, uint_least8_t nbIter,
+            lanczos_real* initialVector, lanczos_real* tMatrix,
+            lanczos_real* vMatrix) {
+  return lanczosOperator(denseMultiply, matrix, dim, nbIter, initialVector,
+                         tMatrix, vMatrix);
+}
+
+int lanczosPacked(const lanczos_real* packedMatrix, uint_least8_t dim,
+                  uint_least8_t nbIter, lanczos_real* initialVector,
+                  lanczos_real* tMatrix, lanczos_real* vMatrix) {
+  // The context is only read by packedMultiply
+  return lanczosOperator(packedMultiply, (void*)packedMatrix, dim, nbIter,
+                         initialVector, tMatrix, vMatrix);
 }
@@ -1,7 +1,24 @@
+#ifndef LANCZOS_H
+#define LANCZOS_H
+
+#include <stddef.h>
 #include <stdint.h>
 
 typedef double lanczos_real;
 
+/**
+ * Product of an operator by a vector, output = A * vector, as used by
+ * lanczosOperator. The operator must be symmetric.
+ * @input context is the pointer given to lanczosOperator, for example the
+ * data defining the operator
+ * @input vector is the vector of dim elements to multiply
+ * @input dim is the size of the operator
+ * @output output is the vector of dim elements receiving the product. It never
+ * overlaps vector
+ */
+typedef void (*lanczos_operator)(void* context, const lanczos_real* vector,
+                                 size_t dim, lanczos_real* output);
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -17,11 +34,44 @@ extern "C" {
  * eigen vectors
  * @output vMatrix is the matrix V which can be used to transforme eigen vectors
  * from space of T to space or matrix
+ * @return 1 if the work buffers could not be allocated, 0 otherwise
  *
  */
-void lanczos(lanczos_real* matrix, uint_least8_t dim, uint_least8_t nbIter,
-             lanczos_real* initialVector, lanczos_real* tMatrix,
-             lanczos_real* vMatrix);
+int lanczos(lanczos_real* matrix, uint_least8_t dim, uint_least8_t nbIter,
+            lanczos_real* initialVector, lanczos_real* tMatrix,
+            lanczos_real* vMatrix);
+
+/**
+ * Same as lanczos, for a matrix in packed storage: the upper triangle of the
+ * symmetric matrix, row after row, in dim * (dim + 1) / 2 elements. See
+ * symmetricPackedSize in matrix.h.
+ */
+int lanczosPacked(const lanczos_real* packedMatrix, uint_least8_t dim,
+                  uint_least8_t nbIter, lanczos_real* initialVector,
+                  lanczos_real* tMatrix, lanczos_real* vMatrix);
+
+/**
+ * Same as lanczos, for an operator only known through its product with a
+ * vector. The operator is never stored, so it can be defined implicitly, or
+ * be distributed, and have any size.
+ * The work buffers, of (nbIter + 3) * dim elements, are allocated on the heap.
+ * @input multiply computes the product of the operator by a vector
+ * @input context is given to each call of multiply. This parameter can be NULL
+ * @input dim is the size of the operator
+ * @input nbIter is the number of iteration of the algorithm
+ * @input initialVector is a vector used for the first iteration of the
+ * algorithm. This parameter can be NULL
+ * @output tMatrix is the matrix T of nbIter * nbIter elements
+ * @output vMatrix is the matrix V of dim * nbIter elements
+ * @return 1 if the work buffers could not be allocated, or if dim * nbIter
+ * does not fit in a matrix_size, 0 otherwise
+ */
+int lanczosOperator(lanczos_operator multiply, void* context, size_t dim,
+                    size_t nbIter, lanczos_real* initialVector,
+                    lanczos_real* tMatrix, lanczos_real* vMatrix);
+
 #ifdef __cplusplus
 }
 #endif
+
+#endif // LANCZOS_H
@@ -0,0 +1,165 @@
+#include "lanczos_top_eigen.h"
+#include "linear_congruential_random_generator.h"
+#include "matrix.h"
+#include "symmetric_eigen.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void getRandomUnitVector(lanczos_real* vector, size_t dim) {
+  for (size_t i = 0; i < dim; ++i) {
+    vector[i] = linear_congruential_random_generator();
+  }
+
+  makeUnitVector(vector, dim);
+}
+
+int lanczosTopEigen(lanczos_operator multiply, void* context, size_t dim,
+                    size_t nbWanted, size_t basisSize, size_t maxRestarts,
+                    lanczos_real tolerance, lanczos_real* initialVector,
+                    lanczos_real* eigenValues, lanczos_real* eigenVectors) {
+  const size_t m = basisSize < dim ? basisSize : dim;
+  if (nbWanted == 0 || nbWanted > m || (nbWanted == m && m < dim) ||
+      (matrix_size)dim != dim) {
+    return 1;
+  }
+  // Ritz vectors kept at each restart: the wanted ones, and half of the
+  // others, which speeds up the convergence of the last wanted ones
+  size_t keep = nbWanted + (m - nbWanted) / 2;
+  if (keep >= m) {
+    keep = m - 1;
+  }
+
+  // The m + 1 vectors of the basis, one per row, the work vector w, the
+  // kept Ritz vectors, then the projected matrix T, its eigenvectors and its
+  // eigenvalues
+  lanczos_real* basis =
+      malloc(((m + 2 + keep) * dim + 2 * m * m + m) * sizeof(lanczos_real));
+  if (basis == NULL) {
+    return 1;
+  }
+  lanczos_real* w = basis + (m + 1) * dim;
+  lanczos_real* kept = w + dim;
+  lanczos_real* tMatrix = kept + keep * dim;
+  lanczos_real* ritzVectors = tMatrix + m * m;
+  lanczos_real* ritzValues = ritzVectors + m * m;
+
+  if (initialVector == NULL) {
+    getRandomUnitVector(basis, dim);
+  } else {
+    makeUnitVector(initialVector, dim);
+    memcpy(basis, initialVector, dim * sizeof(lanczos_real));
+  }
+  memset(tMatrix, 0, m * m * sizeof(lanczos_real));
+
+  size_t start = 0;
+  lanczos_real residualBeta = 0.0;
+  lanczos_real normEstimate = 0.0;
+  int returnCode = 1;
+  for (size_t restart = 0;; ++restart) {
+    // Extends the basis from start to m vectors. After a restart, T is the
+    // diagonal of the kept Ritz values, bordered by their coupling with the
+    // vector start
+    for (size_t j = start; j < m; ++j) {
+      const lanczos_real* vj = basis + j * dim;
+      multiply(context, vj, dim, w);
+      const lanczos_real alpha = vectorDot(vj, w, dim);
+      tMatrix[j * m + j] = alpha;
+      vectorAxpy(w, vj, dim, -alpha);
+      for (size_t i = 0; i < j; ++i) {
+        if (tMatrix[i * m + j] != 0.0) {
+          vectorAxpy(w, basis + i * dim, dim, -tMatrix[i * m + j]);
+        }
+      }
+
+      // Full reorthogonalization, done twice to stay orthogonal to working
+      // precision
+      vectorOrthogonalize(w, basis, j + 1, dim);
+      vectorOrthogonalize(w, basis, j + 1, dim);
+      lanczos_real beta = computeNorm(w, dim);
+      normEstimate = fmax(normEstimate, fabs(alpha) + beta);
+
+      lanczos_real* next = basis + (j + 1) * dim;
+      if (beta <= 1e-12 * normEstimate) {
+        // Invariant subspace: continues with a random orthogonal vector,
+        // which is not coupled with the previous ones
+        beta = 0.0;
+        if (j + 1 < m) {
+          getRandomUnitVector(next, dim);
+          vectorOrthogonalize(next, basis, j + 1, dim);
+          vectorOrthogonalize(next, basis, j + 1, dim);
+          makeUnitVector(next, dim);
+        }
+      } else {
+        memcpy(next, w, dim * sizeof(lanczos_real));
+        vectorScale(next, dim, 1.0 / beta);
+      }
+
+      if (j + 1 < m) {
+        tMatrix[j * m + j + 1] = beta;
+        tMatrix[(j + 1) * m + j] = beta;
+      } else {
+        residualBeta = beta;
+      }
+    }
+
+    // Ritz pairs, in increasing order. The residual norm of the Ritz pair i
+    // is |residualBeta * y(m - 1, i)|
+    memcpy(ritzVectors, tMatrix, m * m * sizeof(lanczos_real));
+    if (symmetricEigen(ritzVectors, m, ritzValues) != 0) {
+      // No Ritz pairs to return: the outputs are left unchanged
+      free(basis);
+      return 1;
+    }
+    normEstimate = fmax(fabs(ritzValues[0]), fabs(ritzValues[m - 1]));
+    size_t nbConverged = 0;
+    for (size_t c = 0; c < nbWanted; ++c) {
+      const lanczos_real residual =
+          fabs(residualBeta * ritzVectors[(m - 1) * m + m - 1 - c]);
+      nbConverged += residual <= tolerance * normEstimate;
+    }
+    if (nbConverged == nbWanted || restart == maxRestarts) {
+      returnCode = nbConverged != nbWanted;
+      break;
+    }
+
+    // Thick restart: the largest Ritz vectors, followed by the residual
+    // vector, become the first vectors of the basis
+    for (size_t c = 0; c < keep; ++c) {
+      lanczos_real* ritzVector = kept + c * dim;
+      memset(ritzVector, 0, dim * sizeof(lanczos_real));
+      for (size_t i = 0; i < m; ++i) {
+        vectorAxpy(ritzVector, basis + i * dim, dim,
+                   ritzVectors[i * m + m - 1 - c]);
+      }
+    }
+    memcpy(basis, kept, keep * dim * sizeof(lanczos_real));
+    memmove(basis + keep * dim, basis + m * dim, dim * sizeof(lanczos_real));
+
+    memset(tMatrix, 0, m * m * sizeof(lanczos_real));
+    for (size_t c = 0; c < keep; ++c) {
+      tMatrix[c * m + c] = ritzValues[m - 1 - c];
+      tMatrix[c * m + keep] =
+          residualBeta * ritzVectors[(m - 1) * m + m - 1 - c];
+      tMatrix[keep * m + c] = tMatrix[c * m + keep];
+    }
+    start = keep;
+  }
+
+  // The wanted Ritz pairs, in decreasing order, are V * y
+  for (size_t c = 0; c < nbWanted; ++c) {
+    eigenValues[c] = ritzValues[m - 1 - c];
+  }
+  for (size_t r = 0; r < dim; ++r) {
+    for (size_t c = 0; c < nbWanted; ++c) {
+      lanczos_real element = 0.0;
+      for (size_t i = 0; i < m; ++i) {
+        element += basis[i * dim + r] * ritzVectors[i * m + m - 1 - c];
+      }
+      eigenVectors[r * nbWanted + c] = element;
+    }
+  }
+
+  free(basis);
+  return returnCode;
+}
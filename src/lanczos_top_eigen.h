@@ -0,0 +1,48 @@
+#ifndef LANCZOS_TOP_EIGEN_H
+#define LANCZOS_TOP_EIGEN_H
+
+#include "lanczos.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Computes the nbWanted largest eigenvalues of a symmetric operator, and
+ * their eigenvectors, with the thick restart Lanczos algorithm. The Krylov
+ * basis is bounded to basisSize vectors: when it is full, the Ritz pairs of
+ * the projected matrix are computed with symmetricEigen, and the algorithm
+ * stops if the wanted ones have converged. Otherwise it restarts from the
+ * largest Ritz vectors. The memory is O(basisSize * dim), and the number of
+ * products depends on the number of wanted eigenpairs and on their gaps, not
+ * on dim. A basisSize of 2 to 3 times nbWanted is a good choice.
+ * @input multiply computes the product of the operator by a vector
+ * @input context is given to each call of multiply. This parameter can be NULL
+ * @input dim is the size of the operator
+ * @input nbWanted is the number of wanted eigenpairs
+ * @input basisSize is the maximum number of vectors of the basis, at least
+ * nbWanted + 1, and reduced to dim if it is larger
+ * @input maxRestarts is the maximum number of restarts
+ * @input tolerance is the accepted residual norm |A * x - lambda * x|,
+ * relative to the largest Ritz value in absolute value
+ * @input initialVector is a vector used for the first iteration of the
+ * algorithm. This parameter can be NULL
+ * @output eigenValues receives the nbWanted eigenvalues, in decreasing order
+ * @output eigenVectors is the matrix of dim * nbWanted elements receiving the
+ * unit eigenvectors, in columns
+ * @return 1 if the arguments are invalid, if the work buffers could not be
+ * allocated, or if the eigenvalues of the projected matrix could not be
+ * computed, in which cases the outputs are left unchanged. 1 as well if the
+ * eigenpairs did not converge in maxRestarts restarts, in which case the
+ * outputs hold the last approximations. 0 otherwise
+ */
+int lanczosTopEigen(lanczos_operator multiply, void* context, size_t dim,
+                    size_t nbWanted, size_t basisSize, size_t maxRestarts,
+                    lanczos_real tolerance, lanczos_real* initialVector,
+                    lanczos_real* eigenValues, lanczos_real* eigenVectors);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LANCZOS_TOP_EIGEN_H
@@ -1,34 +1,59 @@
 #include "matrix.h"
 #include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
 
-/**
- * @brief Converts a 2d coordinate in a matrix to an index in a 2d array
- * @param row the row number
- * @param col the column number
- * @param size the number of columns in the matrix
- */
-inline matrix_size coordToIndex(const matrix_size row, const matrix_size col,
-                                const matrix_size size) {
-  return row * size + col;
-}
+// Size of the micro-kernel, the block of the output kept in registers
+#define MICRO_ROWS 4
+#define MICRO_COLS 8
 
-/**
- * @brief Check if the given index is part of the diagonal
- * @param index the index to check
- * @param size the number of columns in the matrix
- */
-inline matrix_size isDiagonal(const matrix_size index, const matrix_size size) {
-  return ((index / size) == (index % size));
-}
+static void multiplyDirect(const matrix_real_number* firstMatrix,
+                           const matrix_real_number* secondMatrix,
+                           const matrix_size m, const matrix_size n,
+                           const matrix_size p, matrix_real_number* output,
+                           const matrix_size transposeFirstMatrix);
+static void multiplyBlocked(const matrix_real_number* firstMatrix,
+                            const matrix_real_number* secondMatrix,
+                            const matrix_size m, const matrix_size n,
+                            const matrix_size p, matrix_real_number* output,
+                            const matrix_size transposeFirstMatrix,
+                            matrix_real_number* packedFirst,
+                            matrix_real_number* packedSecond);
+static void packFirstMatrix(const matrix_real_number* firstMatrix,
+                            const matrix_size m, const matrix_size n,
+                            const matrix_size rowStart,
+                            const matrix_size rowCount,
+                            const matrix_size depthStart,
+                            const matrix_size depth,
+                            const matrix_size transposeFirstMatrix,
+                            matrix_real_number* packed);
+static void packSecondMatrix(const matrix_real_number* secondMatrix,
+                             const matrix_size p, const matrix_size depthStart,
+                             const matrix_size depth,
+                             const matrix_size colStart,
+                             const matrix_size colCount,
+                             matrix_real_number* packed);
+static void microKernel(const matrix_size depth,
+                        const matrix_real_number* packedFirst,
+                        const matrix_real_number* packedSecond,
+                        matrix_real_number* output, const matrix_size p,
+                        const matrix_size rows, const matrix_size cols,
+                        const int accumulate);
 
 /**
  * @brief Multiplies 2 matrices together using this equation : output =
  * firstMatrix x secondMatrix
- * @param firstMatrix first matrix to multiply of size m * n
+ * Large products are computed by blocks which fit in the cache. The blocks
+ * are copied to contiguous buffers, the first matrix being transposed or not
+ * during the copy, and a micro-kernel accumulates 4 x 8 blocks of the output
+ * in registers. If the buffers cannot be allocated, or the product is small,
+ * direct loops are used instead.
+ * @param firstMatrix first matrix to multiply of size m * n, or n * m when it
+ * is transposed
  * @param secondMatrix second matrix to multiply of size n * p
  * @param size array of size 3 containing m, n and p
  * @param output matrix resulting of the matrix multiplication of the given
- * matrices
+ * matrices, of size m * p. Must not overlap the input matrices
  * @param transposeFirstMatrix whether to transpose the first matrix when
  * multiplying the matrices
  */
@@ -39,16 +64,343 @@ void matrixMultiply(const matrix_real_number* firstMatrix,
   const matrix_size m = size[0];
   const matrix_size n = size[1];
   const matrix_size p = size[2];
+
+  // Matrix-vector products have no reuse for the blocks to exploit, and the
+  // pack buffers may not fit the address space of small targets
+  const double largestPanel =
+      MATRIX_BLOCK_M > MATRIX_BLOCK_N
+          ? (double)MATRIX_BLOCK_M * MATRIX_BLOCK_K
+          : (double)MATRIX_BLOCK_K * MATRIX_BLOCK_N;
+  if (p == 1 || (double)m * n * p < MATRIX_BLOCKING_THRESHOLD ||
+      largestPanel * sizeof(matrix_real_number) > SIZE_MAX) {
+    multiplyDirect(firstMatrix, secondMatrix, m, n, p, output,
+                   transposeFirstMatrix);
+    return;
+  }
+
+  matrix_real_number* packedFirst = malloc(
+      (size_t)MATRIX_BLOCK_M * MATRIX_BLOCK_K * sizeof(matrix_real_number));
+  matrix_real_number* packedSecond = malloc(
+      (size_t)MATRIX_BLOCK_K * MATRIX_BLOCK_N * sizeof(matrix_real_number));
+  if (packedFirst == NULL || packedSecond == NULL) {
+    multiplyDirect(firstMatrix, secondMatrix, m, n, p, output,
+                   transposeFirstMatrix);
+  } else {
+    multiplyBlocked(firstMatrix, secondMatrix, m, n, p, output,
+                    transposeFirstMatrix, packedFirst, packedSecond);
+  }
+  free(packedFirst);
+  free(packedSecond);
+}
+
+/**
+ * @brief Multiplies 2 matrices with direct loops, for small products.
+ * The rows of the output are accumulated from the rows of the second matrix,
+ * so that the inner loop is contiguous in both cases of transposition. A
+ * single column is computed with matrixVectorMultiply instead.
+ * @param firstMatrix first matrix of size m * n, or n * m when transposed
+ * @param secondMatrix second matrix of size n * p
+ * @param m number of rows of the output
+ * @param n shared dimension
+ * @param p number of columns of the output
+ * @param output output matrix of size m * p
+ * @param transposeFirstMatrix whether to transpose the first matrix
+ */
+static void multiplyDirect(const matrix_real_number* firstMatrix,
+                           const matrix_real_number* secondMatrix,
+                           const matrix_size m, const matrix_size n,
+                           const matrix_size p, matrix_real_number* output,
+                           const matrix_size transposeFirstMatrix) {
+  // Distance between the elements k and k + 1 of a row of op(firstMatrix),
+  // and between two rows
+  const matrix_size depthStride = transposeFirstMatrix ? m : 1;
+  const matrix_size rowStride = transposeFirstMatrix ? 1 : n;
+
+  if (p == 1) {
+    matrixVectorMultiply(firstMatrix, secondMatrix,
+                         transposeFirstMatrix ? n : m,
+                         transposeFirstMatrix ? m : n, output,
+                         transposeFirstMatrix);
+    return;
+  }
+
   for (matrix_size i = 0; i < m; ++i) {
+    const matrix_real_number* row = firstMatrix + i * rowStride;
+    matrix_real_number* outputRow = output + i * p;
     for (matrix_size j = 0; j < p; ++j) {
-      matrix_real_number sum = 0.0;
-      for (matrix_size k = 0; k < n; ++k) {
-        sum += (transposeFirstMatrix ? firstMatrix[coordToIndex(k, i, n)]
-                                     : firstMatrix[coordToIndex(i, k, n)]) *
-               secondMatrix[coordToIndex(k, j, p)];
+      outputRow[j] = 0.0;
+    }
+    for (matrix_size k = 0; k < n; ++k) {
+      const matrix_real_number element = row[k * depthStride];
+      const matrix_real_number* secondRow = secondMatrix + k * p;
+      for (matrix_size j = 0; j < p; ++j) {
+        outputRow[j] += element * secondRow[j];
+      }
+    }
+  }
+}
+
+/**
+ * @brief Multiplies 2 matrices by blocks.
+ * The columns of the output are split in blocks of MATRIX_BLOCK_N, the shared
+ * dimension in blocks of MATRIX_BLOCK_K, and the rows in blocks of
+ * MATRIX_BLOCK_M. Each block of the second matrix is packed once and reused
+ * for all the rows, each block of the first matrix is packed once and reused
+ * for all the columns of the block.
+ * @param firstMatrix first matrix of size m * n, or n * m when transposed
+ * @param secondMatrix second matrix of size n * p
+ * @param m number of rows of the output
+ * @param n shared dimension
+ * @param p number of columns of the output
+ * @param output output matrix of size m * p
+ * @param transposeFirstMatrix whether to transpose the first matrix
+ * @param packedFirst buffer of MATRIX_BLOCK_M * MATRIX_BLOCK_K elements
+ * @param packedSecond buffer of MATRIX_BLOCK_K * MATRIX_BLOCK_N elements
+ */
+static void multiplyBlocked(const matrix_real_number* firstMatrix,
+                            const matrix_real_number* secondMatrix,
+                            const matrix_size m, const matrix_size n,
+                            const matrix_size p, matrix_real_number* output,
+                            const matrix_size transposeFirstMatrix,
+                            matrix_real_number* packedFirst,
+                            matrix_real_number* packedSecond) {
+  for (matrix_size colStart = 0; colStart < p; colStart += MATRIX_BLOCK_N) {
+    const matrix_size colCount =
+        p - colStart < MATRIX_BLOCK_N ? p - colStart : MATRIX_BLOCK_N;
+
+    for (matrix_size depthStart = 0; depthStart < n;
+         depthStart += MATRIX_BLOCK_K) {
+      const matrix_size depth =
+          n - depthStart < MATRIX_BLOCK_K ? n - depthStart : MATRIX_BLOCK_K;
+      // The first block of the shared dimension initializes the output
+      const int accumulate = depthStart > 0;
+      packSecondMatrix(secondMatrix, p, depthStart, depth, colStart, colCount,
+                       packedSecond);
+
+      for (matrix_size rowStart = 0; rowStart < m;
+           rowStart += MATRIX_BLOCK_M) {
+        const matrix_size rowCount =
+            m - rowStart < MATRIX_BLOCK_M ? m - rowStart : MATRIX_BLOCK_M;
+        packFirstMatrix(firstMatrix, m, n, rowStart, rowCount, depthStart,
+                        depth, transposeFirstMatrix, packedFirst);
+
+        for (matrix_size j = 0; j < colCount; j += MICRO_COLS) {
+          const matrix_size cols =
+              colCount - j < MICRO_COLS ? colCount - j : MICRO_COLS;
+          for (matrix_size i = 0; i < rowCount; i += MICRO_ROWS) {
+            const matrix_size rows =
+                rowCount - i < MICRO_ROWS ? rowCount - i : MICRO_ROWS;
+            microKernel(depth, packedFirst + i * depth,
+                        packedSecond + j * depth,
+                        output + (rowStart + i) * p + colStart + j, p, rows,
+                        cols, accumulate);
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Copies a block of op(firstMatrix) to panels of MICRO_ROWS rows.
+ * In each panel, the MICRO_ROWS elements of a column are contiguous, in the
+ * order used by the micro-kernel. Rows past the end of the matrix are filled
+ * with zeros.
+ * @param firstMatrix first matrix of size m * n, or n * m when transposed
+ * @param m number of rows of op(firstMatrix)
+ * @param n number of columns of op(firstMatrix)
+ * @param rowStart first row of the block
+ * @param rowCount number of rows of the block
+ * @param depthStart first column of the block
+ * @param depth number of columns of the block
+ * @param transposeFirstMatrix whether to transpose the first matrix
+ * @param packed buffer receiving the panels
+ */
+static void packFirstMatrix(const matrix_real_number* firstMatrix,
+                            const matrix_size m, const matrix_size n,
+                            const matrix_size rowStart,
+                            const matrix_size rowCount,
+                            const matrix_size depthStart,
+                            const matrix_size depth,
+                            const matrix_size transposeFirstMatrix,
+                            matrix_real_number* packed) {
+  for (matrix_size panel = 0; panel < rowCount; panel += MICRO_ROWS) {
+    const matrix_size rows =
+        rowCount - panel < MICRO_ROWS ? rowCount - panel : MICRO_ROWS;
+    const matrix_size firstRow = rowStart + panel;
+
+    if (transposeFirstMatrix) {
+      // The rows of op(firstMatrix) are the columns of firstMatrix
+      for (matrix_size k = 0; k < depth; ++k) {
+        const matrix_real_number* source =
+            firstMatrix + (depthStart + k) * m + firstRow;
+        for (matrix_size i = 0; i < MICRO_ROWS; ++i) {
+          packed[i] = i < rows ? source[i] : 0.0;
+        }
+        packed += MICRO_ROWS;
+      }
+    } else {
+      for (matrix_size k = 0; k < depth; ++k) {
+        const matrix_real_number* source =
+            firstMatrix + firstRow * n + depthStart + k;
+        for (matrix_size i = 0; i < MICRO_ROWS; ++i) {
+          packed[i] = i < rows ? source[i * n] : 0.0;
+        }
+        packed += MICRO_ROWS;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Copies a block of secondMatrix to panels of MICRO_COLS columns.
+ * In each panel, the MICRO_COLS elements of a row are contiguous. Columns
+ * past the end of the matrix are filled with zeros.
+ * @param secondMatrix second matrix of size n * p
+ * @param p number of columns of secondMatrix
+ * @param depthStart first row of the block
+ * @param depth number of rows of the block
+ * @param colStart first column of the block
+ * @param colCount number of columns of the block
+ * @param packed buffer receiving the panels
+ */
+static void packSecondMatrix(const matrix_real_number* secondMatrix,
+                             const matrix_size p, const matrix_size depthStart,
+                             const matrix_size depth,
+                             const matrix_size colStart,
+                             const matrix_size colCount,
+                             matrix_real_number* packed) {
+  for (matrix_size panel = 0; panel < colCount; panel += MICRO_COLS) {
+    const matrix_size cols =
+        colCount - panel < MICRO_COLS ? colCount - panel : MICRO_COLS;
+    for (matrix_size k = 0; k < depth; ++k) {
+      const matrix_real_number* source =
+          secondMatrix + (depthStart + k) * p + colStart + panel;
+      if (cols == MICRO_COLS) {
+        for (matrix_size j = 0; j < MICRO_COLS; ++j) {
+          packed[j] = source[j];
+        }
+      } else {
+        for (matrix_size j = 0; j < MICRO_COLS; ++j) {
+          packed[j] = j < cols ? source[j] : 0.0;
+        }
       }
-      output[coordToIndex(i, j, p)] = sum;
+      packed += MICRO_COLS;
+    }
+  }
+}
+
+/**
+ * @brief Computes a MICRO_ROWS x MICRO_COLS block of the output from a panel
+ * of each matrix.
+ * The accumulators stay in registers, and the loop over the columns is
+ * vectorized by the compiler. The rows are unrolled, MICRO_ROWS being 4.
+ * @param depth number of columns of the first panel and rows of the second
+ * @param packedFirst panel of the first matrix, see packFirstMatrix
+ * @param packedSecond panel of the second matrix, see packSecondMatrix
+ * @param output first element of the block in the output
+ * @param p number of columns of the output
+ * @param rows number of valid rows of the block
+ * @param cols number of valid columns of the block
+ * @param accumulate whether to add the block to the output instead of
+ * overwriting it
+ */
+static void microKernel(const matrix_size depth,
+                        const matrix_real_number* packedFirst,
+                        const matrix_real_number* packedSecond,
+                        matrix_real_number* output, const matrix_size p,
+                        const matrix_size rows, const matrix_size cols,
+                        const int accumulate) {
+  // One accumulator per row, which the compiler keeps in vector registers
+  matrix_real_number sums0[MICRO_COLS] = {0.0};
+  matrix_real_number sums1[MICRO_COLS] = {0.0};
+  matrix_real_number sums2[MICRO_COLS] = {0.0};
+  matrix_real_number sums3[MICRO_COLS] = {0.0};
+  for (matrix_size k = 0; k < depth; ++k) {
+    const matrix_real_number element0 = packedFirst[0];
+    const matrix_real_number element1 = packedFirst[1];
+    const matrix_real_number element2 = packedFirst[2];
+    const matrix_real_number element3 = packedFirst[3];
+    for (matrix_size j = 0; j < MICRO_COLS; ++j) {
+      const matrix_real_number secondElement = packedSecond[j];
+      sums0[j] += element0 * secondElement;
+      sums1[j] += element1 * secondElement;
+      sums2[j] += element2 * secondElement;
+      sums3[j] += element3 * secondElement;
+    }
+    packedFirst += MICRO_ROWS;
+    packedSecond += MICRO_COLS;
+  }
+
+  const matrix_real_number* sums[MICRO_ROWS] = {sums0, sums1, sums2, sums3};
+  for (matrix_size i = 0; i < rows; ++i) {
+    matrix_real_number* outputRow = output + i * p;
+    if (accumulate) {
+      for (matrix_size j = 0; j < cols; ++j) {
+        outputRow[j] += sums[i][j];
+      }
+    } else {
+      for (matrix_size j = 0; j < cols; ++j) {
+        outputRow[j] = sums[i][j];
+      }
+    }
+  }
+}
+
+/**
+ * @brief Multiplies a matrix by a vector: output = matrix x vector, or
+ * transpose(matrix) x vector.
+ * Without transposition, 4 rows are processed together so that each element
+ * of the vector is loaded once for the 4 dot products. With transposition,
+ * the rows of the matrix are accumulated in the output, which is contiguous.
+ * @param matrix matrix of size rows * cols
+ * @param vector vector of cols elements, or rows elements when the matrix is
+ * transposed
+ * @param rows number of rows of the matrix
+ * @param cols number of columns of the matrix
+ * @param output vector of rows elements, or cols elements when the matrix is
+ * transposed. Must not overlap the inputs
+ * @param transposeMatrix whether to transpose the matrix
+ */
+void matrixVectorMultiply(const matrix_real_number* matrix,
+                          const matrix_real_number* vector,
+                          const matrix_size rows, const matrix_size cols,
+                          matrix_real_number* output,
+                          const matrix_size transposeMatrix) {
+  if (transposeMatrix) {
+    for (matrix_size j = 0; j < cols; ++j) {
+      output[j] = 0.0;
+    }
+    for (matrix_size i = 0; i < rows; ++i) {
+      vectorAxpy(output, matrix + i * cols, cols, vector[i]);
     }
+    return;
+  }
+
+  matrix_size i = 0;
+  for (; i + 4 <= rows; i += 4) {
+    const matrix_real_number* row0 = matrix + i * cols;
+    const matrix_real_number* row1 = row0 + cols;
+    const matrix_real_number* row2 = row1 + cols;
+    const matrix_real_number* row3 = row2 + cols;
+    matrix_real_number sum0 = 0.0;
+    matrix_real_number sum1 = 0.0;
+    matrix_real_number sum2 = 0.0;
+    matrix_real_number sum3 = 0.0;
+    for (matrix_size j = 0; j < cols; ++j) {
+      const matrix_real_number element = vector[j];
+      sum0 += row0[j] * element;
+      sum1 += row1[j] * element;
+      sum2 += row2[j] * element;
+      sum3 += row3[j] * element;
+    }
+    output[i] = sum0;
+    output[i + 1] = sum1;
+    output[i + 2] = sum2;
+    output[i + 3] = sum3;
+  }
+  for (; i < rows; ++i) {
+    output[i] = vectorDot(matrix + i * cols, vector, cols);
   }
 }
 
@@ -95,6 +447,54 @@ void vectorScale(matrix_real_number* vector, matrix_size nbElements,
   }
 }
 
+/**
+ * @brief Computes the dot product of 2 vectors
+ * @param vector1 The first vector
+ * @param vector2 The second vector
+ * @param nbElements The number of elements in the vectors
+ * @return The dot product
+ */
+matrix_real_number vectorDot(const matrix_real_number* vector1,
+                             const matrix_real_number* vector2,
+                             matrix_size nbElements) {
+  matrix_real_number sum = 0.0;
+  for (matrix_size i = 0; i < nbElements; ++i) {
+    sum += vector1[i] * vector2[i];
+  }
+  return sum;
+}
+
+/**
+ * @brief Adds a scaled vector to another one: output += scale * vector
+ * @param output The vector to add to
+ * @param vector The vector to scale
+ * @param nbElements The number of elements in the vectors
+ * @param scale The scalar
+ */
+void vectorAxpy(matrix_real_number* output, const matrix_real_number* vector,
+                matrix_size nbElements, matrix_real_number scale) {
+  for (matrix_size i = 0; i < nbElements; ++i) {
+    output[i] += scale * vector[i];
+  }
+}
+
+/**
+ * @brief Computes a linear combination of 2 vectors in place:
+ * output = scale * vector + outputScale * output
+ * @param output The second vector, receiving the result
+ * @param vector The first vector
+ * @param nbElements The number of elements in the vectors
+ * @param scale The scalar of vector
+ * @param outputScale The scalar of output
+ */
+void vectorAxpby(matrix_real_number* output, const matrix_real_number* vector,
+                 matrix_size nbElements, matrix_real_number scale,
+                 matrix_real_number outputScale) {
+  for (matrix_size i = 0; i < nbElements; ++i) {
+    output[i] = scale * vector[i] + outputScale * output[i];
+  }
+}
+
 /**
  * @brief Substracts 2 vectors together
  * @param vector1 The first vector
@@ -124,9 +524,136 @@ void makeUnitVector(matrix_real_number* vector, matrix_size nbElements) {
  * @param length the number of elements in the vector
  */
 matrix_real_number computeNorm(matrix_real_number* vector, matrix_size length) {
-  matrix_real_number tmp = 0;
-  for (matrix_size i = 0; i < length; ++i) {
-    tmp += vector[i] * vector[i];
+  return sqrt(vectorDot(vector, vector, length));
+}
+
+/**
+ * @brief Removes from a vector its components along orthonormal vectors,
+ * with the modified Gram-Schmidt process
+ * @param vector The vector to orthogonalize
+ * @param vectors The nbVectors orthonormal vectors, one after the other
+ * @param nbVectors The number of orthonormal vectors
+ * @param nbElements The number of elements in each vector
+ */
+void vectorOrthogonalize(matrix_real_number* vector,
+                         const matrix_real_number* vectors,
+                         matrix_size nbVectors, matrix_size nbElements) {
+  for (matrix_size i = 0; i < nbVectors; ++i) {
+    const matrix_real_number* other = vectors + (size_t)i * nbElements;
+    vectorAxpy(vector, other, nbElements,
+               -vectorDot(other, vector, nbElements));
+  }
+}
+
+/**
+ * @brief Copies the upper triangle of a symmetric matrix to packed storage,
+ * see symmetricPackedSize
+ * @param matrix the symmetric matrix of size * size elements
+ * @param size the number of rows and columns of the matrix
+ * @param packed array of symmetricPackedSize(size) elements receiving the
+ * packed matrix
+ */
+void symmetricPack(const matrix_real_number* matrix, const matrix_size size,
+                   matrix_real_number* packed) {
+  for (matrix_size i = 0; i < size; ++i) {
+    for (matrix_size j = i; j < size; ++j) {
+      *packed++ = matrix[coordToIndex(i, j, size)];
+    }
+  }
+}
+
+/**
+ * @brief Expands a symmetric matrix in packed storage to both triangles of a
+ * full matrix
+ * @param packed the packed matrix, see symmetricPackedSize
+ * @param size the number of rows and columns of the matrix
+ * @param matrix array of size * size elements receiving the full matrix
+ */
+void symmetricUnpack(const matrix_real_number* packed, const matrix_size size,
+                     matrix_real_number* matrix) {
+  for (matrix_size i = 0; i < size; ++i) {
+    for (matrix_size j = i; j < size; ++j) {
+      const matrix_real_number element = *packed++;
+      matrix[coordToIndex(i, j, size)] = element;
+      matrix[coordToIndex(j, i, size)] = element;
+    }
+  }
+}
+
+/**
+ * @brief Multiplies a symmetric matrix in packed storage by a vector:
+ * output = matrix x vector.
+ * Each element of the upper triangle is read once, and contributes to its
+ * row and to its mirror in the lower triangle.
+ * @param packed the packed matrix, see symmetricPackedSize
+ * @param vector vector of size elements
+ * @param size the number of rows and columns of the matrix
+ * @param output vector of size elements. Must not overlap the inputs
+ */
+void symmetricMatrixVectorMultiply(const matrix_real_number* packed,
+                                   const matrix_real_number* vector,
+                                   const matrix_size size,
+                                   matrix_real_number* output) {
+  for (matrix_size i = 0; i < size; ++i) {
+    output[i] = 0.0;
+  }
+
+  // The row i of the upper triangle starts at its diagonal element
+  for (matrix_size i = 0; i < size; ++i) {
+    const matrix_real_number* row = packed - i;
+    const matrix_real_number element = vector[i];
+    matrix_real_number sum = row[i] * element;
+    for (matrix_size j = i + 1; j < size; ++j) {
+      sum += row[j] * vector[j];
+      output[j] += row[j] * element;
+    }
+    output[i] += sum;
+    packed += size - i;
+  }
+}
+
+/**
+ * @brief Symmetric rank 1 update of a matrix in packed storage:
+ * matrix += scale * vector x transpose(vector)
+ * @param packed the packed matrix, see symmetricPackedSize
+ * @param size the number of rows and columns of the matrix
+ * @param scale the scalar
+ * @param vector vector of size elements
+ */
+void symmetricRank1Update(matrix_real_number* packed, const matrix_size size,
+                          const matrix_real_number scale,
+                          const matrix_real_number* vector) {
+  for (matrix_size i = 0; i < size; ++i) {
+    matrix_real_number* row = packed - i;
+    const matrix_real_number rowScale = scale * vector[i];
+    for (matrix_size j = i; j < size; ++j) {
+      row[j] += rowScale * vector[j];
+    }
+    packed += size - i;
+  }
+}
+
+/**
+ * @brief Symmetric rank 2 update of a matrix in packed storage:
+ * matrix += scale * (vector1 x transpose(vector2) + vector2 x
+ * transpose(vector1))
+ * @param packed the packed matrix, see symmetricPackedSize
+ * @param size the number of rows and columns of the matrix
+ * @param scale the scalar
+ * @param vector1 first vector of size elements
+ * @param vector2 second vector of size elements
+ */
+void symmetricRank2Update(matrix_real_number* packed, const matrix_size size,
+                          const matrix_real_number scale,
+                          const matrix_real_number* vector1,
+                          const matrix_real_number* vector2) {
+  for (matrix_size i = 0; i < size; ++i) {
+    matrix_real_number* row = packed - i;
+    const matrix_real_number rowScale1 = scale * vector1[i];
+    const matrix_real_number rowScale2 = scale * vector2[i];
+    for (matrix_size j = i; j < size; ++j) {
+      row[j] += rowScale1 * vector2[j] + rowScale2 * vector1[j];
+    }
+    packed += size - i;
   }
-  return sqrt(tmp);
 }
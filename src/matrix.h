@@ -4,27 +4,126 @@
 typedef unsigned int matrix_size;
 typedef double matrix_real_number;
 
+// Block sizes of matrixMultiply. Products with fewer than
+// MATRIX_BLOCKING_THRESHOLD multiply-adds use direct loops. Larger ones are
+// computed by blocks of MATRIX_BLOCK_M rows of the first matrix, of
+// MATRIX_BLOCK_K elements of the shared dimension and of MATRIX_BLOCK_N
+// columns of the second matrix, which are copied to contiguous buffers.
+// The block sizes must be multiples of the micro-kernel sizes, 4 rows by 8
+// columns.
+#ifndef MATRIX_BLOCKING_THRESHOLD
+#define MATRIX_BLOCKING_THRESHOLD 32768
+#endif
+
+#ifndef MATRIX_BLOCK_M
+#define MATRIX_BLOCK_M 64
+#endif
+
+#ifndef MATRIX_BLOCK_K
+#define MATRIX_BLOCK_K 256
+#endif
+
+#ifndef MATRIX_BLOCK_N
+#define MATRIX_BLOCK_N 512
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-matrix_size coordToIndex(const matrix_size row, const matrix_size col,
-                         const matrix_size size);
-matrix_size isDiagonal(const matrix_size index, const matrix_size size);
+/**
+ * @brief Converts a 2d coordinate in a matrix to an index in a 2d array
+ * @param row the row number
+ * @param col the column number
+ * @param size the number of columns in the matrix
+ */
+static inline matrix_size coordToIndex(const matrix_size row,
+                                       const matrix_size col,
+                                       const matrix_size size) {
+  return row * size + col;
+}
+
+/**
+ * @brief Check if the given index is part of the diagonal
+ * @param index the index to check
+ * @param size the number of columns in the matrix
+ */
+static inline matrix_size isDiagonal(const matrix_size index,
+                                     const matrix_size size) {
+  return ((index / size) == (index % size));
+}
+
+/**
+ * @brief Number of elements of a symmetric matrix in packed storage.
+ * The packed storage keeps the upper triangle, diagonal included, row after
+ * row: row i holds the size - i elements from column i to column size - 1.
+ * @param size the number of rows and columns of the matrix
+ */
+static inline matrix_size symmetricPackedSize(const matrix_size size) {
+  return size * (size + 1) / 2;
+}
+
+/**
+ * @brief Converts a 2d coordinate in a symmetric matrix to an index in its
+ * packed storage. The coordinate can be in either triangle.
+ * @param row the row number
+ * @param col the column number
+ * @param size the number of rows and columns of the matrix
+ */
+static inline matrix_size coordToPackedIndex(const matrix_size row,
+                                             const matrix_size col,
+                                             const matrix_size size) {
+  const matrix_size upperRow = row < col ? row : col;
+  const matrix_size upperCol = row < col ? col : row;
+  return upperRow * (2 * size - upperRow - 1) / 2 + upperCol;
+}
+
 void matrixMultiply(const matrix_real_number* firstMatrix,
                     const matrix_real_number* secondMatrix,
                     const matrix_size size[3], matrix_real_number* output,
                     const matrix_size transposeFirstMatrix);
+void matrixVectorMultiply(const matrix_real_number* matrix,
+                          const matrix_real_number* vector,
+                          const matrix_size rows, const matrix_size cols,
+                          matrix_real_number* output,
+                          const matrix_size transposeMatrix);
 void createIdentityMatrix(const matrix_size size, matrix_real_number* output);
+matrix_real_number vectorDot(const matrix_real_number* vector1,
+                             const matrix_real_number* vector2,
+                             matrix_size nbElements);
+void vectorAxpy(matrix_real_number* output, const matrix_real_number* vector,
+                matrix_size nbElements, matrix_real_number scale);
+void vectorAxpby(matrix_real_number* output, const matrix_real_number* vector,
+                 matrix_size nbElements, matrix_real_number scale,
+                 matrix_real_number outputScale);
 void vectorScale(matrix_real_number* vector, matrix_size nbElements,
                  matrix_real_number scale);
 void vectorSubstract(matrix_real_number* vector1, matrix_real_number* vector2,
                      matrix_size dim);
 void makeUnitVector(matrix_real_number* vector, matrix_size nbElements);
 matrix_real_number computeNorm(matrix_real_number* vector, matrix_size length);
+void vectorOrthogonalize(matrix_real_number* vector,
+                         const matrix_real_number* vectors,
+                         matrix_size nbVectors, matrix_size nbElements);
 void matrixTranspose(matrix_real_number* input, matrix_real_number* output,
                      matrix_size* dims);
 
+void symmetricPack(const matrix_real_number* matrix, const matrix_size size,
+                   matrix_real_number* packed);
+void symmetricUnpack(const matrix_real_number* packed, const matrix_size size,
+                     matrix_real_number* matrix);
+void symmetricMatrixVectorMultiply(const matrix_real_number* packed,
+                                   const matrix_real_number* vector,
+                                   const matrix_size size,
+                                   matrix_real_number* output);
+void symmetricRank1Update(matrix_real_number* packed, const matrix_size size,
+                          const matrix_real_number scale,
+                          const matrix_real_number* vector);
+void symmetricRank2Update(matrix_real_number* packed, const matrix_size size,
+                          const matrix_real_number scale,
+                          const matrix_real_number* vector1,
+                          const matrix_real_number* vector2);
+
 #ifdef __cplusplus
 }
 #endif
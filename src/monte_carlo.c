@@ -4,6 +4,10 @@
 #include <stdlib.h>
 #include <string.h>
 
+#ifdef MONTE_CARLO_FAST_MATH
+#include "fast_math.h"
+#endif
+
 /**
  * @brief This method calculates the UCB value for a node.
  * @param node The node for which the UCB is calculated.
@@ -13,8 +17,15 @@ mc_real calcUCB(Node* node) {
   if (node->nVisits == 0) {
     return UCB_MAX;
   }
+#ifdef MONTE_CARLO_FAST_MATH
+  return node->score / node->nVisits +
+         fastSqrt(2 * fastLog10(node->parent->nVisits, MONTE_CARLO_FAST_MATH) /
+                      node->nVisits,
+                  MONTE_CARLO_FAST_MATH);
+#else
   return node->score / node->nVisits +
          sqrt(2 * log10(node->parent->nVisits) / node->nVisits);
+#endif
 }
 
 /**
@@ -12,6 +12,9 @@
 #define UCB_MAX 1000
 #endif
 
+// Define MONTE_CARLO_FAST_MATH to a fast_math degree to compute the UCB without
+// libm. The UCB only orders the children, so a low degree is usually enough.
+
 #ifdef __cplusplus
 extern "C" {
 #endif
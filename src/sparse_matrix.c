@@ -0,0 +1,345 @@
+#include "sparse_matrix.h"
+#include <math.h>
+#include <stdlib.h>
+
+/**
+ * @brief Allocates a matrix with room for nbNonZeros elements
+ * @return the matrix, or NULL if an allocation failed
+ */
+static sparse_matrix* allocateMatrix(const matrix_size nbRows,
+                                     const matrix_size nbCols,
+                                     const matrix_size nbNonZeros) {
+  sparse_matrix* matrix = calloc(1, sizeof(sparse_matrix));
+  if (matrix == NULL) {
+    return NULL;
+  }
+
+  matrix->nbRows = nbRows;
+  matrix->nbCols = nbCols;
+  matrix->nbNonZeros = nbNonZeros;
+  matrix->rowOffsets = calloc(nbRows + 1, sizeof(matrix_size));
+  // At least one element, so that NULL always means a failed allocation
+  matrix->columns = malloc((nbNonZeros + 1) * sizeof(matrix_size));
+  matrix->values = malloc((nbNonZeros + 1) * sizeof(matrix_real_number));
+  if (matrix->rowOffsets == NULL || matrix->columns == NULL ||
+      matrix->values == NULL) {
+    sparseMatrixDestroy(matrix);
+    return NULL;
+  }
+  return matrix;
+}
+
+/**
+ * @brief Creates a sparse matrix from its elements given as coordinates
+ * (COO). The entries can be in any order, and entries with the same
+ * coordinates are summed.
+ * @param nbRows number of rows of the matrix
+ * @param nbCols number of columns of the matrix
+ * @param nbEntries number of entries
+ * @param rows row of each entry
+ * @param cols column of each entry
+ * @param values value of each entry
+ * @return the matrix, or NULL if a coordinate is outside of the matrix or if
+ * an allocation failed
+ */
+sparse_matrix* sparseMatrixCreate(const matrix_size nbRows,
+                                  const matrix_size nbCols,
+                                  const matrix_size nbEntries,
+                                  const matrix_size* rows,
+                                  const matrix_size* cols,
+                                  const matrix_real_number* values) {
+  for (matrix_size e = 0; e < nbEntries; ++e) {
+    if (rows[e] >= nbRows || cols[e] >= nbCols) {
+      return NULL;
+    }
+  }
+
+  sparse_matrix* matrix = allocateMatrix(nbRows, nbCols, nbEntries);
+  matrix_size* columnOffsets = calloc(nbCols + 1, sizeof(matrix_size));
+  matrix_size* rowPositions = malloc((nbRows + 1) * sizeof(matrix_size));
+  matrix_size* order = malloc((nbEntries + 1) * sizeof(matrix_size));
+  if (matrix == NULL || columnOffsets == NULL || rowPositions == NULL ||
+      order == NULL) {
+    sparseMatrixDestroy(matrix);
+    free(columnOffsets);
+    free(rowPositions);
+    free(order);
+    return NULL;
+  }
+
+  // Counting sort of the entries by column, then a stable counting sort by
+  // row: the columns of each row end up in increasing order, in O(nbEntries)
+  for (matrix_size e = 0; e < nbEntries; ++e) {
+    ++columnOffsets[cols[e] + 1];
+    ++matrix->rowOffsets[rows[e] + 1];
+  }
+  for (matrix_size j = 0; j < nbCols; ++j) {
+    columnOffsets[j + 1] += columnOffsets[j];
+  }
+  for (matrix_size i = 0; i < nbRows; ++i) {
+    matrix->rowOffsets[i + 1] += matrix->rowOffsets[i];
+    rowPositions[i] = matrix->rowOffsets[i];
+  }
+  for (matrix_size e = 0; e < nbEntries; ++e) {
+    order[columnOffsets[cols[e]]++] = e;
+  }
+  for (matrix_size k = 0; k < nbEntries; ++k) {
+    const matrix_size e = order[k];
+    const matrix_size position = rowPositions[rows[e]]++;
+    matrix->columns[position] = cols[e];
+    matrix->values[position] = values[e];
+  }
+
+  // Sums the duplicates, which are next to each other in their row
+  matrix_size nbNonZeros = 0;
+  matrix_size rowStart = 0;
+  for (matrix_size i = 0; i < nbRows; ++i) {
+    const matrix_size rowEnd = matrix->rowOffsets[i + 1];
+    matrix->rowOffsets[i] = nbNonZeros;
+    for (matrix_size k = rowStart; k < rowEnd; ++k) {
+      if (nbNonZeros > matrix->rowOffsets[i] &&
+          matrix->columns[nbNonZeros - 1] == matrix->columns[k]) {
+        matrix->values[nbNonZeros - 1] += matrix->values[k];
+      } else {
+        matrix->columns[nbNonZeros] = matrix->columns[k];
+        matrix->values[nbNonZeros] = matrix->values[k];
+        ++nbNonZeros;
+      }
+    }
+    rowStart = rowEnd;
+  }
+  matrix->rowOffsets[nbRows] = nbNonZeros;
+  matrix->nbNonZeros = nbNonZeros;
+
+  free(columnOffsets);
+  free(rowPositions);
+  free(order);
+  return matrix;
+}
+
+/**
+ * @brief Creates a sparse matrix from the non-zero elements of a dense matrix
+ * @param matrix the dense matrix, of nbRows * nbCols elements
+ * @param nbRows number of rows of the matrix
+ * @param nbCols number of columns of the matrix
+ * @return the matrix, or NULL if an allocation failed
+ */
+sparse_matrix* sparseMatrixCreateFromDense(const matrix_real_number* matrix,
+                                           const matrix_size nbRows,
+                                           const matrix_size nbCols) {
+  matrix_size nbNonZeros = 0;
+  for (matrix_size i = 0; i < nbRows * nbCols; ++i) {
+    nbNonZeros += matrix[i] != 0.0;
+  }
+
+  sparse_matrix* sparse = allocateMatrix(nbRows, nbCols, nbNonZeros);
+  if (sparse == NULL) {
+    return NULL;
+  }
+
+  matrix_size position = 0;
+  for (matrix_size i = 0; i < nbRows; ++i) {
+    for (matrix_size j = 0; j < nbCols; ++j) {
+      const matrix_real_number element = matrix[coordToIndex(i, j, nbCols)];
+      if (element != 0.0) {
+        sparse->columns[position] = j;
+        sparse->values[position] = element;
+        ++position;
+      }
+    }
+    sparse->rowOffsets[i + 1] = position;
+  }
+  return sparse;
+}
+
+/**
+ * @brief Releases a sparse matrix. Does nothing if the matrix is NULL.
+ * @param matrix the matrix
+ */
+void sparseMatrixDestroy(sparse_matrix* matrix) {
+  if (matrix == NULL) {
+    return;
+  }
+  free(matrix->rowOffsets);
+  free(matrix->columns);
+  free(matrix->values);
+  free(matrix);
+}
+
+/**
+ * @brief Multiplies a sparse matrix by a vector: output = matrix x vector, or
+ * output = transpose(matrix) x vector
+ * @param matrix the sparse matrix
+ * @param vector vector of nbCols elements, or nbRows elements when the matrix
+ * is transposed
+ * @param output vector of nbRows elements, or nbCols elements when the matrix
+ * is transposed. Must not overlap the vector
+ * @param transposeMatrix whether to transpose the matrix
+ */
+void sparseMatrixVectorMultiply(const sparse_matrix* matrix,
+                                const matrix_real_number* vector,
+                                matrix_real_number* output,
+                                const matrix_size transposeMatrix) {
+  const matrix_size* columns = matrix->columns;
+  const matrix_real_number* values = matrix->values;
+
+  if (transposeMatrix) {
+    // Each row scatters its elements in the output
+    for (matrix_size j = 0; j < matrix->nbCols; ++j) {
+      output[j] = 0.0;
+    }
+    for (matrix_size i = 0; i < matrix->nbRows; ++i) {
+      const matrix_real_number element = vector[i];
+      const matrix_size rowEnd = matrix->rowOffsets[i + 1];
+      for (matrix_size k = matrix->rowOffsets[i]; k < rowEnd; ++k) {
+        output[columns[k]] += values[k] * element;
+      }
+    }
+    return;
+  }
+
+  for (matrix_size i = 0; i < matrix->nbRows; ++i) {
+    matrix_real_number sum = 0.0;
+    const matrix_size rowEnd = matrix->rowOffsets[i + 1];
+    for (matrix_size k = matrix->rowOffsets[i]; k < rowEnd; ++k) {
+      sum += values[k] * vector[columns[k]];
+    }
+    output[i] = sum;
+  }
+}
+
+/**
+ * @brief Solves the triangular system matrix x output = vector. Only the
+ * lower triangle of the matrix is used, or its upper triangle, and the
+ * diagonal. The other elements are ignored, so a matrix holding both
+ * triangles, such as an LU decomposition without its unit diagonal, can be
+ * solved in two calls.
+ * @param matrix the square sparse matrix
+ * @param vector vector of nbRows elements
+ * @param output vector of nbRows elements receiving the solution. Can be the
+ * same as vector
+ * @param upper 0 to use the lower triangle, by forward substitution, and 1 to
+ * use the upper triangle, by backward substitution
+ * @return 1 if the matrix is not square or if an element of its diagonal is
+ * 0, 0 otherwise
+ */
+int sparseTriangularSolve(const sparse_matrix* matrix,
+                          const matrix_real_number* vector,
+                          matrix_real_number* output, const int upper) {
+  if (matrix->nbRows != matrix->nbCols) {
+    return 1;
+  }
+
+  const matrix_size size = matrix->nbRows;
+  for (matrix_size n = 0; n < size; ++n) {
+    const matrix_size i = upper ? size - 1 - n : n;
+    matrix_real_number sum = vector[i];
+    matrix_real_number diagonal = 0.0;
+    const matrix_size rowEnd = matrix->rowOffsets[i + 1];
+    for (matrix_size k = matrix->rowOffsets[i]; k < rowEnd; ++k) {
+      const matrix_size j = matrix->columns[k];
+      if (j == i) {
+        diagonal += matrix->values[k];
+      } else if ((j > i) == (upper != 0)) {
+        sum -= matrix->values[k] * output[j];
+      }
+    }
+    if (diagonal == 0.0) {
+      return 1;
+    }
+    output[i] = sum / diagonal;
+  }
+  return 0;
+}
+
+/**
+ * @brief Solves matrix x output = vector with the conjugate gradient method.
+ * The matrix must be symmetric and positive definite. Each iteration costs one
+ * sparse matrix-vector product.
+ * @param matrix the square sparse matrix
+ * @param vector vector of nbRows elements
+ * @param output vector of nbRows elements. Holds the initial guess, 0 if
+ * unknown, and receives the solution
+ * @param maxIter maximum number of iterations
+ * @param tolerance the iterations stop once the norm of the residual is below
+ * tolerance times the norm of the vector
+ * @return 1 if the matrix is not square, if an allocation failed or if the
+ * method did not converge in maxIter iterations, 0 otherwise
+ */
+int sparseConjugateGradient(const sparse_matrix* matrix,
+                            const matrix_real_number* vector,
+                            matrix_real_number* output,
+                            const matrix_size maxIter,
+                            const matrix_real_number tolerance) {
+  if (matrix->nbRows != matrix->nbCols) {
+    return 1;
+  }
+
+  const matrix_size size = matrix->nbRows;
+  matrix_real_number* residual = malloc(3 * size * sizeof(matrix_real_number));
+  if (residual == NULL) {
+    return 1;
+  }
+  matrix_real_number* direction = residual + size;
+  matrix_real_number* product = direction + size;
+
+  // residual = vector - matrix x output
+  sparseMatrixVectorMultiply(matrix, output, residual, 0);
+  vectorAxpby(residual, vector, size, 1.0, -1.0);
+  for (matrix_size i = 0; i < size; ++i) {
+    direction[i] = residual[i];
+  }
+
+  const matrix_real_number threshold =
+      tolerance * tolerance * vectorDot(vector, vector, size);
+  matrix_real_number residualNorm = vectorDot(residual, residual, size);
+  int returnCode = 1;
+  for (matrix_size iter = 0; iter <= maxIter; ++iter) {
+    if (residualNorm <= threshold) {
+      returnCode = 0;
+      break;
+    }
+    if (iter == maxIter) {
+      break;
+    }
+
+    sparseMatrixVectorMultiply(matrix, direction, product, 0);
+    const matrix_real_number curvature = vectorDot(direction, product, size);
+    if (curvature <= 0.0) {
+      // Not positive definite
+      break;
+    }
+
+    const matrix_real_number step = residualNorm / curvature;
+    vectorAxpy(output, direction, size, step);
+    vectorAxpy(residual, product, size, -step);
+
+    const matrix_real_number newResidualNorm =
+        vectorDot(residual, residual, size);
+    vectorAxpby(direction, residual, size, 1.0, newResidualNorm / residualNorm);
+    residualNorm = newResidualNorm;
+  }
+
+  free(residual);
+  return returnCode;
+}
+
+/**
+ * Product of the sparse matrix given to lanczosSparse by a vector
+ */
+static void sparseMultiply(void* matrix, const lanczos_real* vector,
+                           size_t dim, lanczos_real* output) {
+  (void)dim; // The number of rows of the matrix
+  sparseMatrixVectorMultiply(matrix, vector, output, 0);
+}
+
+int lanczosSparse(const sparse_matrix* matrix, size_t nbIter,
+                  lanczos_real* initialVector, lanczos_real* tMatrix,
+                  lanczos_real* vMatrix) {
+  if (matrix->nbRows != matrix->nbCols) {
+    return 1;
+  }
+  // The context is only read by sparseMultiply
+  return lanczosOperator(sparseMultiply, (void*)matrix, matrix->nbRows, nbIter,
+                         initialVector, tMatrix, vMatrix);
+}
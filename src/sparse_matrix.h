@@ -0,0 +1,67 @@
+#ifndef SPARSE_MATRIX_H
+#define SPARSE_MATRIX_H
+
+#include "lanczos.h"
+#include "matrix.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Sparse matrix in compressed sparse row (CSR) storage. The non-zero elements
+ * of the row i are values[rowOffsets[i]] to values[rowOffsets[i + 1] - 1],
+ * their columns are in the same positions of columns, in increasing order.
+ * A matrix is built from coordinates (COO) with sparseMatrixCreate, or from a
+ * dense matrix with sparseMatrixCreateFromDense, and must be released with
+ * sparseMatrixDestroy.
+ */
+typedef struct sparse_matrix {
+  matrix_size nbRows;         // Number of rows
+  matrix_size nbCols;         // Number of columns
+  matrix_size nbNonZeros;     // Number of stored elements
+  matrix_size* rowOffsets;    // nbRows + 1 offsets in columns and values
+  matrix_size* columns;       // Column of each stored element
+  matrix_real_number* values; // Value of each stored element
+} sparse_matrix;
+
+sparse_matrix* sparseMatrixCreate(const matrix_size nbRows,
+                                  const matrix_size nbCols,
+                                  const matrix_size nbEntries,
+                                  const matrix_size* rows,
+                                  const matrix_size* cols,
+                                  const matrix_real_number* values);
+sparse_matrix* sparseMatrixCreateFromDense(const matrix_real_number* matrix,
+                                           const matrix_size nbRows,
+                                           const matrix_size nbCols);
+void sparseMatrixDestroy(sparse_matrix* matrix);
+
+void sparseMatrixVectorMultiply(const sparse_matrix* matrix,
+                                const matrix_real_number* vector,
+                                matrix_real_number* output,
+                                const matrix_size transposeMatrix);
+int sparseTriangularSolve(const sparse_matrix* matrix,
+                          const matrix_real_number* vector,
+                          matrix_real_number* output, const int upper);
+int sparseConjugateGradient(const sparse_matrix* matrix,
+                            const matrix_real_number* vector,
+                            matrix_real_number* output,
+                            const matrix_size maxIter,
+                            const matrix_real_number tolerance);
+
+/**
+ * Same as lanczos in lanczos.h, for a symmetric matrix in sparse storage. Each
+ * iteration costs one sparse matrix-vector product, instead of dim * dim
+ * operations. The dimension is the number of rows of the matrix.
+ * Returns 1 if the matrix is not square or if the work buffers could not be
+ * allocated, 0 otherwise.
+ */
+int lanczosSparse(const sparse_matrix* matrix, size_t nbIter,
+                  lanczos_real* initialVector, lanczos_real* tMatrix,
+                  lanczos_real* vMatrix);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SPARSE_MATRIX_H
@@ -1,5 +1,9 @@
 #include "stats.h"
 
+#ifdef STATS_FAST_MATH
+#include "fast_math.h"
+#endif
+
 #define min(a, b) ((a) < (b) ? (a) : (b))
 
 
@@ -235,7 +239,11 @@ static real_number distance(real_number* p1, real_number* p2, vec_size size) {
     currentDistance += subP1P2 * subP1P2;
   }
 
+#ifdef STATS_FAST_MATH
+  return fastSqrt(currentDistance, STATS_FAST_MATH);
+#else
   return sqrt(currentDistance);
+#endif
 }
 
 /**
@@ -8,6 +8,9 @@
 #include <stdlib.h>
 #include <string.h>
 
+// Define STATS_FAST_MATH to a fast_math degree for the distances of the
+// clustering to use fastSqrt instead of sqrt
+
 #define STATS_SUCCESS 0
 #define STATS_NOT_ENOUGH_POINTS 1
 #define STATS_VARIANCE_IS_NULL 2
@@ -0,0 +1,176 @@
+#include "stft.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief Computes a periodic Hann window, which sums to a constant when the
+ * frames overlap by half or by three quarters.
+ * @param length The length of the window
+ * @param window Array of length elements receiving the window
+ */
+void stftHannWindow(const unsigned length, fft_real* window) {
+  for (unsigned i = 0; i < length; ++i) {
+    window[i] = 0.5 - 0.5 * cos(2.0 * M_PI * i / length);
+  }
+}
+
+/**
+ * @brief Creates a streaming short-time Fourier transform.
+ * The first frame is complete once frameLength samples are pushed. The
+ * following ones start every hop samples. A hop greater than the frame length
+ * skips the samples between two frames.
+ * @param frameLength The number of samples per frame. Must be a power of 2
+ * greater or equal to 2
+ * @param hop The number of samples between the start of two frames
+ * @param window The window of frameLength elements applied to each frame. It
+ * is copied. NULL for a rectangular window
+ * @param callback The function receiving the spectrum of each frame
+ * @param context The context given to the callback
+ * @return The transform, or NULL if an error occured. It must be released
+ * with stftDestroy
+ */
+stft* stftCreate(const unsigned frameLength, const unsigned hop,
+                 const fft_real* window, stft_callback callback,
+                 void* context) {
+  if (frameLength < 2 || (frameLength & (frameLength - 1)) != 0 || hop == 0 ||
+      callback == NULL) {
+    return NULL;
+  }
+
+  stft* transform = calloc(1, sizeof(stft));
+  if (transform == NULL) {
+    return NULL;
+  }
+
+  transform->frameLength = frameLength;
+  transform->hop = hop;
+  transform->callback = callback;
+  transform->context = context;
+
+  // A single allocation holds the window, the ring buffer, the frame and
+  // the bins
+  const unsigned nbBins = frameLength / 2 + 1;
+  transform->window = malloc((3 * frameLength + 2 * nbBins) * sizeof(fft_real));
+  transform->plan = fftPlanCreate(frameLength);
+  if (transform->window == NULL || transform->plan == NULL) {
+    stftDestroy(transform);
+    return NULL;
+  }
+
+  transform->ring = transform->window + frameLength;
+  transform->frame = transform->ring + frameLength;
+  transform->binReals = transform->frame + frameLength;
+  transform->binImgs = transform->binReals + nbBins;
+
+  for (unsigned i = 0; i < frameLength; ++i) {
+    transform->window[i] = window == NULL ? 1.0 : window[i];
+  }
+
+  stftReset(transform);
+  return transform;
+}
+
+/**
+ * @brief Forgets every sample pushed so far. The next frame starts with the
+ * next pushed sample and has the index 0.
+ * @param transform The transform
+ */
+void stftReset(stft* transform) {
+  if (transform == NULL) {
+    return;
+  }
+
+  memset(transform->ring, 0, transform->frameLength * sizeof(fft_real));
+  transform->writeIndex = 0;
+  transform->remaining = transform->frameLength;
+  transform->frameIndex = 0;
+}
+
+/**
+ * Windows the last frameLength samples of the ring buffer, computes their
+ * real FFT and gives it to the callback.
+ * @param transform The transform
+ */
+static void stftEmitFrame(stft* transform) {
+
+  // The oldest sample is the next one to be overwritten
+  const unsigned frameLength = transform->frameLength;
+  const unsigned oldest = transform->writeIndex;
+  const unsigned firstPart = frameLength - oldest;
+  const fft_real* window = transform->window;
+  const fft_real* ring = transform->ring;
+  fft_real* frame = transform->frame;
+
+  for (unsigned i = 0; i < firstPart; ++i) {
+    frame[i] = window[i] * ring[oldest + i];
+  }
+  for (unsigned i = firstPart; i < frameLength; ++i) {
+    frame[i] = window[i] * ring[i - firstPart];
+  }
+
+  fftPlanExecuteReal(transform->plan, frame, transform->binReals,
+                     transform->binImgs);
+  transform->callback(transform->binReals, transform->binImgs,
+                      frameLength / 2 + 1, transform->frameIndex,
+                      transform->context);
+  ++transform->frameIndex;
+}
+
+/**
+ * @brief Pushes samples to the transform. The callback is called for every
+ * frame completed by these samples, before the function returns.
+ * @param transform The transform
+ * @param samples The samples to push
+ * @param count The number of samples. Can be anything, including 0
+ * @return 1 if an error occured, 0 otherwise
+ */
+int stftPush(stft* transform, const fft_real* samples, const unsigned count) {
+  if (transform == NULL || (samples == NULL && count > 0)) {
+    return 1;
+  }
+
+  const unsigned frameLength = transform->frameLength;
+  unsigned pushed = 0;
+  while (pushed < count) {
+
+    // Copy up to the next frame, or up to the end of the ring buffer
+    unsigned nbSamples = count - pushed;
+    if (nbSamples > transform->remaining) {
+      nbSamples = transform->remaining;
+    }
+    if (nbSamples > frameLength - transform->writeIndex) {
+      nbSamples = frameLength - transform->writeIndex;
+    }
+
+    memcpy(transform->ring + transform->writeIndex, samples + pushed,
+           nbSamples * sizeof(fft_real));
+    pushed += nbSamples;
+    transform->remaining -= nbSamples;
+    transform->writeIndex += nbSamples;
+    if (transform->writeIndex == frameLength) {
+      transform->writeIndex = 0;
+    }
+
+    if (transform->remaining == 0) {
+      stftEmitFrame(transform);
+      transform->remaining = transform->hop;
+    }
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Releases the memory of a transform
+ * @param transform The transform to release. Can be NULL
+ */
+void stftDestroy(stft* transform) {
+  if (transform == NULL) {
+    return;
+  }
+
+  fftPlanDestroy(transform->plan);
+  free(transform->window);
+  free(transform);
+}
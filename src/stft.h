@@ -0,0 +1,59 @@
+#ifndef STFT_H
+#define STFT_H
+
+#include "FFT.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Receives the spectrum of each frame of a short-time Fourier transform.
+ * The bins are only valid during the call.
+ * @param binReals The real part of the frameLength / 2 + 1 bins
+ * @param binImgs The imaginary part of the frameLength / 2 + 1 bins
+ * @param nbBins The number of bins, frameLength / 2 + 1
+ * @param frameIndex The index of the frame since the creation or the last
+ * reset. The frame starts at the sample frameIndex * hop
+ * @param context The context given to stftCreate
+ */
+typedef void (*stft_callback)(const fft_real* binReals, const fft_real* binImgs,
+                              const unsigned nbBins, const unsigned frameIndex,
+                              void* context);
+
+/**
+ * Streaming short-time Fourier transform. Samples are pushed in chunks of any
+ * size with stftPush, and the spectrum of every frame of frameLength samples,
+ * taken every hop samples, is given to the callback.
+ * All the memory is allocated by stftCreate.
+ */
+typedef struct stft {
+  unsigned frameLength; // Number of samples per frame. Must be a power of 2
+  unsigned hop;         // Number of samples between the start of two frames
+  unsigned writeIndex;  // Position of the next sample in the ring buffer
+  unsigned remaining;   // Number of samples to push before the next frame
+  unsigned frameIndex;  // Index of the next frame
+  fft_plan* plan;       // Real FFT plan of length frameLength
+  fft_real* window;     // Window applied to each frame
+  fft_real* ring;       // Last frameLength samples
+  fft_real* frame;      // Windowed frame, in chronological order
+  fft_real* binReals;   // Real part of the spectrum of the frame
+  fft_real* binImgs;    // Imaginary part of the spectrum of the frame
+  stft_callback callback;
+  void* context;
+} stft;
+
+void stftHannWindow(const unsigned length, fft_real* window);
+
+stft* stftCreate(const unsigned frameLength, const unsigned hop,
+                 const fft_real* window, stft_callback callback,
+                 void* context);
+int stftPush(stft* transform, const fft_real* samples, const unsigned count);
+void stftReset(stft* transform);
+void stftDestroy(stft* transform);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // STFT_H
@@ -0,0 +1,288 @@
+#include "symmetric_eigen.h"
+#include <float.h>
+#include <math.h>
+#include <stddef.h>
+
+/**
+ * @brief Reduces a symmetric matrix to a tridiagonal matrix T with Householder
+ * reflections: matrix = Q x T x transpose(Q). Only the lower triangle of the
+ * matrix is read.
+ * @param matrix the symmetric matrix of size * size elements. Receives Q when
+ * the vectors are computed, and is destroyed otherwise
+ * @param size the number of rows and columns of the matrix
+ * @param diagonal array of size elements receiving the diagonal of T
+ * @param offDiagonal array of size elements receiving the off diagonal of T,
+ * the last element being 0
+ * @param computeVectors whether to accumulate Q in the matrix
+ */
+void householderTridiagonalize(matrix_real_number* matrix,
+                               const matrix_size size,
+                               matrix_real_number* diagonal,
+                               matrix_real_number* offDiagonal,
+                               const int computeVectors) {
+  if (size == 0) {
+    return;
+  }
+
+  // Each step annihilates the row i left of its subdiagonal element, with the
+  // reflection I - u x transpose(u) / h stored in the row i. offDiagonal[i]
+  // first holds the element at (i, i - 1), and diagonal[i] holds h.
+  for (matrix_size i = size - 1; i > 0; --i) {
+    matrix_real_number* row = matrix + i * size;
+    const matrix_size l = i - 1;
+    matrix_real_number h = 0.0;
+    matrix_real_number scale = 0.0;
+    for (matrix_size k = 0; k < i; ++k) {
+      scale += fabs(row[k]);
+    }
+
+    if (l == 0 || scale == 0.0) {
+      // Nothing to annihilate
+      offDiagonal[i] = row[l];
+    } else {
+      for (matrix_size k = 0; k < i; ++k) {
+        row[k] /= scale;
+        h += row[k] * row[k];
+      }
+      matrix_real_number f = row[l];
+      matrix_real_number g = f >= 0.0 ? -sqrt(h) : sqrt(h);
+      offDiagonal[i] = scale * g;
+      h -= f * g;
+      row[l] = f - g;
+
+      // p = A x u / h, stored in offDiagonal, and K = transpose(u) x p / 2h
+      f = 0.0;
+      for (matrix_size j = 0; j < i; ++j) {
+        if (computeVectors) {
+          matrix[coordToIndex(j, i, size)] = row[j] / h;
+        }
+        g = 0.0;
+        for (matrix_size k = 0; k <= j; ++k) {
+          g += matrix[coordToIndex(j, k, size)] * row[k];
+        }
+        for (matrix_size k = j + 1; k < i; ++k) {
+          g += matrix[coordToIndex(k, j, size)] * row[k];
+        }
+        offDiagonal[j] = g / h;
+        f += offDiagonal[j] * row[j];
+      }
+      const matrix_real_number hh = f / (h + h);
+
+      // A = A - q x transpose(u) - u x transpose(q), with q = p - K x u
+      for (matrix_size j = 0; j < i; ++j) {
+        f = row[j];
+        g = offDiagonal[j] - hh * f;
+        offDiagonal[j] = g;
+        matrix_real_number* rowJ = matrix + j * size;
+        for (matrix_size k = 0; k <= j; ++k) {
+          rowJ[k] -= f * offDiagonal[k] + g * row[k];
+        }
+      }
+    }
+    diagonal[i] = h;
+  }
+
+  // Accumulates the reflections in Q, from the smallest one
+  diagonal[0] = 0.0;
+  offDiagonal[0] = 0.0;
+  for (matrix_size i = 0; i < size; ++i) {
+    matrix_real_number* row = matrix + i * size;
+    if (computeVectors) {
+      if (diagonal[i] != 0.0) {
+        for (matrix_size j = 0; j < i; ++j) {
+          matrix_real_number g = 0.0;
+          for (matrix_size k = 0; k < i; ++k) {
+            g += row[k] * matrix[coordToIndex(k, j, size)];
+          }
+          for (matrix_size k = 0; k < i; ++k) {
+            matrix[coordToIndex(k, j, size)] -=
+                g * matrix[coordToIndex(k, i, size)];
+          }
+        }
+      }
+      diagonal[i] = row[i];
+      row[i] = 1.0;
+      for (matrix_size j = 0; j < i; ++j) {
+        row[j] = 0.0;
+        matrix[coordToIndex(j, i, size)] = 0.0;
+      }
+    } else {
+      diagonal[i] = row[i];
+    }
+  }
+
+  // offDiagonal[i] becomes the element at (i, i + 1)
+  for (matrix_size i = 1; i < size; ++i) {
+    offDiagonal[i - 1] = offDiagonal[i];
+  }
+  offDiagonal[size - 1] = 0.0;
+}
+
+/**
+ * @brief Sorts the eigenvalues in increasing order, with the columns of the
+ * eigenvectors
+ */
+static void sortEigenPairs(matrix_real_number* eigenValues,
+                           const matrix_size size,
+                           matrix_real_number* eigenVectors) {
+  for (matrix_size i = 0; i + 1 < size; ++i) {
+    matrix_size minIndex = i;
+    for (matrix_size j = i + 1; j < size; ++j) {
+      if (eigenValues[j] < eigenValues[minIndex]) {
+        minIndex = j;
+      }
+    }
+    if (minIndex == i) {
+      continue;
+    }
+
+    const matrix_real_number value = eigenValues[i];
+    eigenValues[i] = eigenValues[minIndex];
+    eigenValues[minIndex] = value;
+    if (eigenVectors != NULL) {
+      for (matrix_size k = 0; k < size; ++k) {
+        matrix_real_number* row = eigenVectors + k * size;
+        const matrix_real_number element = row[i];
+        row[i] = row[minIndex];
+        row[minIndex] = element;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Computes the eigenvalues, and optionally the eigenvectors, of a
+ * symmetric tridiagonal matrix with the QL algorithm with implicit shifts.
+ * Each iteration chases a bulge with Givens rotations from the bottom of the
+ * unreduced block, in O(size) operations, or O(size^2) with the eigenvectors.
+ * @param diagonal the diagonal of size elements. Receives the eigenvalues, in
+ * increasing order
+ * @param offDiagonal the off diagonal of size elements, see symmetric_eigen.h.
+ * Destroyed
+ * @param size the number of rows and columns of the matrix
+ * @param eigenVectors NULL, or a matrix of size * size elements that is
+ * multiplied by the rotations: the identity gives the eigenvectors of the
+ * tridiagonal matrix, and the Q of householderTridiagonalize gives the
+ * eigenvectors of the original matrix. The eigenvectors are the columns
+ * @return 1 if an eigenvalue did not converge in
+ * SYMMETRIC_EIGEN_MAX_ITERATIONS iterations, 0 otherwise
+ */
+int tridiagonalQL(matrix_real_number* diagonal, matrix_real_number* offDiagonal,
+                  const matrix_size size, matrix_real_number* eigenVectors) {
+  if (size == 0) {
+    return 0;
+  }
+  offDiagonal[size - 1] = 0.0;
+
+  for (matrix_size l = 0; l < size; ++l) {
+    unsigned iterations = 0;
+    matrix_size m;
+    do {
+      // Looks for a negligible off diagonal element, which splits the matrix
+      for (m = l; m + 1 < size; ++m) {
+        const matrix_real_number dd = fabs(diagonal[m]) + fabs(diagonal[m + 1]);
+        if (fabs(offDiagonal[m]) <= DBL_EPSILON * dd) {
+          break;
+        }
+      }
+      if (m == l) {
+        break;
+      }
+      if (iterations++ == SYMMETRIC_EIGEN_MAX_ITERATIONS) {
+        return 1;
+      }
+
+      // Wilkinson shift, from the leading 2 x 2 block
+      matrix_real_number g =
+          (diagonal[l + 1] - diagonal[l]) / (2.0 * offDiagonal[l]);
+      matrix_real_number r = hypot(g, 1.0);
+      g = diagonal[m] - diagonal[l] + offDiagonal[l] / (g + copysign(r, g));
+      matrix_real_number s = 1.0;
+      matrix_real_number c = 1.0;
+      matrix_real_number p = 0.0;
+
+      // Rotations from m - 1 down to l, i being signed to stop below l = 0
+      long i;
+      for (i = (long)m - 1; i >= (long)l; --i) {
+        const matrix_real_number f = s * offDiagonal[i];
+        const matrix_real_number b = c * offDiagonal[i];
+        r = hypot(f, g);
+        offDiagonal[i + 1] = r;
+        if (r == 0.0) {
+          // Underflow: deflates and starts again
+          diagonal[i + 1] -= p;
+          offDiagonal[m] = 0.0;
+          break;
+        }
+        s = f / r;
+        c = g / r;
+        g = diagonal[i + 1] - p;
+        r = (diagonal[i] - g) * s + 2.0 * c * b;
+        p = s * r;
+        diagonal[i + 1] = g + p;
+        g = c * r - b;
+
+        if (eigenVectors != NULL) {
+          for (matrix_size k = 0; k < size; ++k) {
+            matrix_real_number* row = eigenVectors + k * size;
+            const matrix_real_number element = row[i + 1];
+            row[i + 1] = s * row[i] + c * element;
+            row[i] = c * row[i] - s * element;
+          }
+        }
+      }
+      if (r == 0.0 && i >= (long)l) {
+        continue;
+      }
+      diagonal[l] -= p;
+      offDiagonal[l] = g;
+      offDiagonal[m] = 0.0;
+    } while (m != l);
+  }
+
+  sortEigenPairs(diagonal, size, eigenVectors);
+  return 0;
+}
+
+/**
+ * @brief Computes the eigenvalues and eigenvectors of a symmetric tridiagonal
+ * matrix stored as a full matrix, such as the T matrix returned by lanczos
+ * @param tMatrix the tridiagonal matrix of size * size elements. Only its
+ * diagonal and the elements above it are read
+ * @param size the number of rows and columns of the matrix
+ * @param eigenValues array of size elements receiving the eigenvalues, in
+ * increasing order
+ * @param eigenVectors NULL, or an array of size * size elements receiving
+ * the eigenvectors, in columns
+ * @return 1 if an eigenvalue did not converge, 0 otherwise
+ */
+int tridiagonalEigen(const matrix_real_number* tMatrix, const matrix_size size,
+                     matrix_real_number* eigenValues,
+                     matrix_real_number* eigenVectors) {
+  matrix_real_number offDiagonal[size + 1];
+  for (matrix_size i = 0; i < size; ++i) {
+    eigenValues[i] = tMatrix[coordToIndex(i, i, size)];
+    offDiagonal[i] = i + 1 < size ? tMatrix[coordToIndex(i, i + 1, size)] : 0.0;
+  }
+  if (eigenVectors != NULL) {
+    createIdentityMatrix(size, eigenVectors);
+  }
+  return tridiagonalQL(eigenValues, offDiagonal, size, eigenVectors);
+}
+
+/**
+ * @brief Computes the eigenvalues and eigenvectors of a dense symmetric
+ * matrix, with householderTridiagonalize followed by tridiagonalQL
+ * @param matrix the symmetric matrix of size * size elements. Only its lower
+ * triangle is read. Receives the eigenvectors, in columns
+ * @param size the number of rows and columns of the matrix
+ * @param eigenValues array of size elements receiving the eigenvalues, in
+ * increasing order
+ * @return 1 if an eigenvalue did not converge, 0 otherwise
+ */
+int symmetricEigen(matrix_real_number* matrix, const matrix_size size,
+                   matrix_real_number* eigenValues) {
+  matrix_real_number offDiagonal[size + 1];
+  householderTridiagonalize(matrix, size, eigenValues, offDiagonal, 1);
+  return tridiagonalQL(eigenValues, offDiagonal, size, matrix);
+}
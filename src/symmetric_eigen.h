@@ -0,0 +1,44 @@
+#ifndef SYMMETRIC_EIGEN_H
+#define SYMMETRIC_EIGEN_H
+
+#include "matrix.h"
+
+// Maximum number of QL iterations for each eigenvalue
+#ifndef SYMMETRIC_EIGEN_MAX_ITERATIONS
+#define SYMMETRIC_EIGEN_MAX_ITERATIONS 30
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Eigenvalues and eigenvectors of dense symmetric matrices, in O(n^3) with a
+ * small constant: the matrix is reduced to a tridiagonal matrix with
+ * Householder reflections, whose eigenpairs are found with the QL algorithm
+ * with implicit shifts.
+ * A tridiagonal matrix is given by its diagonal, of size elements, and by its
+ * off diagonal, also of size elements: offDiagonal[i] is the element at
+ * (i, i + 1) and (i + 1, i), and the last element is only used as work space.
+ * tridiagonalEigen also finishes the T matrix returned by lanczos: the Ritz
+ * vectors are then V x eigenVectors.
+ */
+
+void householderTridiagonalize(matrix_real_number* matrix,
+                               const matrix_size size,
+                               matrix_real_number* diagonal,
+                               matrix_real_number* offDiagonal,
+                               const int computeVectors);
+int tridiagonalQL(matrix_real_number* diagonal, matrix_real_number* offDiagonal,
+                  const matrix_size size, matrix_real_number* eigenVectors);
+int tridiagonalEigen(const matrix_real_number* tMatrix, const matrix_size size,
+                     matrix_real_number* eigenValues,
+                     matrix_real_number* eigenVectors);
+int symmetricEigen(matrix_real_number* matrix, const matrix_size size,
+                   matrix_real_number* eigenValues);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SYMMETRIC_EIGEN_H
@@ -62,10 +62,154 @@ static int knownTestingDFTI(const unsigned length, fft_real* inputReals,
   return returnCode;
 }
 
+static int randomTestingDFTWorkspace(const unsigned length) {
+
+  dft_real reals[length];
+  dft_real imgs[length];
+  dft_real dftReals[length];
+  dft_real dftImgs[length];
+  dft_real workspace[DFT_WORKSPACE_SIZE(length)];
+  for (unsigned i = 0; i < length; ++i) {
+    reals[i] = linear_congruential_random_generator();
+    imgs[i] = linear_congruential_random_generator();
+    dftReals[i] = reals[i];
+    dftImgs[i] = imgs[i];
+  }
+
+  dftWorkspaceInit(length, workspace);
+  DFTWorkspace(length, reals, imgs, 1, workspace);
+  DFT(length, dftReals, dftImgs, 1);
+  int isSimilar = compareFT(length, reals, imgs, dftReals, dftImgs);
+
+  DFTWorkspace(length, reals, imgs, -1, workspace);
+  DFT(length, dftReals, dftImgs, -1);
+  isSimilar |= compareFT(length, reals, imgs, dftReals, dftImgs);
+
+  printf("Random testing DFT with a workspace of length %u: is the DFT "
+         "working as intended? ",
+         length);
+  int returnCode = 0;
+  if (isSimilar == 0) {
+    printf("true\n");
+    returnCode = 0;
+  } else {
+    printf("false\n");
+    returnCode = 1;
+  }
+  return returnCode;
+}
+
+static int randomTestingGoertzel(const unsigned length, const int isReal) {
+
+  dft_real reals[length];
+  dft_real imgs[length];
+  dft_real dftReals[length];
+  dft_real dftImgs[length];
+  for (unsigned i = 0; i < length; ++i) {
+    reals[i] = linear_congruential_random_generator();
+    imgs[i] = isReal ? 0.0 : linear_congruential_random_generator();
+    dftReals[i] = reals[i];
+    dftImgs[i] = imgs[i];
+  }
+  DFT(length, dftReals, dftImgs, 1);
+
+  // First, last, middle and a random bin
+  const unsigned nbBins = 4;
+  const unsigned bins[] = {
+      0, length - 1, length / 2,
+      (unsigned)(linear_congruential_random_generator() * length)};
+  dft_real binReals[nbBins];
+  dft_real binImgs[nbBins];
+  dft_real expectedReals[nbBins];
+  dft_real expectedImgs[nbBins];
+  for (unsigned b = 0; b < nbBins; ++b) {
+    expectedReals[b] = dftReals[bins[b]];
+    expectedImgs[b] = dftImgs[bins[b]];
+  }
+
+  goertzel(length, reals, isReal ? NULL : imgs, nbBins, bins, binReals,
+           binImgs);
+  int isSimilar =
+      compareFT(nbBins, binReals, binImgs, expectedReals, expectedImgs);
+
+  printf("Random testing Goertzel of length %u: is the Goertzel algorithm "
+         "working as intended? ",
+         length);
+  int returnCode = 0;
+  if (isSimilar == 0) {
+    printf("true\n");
+    returnCode = 0;
+  } else {
+    printf("false\n");
+    returnCode = 1;
+  }
+  return returnCode;
+}
+
+static int randomTestingSlidingDFT(const unsigned length) {
+
+  const unsigned nbBins = 3;
+  const unsigned bins[] = {1, length / 3, length - 2};
+  const unsigned nbSamples = 3 * length + 5;
+  dft_real samples[nbSamples];
+  dft_real memory[SLIDING_DFT_MEMORY_SIZE(length, nbBins)];
+  sliding_dft transform;
+
+  int returnCode = slidingDFTInit(&transform, length, nbBins, bins, memory);
+  int isSimilar = 0;
+  for (unsigned n = 0; n < nbSamples; ++n) {
+    samples[n] = linear_congruential_random_generator();
+    slidingDFTPush(&transform, samples[n]);
+
+    // Compare with the DFT of the last length samples after every sample, as
+    // the bins are recomputed at different pushes
+    dft_real reals[length];
+    dft_real imgs[length];
+    for (unsigned i = 0; i < length; ++i) {
+      const int sampleIndex = (int)(n + 1 + i) - (int)length;
+      reals[i] = sampleIndex < 0 ? 0.0 : samples[sampleIndex];
+      imgs[i] = 0.0;
+    }
+    DFT(length, reals, imgs, 1);
+
+    dft_real expectedReals[nbBins];
+    dft_real expectedImgs[nbBins];
+    for (unsigned b = 0; b < nbBins; ++b) {
+      expectedReals[b] = reals[bins[b]];
+      expectedImgs[b] = imgs[bins[b]];
+    }
+    isSimilar |= compareFT(nbBins, transform.binReals, transform.binImgs,
+                           expectedReals, expectedImgs);
+  }
+
+  printf("Random testing sliding DFT of length %u: is the sliding DFT working "
+         "as intended? ",
+         length);
+  if (isSimilar == 0 && returnCode == 0) {
+    printf("true\n");
+    returnCode = 0;
+  } else {
+    printf("false\n");
+    returnCode = 1;
+  }
+  return returnCode;
+}
+
 int main() {
 
+  int seed = time(NULL);
+  printf("seed used : %d\n", seed);
+  set_linear_congruential_generator_seed(seed);
+
   int returnCode = 0;
 
+  returnCode |= randomTestingDFTWorkspace(45);
+  returnCode |= randomTestingDFTWorkspace(64);
+  returnCode |= randomTestingGoertzel(64, 1);
+  returnCode |= randomTestingGoertzel(45, 0);
+  returnCode |= randomTestingSlidingDFT(32);
+  returnCode |= randomTestingSlidingDFT(27);
+
   const unsigned length = 4;
   fft_real DFTinputReals[] = {8, 4, 8, 0};
   fft_real DFTinputImgs[] = {0, 0, 0, 0};
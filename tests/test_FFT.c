@@ -103,6 +103,229 @@ static int randomTestingFFTI(const unsigned maxLengthPower) {
   return returnCode;
 }
 
+static int randomTestingFFTPlan(const unsigned maxLengthPower,
+                                const unsigned radix) {
+
+  const unsigned length = (unsigned)pow(
+      2, (unsigned)(linear_congruential_random_generator() * maxLengthPower));
+
+  // allocate arrays for testing
+  fft_real reals[length];
+  fft_real imgs[length];
+  fft_real fftReals[length];
+  fft_real fftImgs[length];
+  fft_real dftReals[length];
+  fft_real dftImgs[length];
+
+  for (unsigned i = 0; i < length; ++i) {
+    reals[i] = linear_congruential_random_generator();
+    imgs[i] = linear_congruential_random_generator();
+    fftReals[i] = reals[i];
+    fftImgs[i] = imgs[i];
+    dftReals[i] = reals[i];
+    dftImgs[i] = imgs[i];
+  }
+
+  fft_plan* plan = fftPlanCreate(length);
+  if (plan == NULL) {
+    printf("Random testing FFT plan: could not create the plan\n");
+    return 1;
+  }
+  plan->radix = radix;
+
+  // The same plan is used in both directions
+  fftPlanExecute(plan, fftReals, fftImgs, 1);
+  DFT(length, dftReals, dftImgs, 1);
+  int isSimilar = compareFT(length, fftReals, fftImgs, dftReals, dftImgs);
+
+  fftPlanExecute(plan, fftReals, fftImgs, -1);
+  isSimilar |= compareFT(length, fftReals, fftImgs, reals, imgs);
+
+  fftPlanDestroy(plan);
+
+  printf("Random testing FFT plan with radix %u: is the FFT working as "
+         "intended? ",
+         radix);
+  int returnCode = 0;
+  if (isSimilar == 0) {
+    printf("true\n");
+    returnCode = 0;
+  } else {
+    printf("false\n");
+    returnCode = 1;
+  }
+  return returnCode;
+}
+
+static int randomTestingRFFT(const unsigned maxLengthPower) {
+
+  const unsigned length =
+      2 * (unsigned)pow(2, (unsigned)(linear_congruential_random_generator() *
+                                      maxLengthPower));
+  const unsigned nbBins = length / 2 + 1;
+
+  // allocate arrays for testing
+  fft_real input[length];
+  fft_real output[length];
+  fft_real rfftReals[nbBins];
+  fft_real rfftImgs[nbBins];
+  fft_real planReals[nbBins];
+  fft_real planImgs[nbBins];
+  fft_real dftReals[length];
+  fft_real dftImgs[length];
+
+  for (unsigned i = 0; i < length; ++i) {
+    input[i] = linear_congruential_random_generator();
+    dftReals[i] = input[i];
+    dftImgs[i] = 0;
+  }
+
+  fft_plan* plan = fftPlanCreate(length);
+  if (plan == NULL) {
+    printf("Random testing RFFT: could not create the plan\n");
+    return 1;
+  }
+
+  // Only the first half of the DFT is returned by the real FFT
+  DFT(length, dftReals, dftImgs, 1);
+  RFFT(length, input, rfftReals, rfftImgs);
+  fftPlanExecuteReal(plan, input, planReals, planImgs);
+  int isSimilar = compareFT(nbBins, rfftReals, rfftImgs, dftReals, dftImgs);
+  isSimilar |= compareFT(nbBins, planReals, planImgs, dftReals, dftImgs);
+
+  // The inverse transforms must give back the input
+  IRFFT(length, rfftReals, rfftImgs, output);
+  isSimilar |= compareFT(length, output, dftImgs, input, dftImgs);
+  fftPlanExecuteRealInverse(plan, planReals, planImgs, output);
+  isSimilar |= compareFT(length, output, dftImgs, input, dftImgs);
+
+  fftPlanDestroy(plan);
+
+  printf("Random testing RFFT: is the RFFT working as intended? ");
+  int returnCode = 0;
+  if (isSimilar == 0) {
+    printf("true\n");
+    returnCode = 0;
+  } else {
+    printf("false\n");
+    returnCode = 1;
+  }
+  return returnCode;
+}
+
+static int randomTestingFFTAnyLength(const unsigned maxLength) {
+
+  // Any length, which will mostly use the mixed-radix and Bluestein paths
+  const unsigned length =
+      1 + (unsigned)(linear_congruential_random_generator() * maxLength);
+
+  // allocate arrays for testing
+  fft_real reals[length];
+  fft_real imgs[length];
+  fft_real fftReals[length];
+  fft_real fftImgs[length];
+  fft_real dftReals[length];
+  fft_real dftImgs[length];
+
+  for (unsigned i = 0; i < length; ++i) {
+    reals[i] = linear_congruential_random_generator();
+    imgs[i] = linear_congruential_random_generator();
+    fftReals[i] = reals[i];
+    fftImgs[i] = imgs[i];
+    dftReals[i] = reals[i];
+    dftImgs[i] = imgs[i];
+  }
+
+  int returnCode = FFT(length, fftReals, fftImgs, 1);
+  DFT(length, dftReals, dftImgs, 1);
+  int isSimilar = compareFT(length, fftReals, fftImgs, dftReals, dftImgs);
+
+  returnCode |= FFT(length, fftReals, fftImgs, -1);
+  isSimilar |= compareFT(length, fftReals, fftImgs, reals, imgs);
+
+  printf("Random testing FFT of length %u: is the FFT working as intended? ",
+         length);
+  if (isSimilar == 0 && returnCode == 0) {
+    printf("true\n");
+    returnCode = 0;
+  } else {
+    printf("false\n");
+    returnCode = 1;
+  }
+  return returnCode;
+}
+
+static int randomTestingFFTBatch(const unsigned length, const unsigned count) {
+
+  // The vectors are the columns of a length x count row-major matrix, which is
+  // also the layout of count interleaved channels
+  const unsigned size = length * count;
+  fft_real reals[size];
+  fft_real imgs[size];
+  fft_real batchReals[size];
+  fft_real batchImgs[size];
+  fft_real expectedReals[size];
+  fft_real expectedImgs[size];
+
+  for (unsigned i = 0; i < size; ++i) {
+    reals[i] = linear_congruential_random_generator();
+    imgs[i] = linear_congruential_random_generator();
+    batchReals[i] = reals[i];
+    batchImgs[i] = imgs[i];
+  }
+
+  // Expected result, one vector at a time
+  fft_real vectorReals[length];
+  fft_real vectorImgs[length];
+  for (unsigned b = 0; b < count; ++b) {
+    for (unsigned i = 0; i < length; ++i) {
+      vectorReals[i] = reals[i * count + b];
+      vectorImgs[i] = imgs[i * count + b];
+    }
+    FFT(length, vectorReals, vectorImgs, 1);
+    for (unsigned i = 0; i < length; ++i) {
+      expectedReals[i * count + b] = vectorReals[i];
+      expectedImgs[i * count + b] = vectorImgs[i];
+    }
+  }
+
+  fft_plan* plan = fftPlanCreate(length);
+  int returnCode = fftPlanExecuteBatch(plan, batchReals, batchImgs, count,
+                                       count, 1, 1);
+  int isSimilar =
+      compareFT(size, batchReals, batchImgs, expectedReals, expectedImgs);
+
+  returnCode |= fftPlanExecuteBatch(plan, batchReals, batchImgs, count, count,
+                                    1, -1);
+  isSimilar |= compareFT(size, batchReals, batchImgs, reals, imgs);
+
+  // The same matrix read as count contiguous vectors
+  returnCode |= fftPlanExecuteBatch(plan, batchReals, batchImgs, count, 1,
+                                    length, 1);
+  for (unsigned b = 0; b < count; ++b) {
+    for (unsigned i = 0; i < length; ++i) {
+      vectorReals[i] = reals[b * length + i];
+      vectorImgs[i] = imgs[b * length + i];
+    }
+    FFT(length, vectorReals, vectorImgs, 1);
+    isSimilar |= compareFT(length, batchReals + b * length,
+                           batchImgs + b * length, vectorReals, vectorImgs);
+  }
+  fftPlanDestroy(plan);
+
+  printf("Random testing batched FFT of length %u: is the FFT working as "
+         "intended? ",
+         length);
+  if (isSimilar == 0 && returnCode == 0) {
+    printf("true\n");
+    returnCode = 0;
+  } else {
+    printf("false\n");
+    returnCode = 1;
+  }
+  return returnCode;
+}
+
 static int knownTestingFFT(const unsigned length, fft_real* inputReals,
                            fft_real* inputImaginaries, fft_real* expectedReals,
                            fft_real* expectedImaginaries) {
@@ -156,6 +379,20 @@ int main() {
   const unsigned randomLengthPower = 8;
   returnCode |= randomTestingFFT(randomLengthPower);
   returnCode |= randomTestingFFTI(randomLengthPower);
+  returnCode |= randomTestingFFTPlan(randomLengthPower, 2);
+  returnCode |= randomTestingFFTPlan(randomLengthPower, 4);
+  returnCode |= randomTestingRFFT(randomLengthPower);
+
+  // Lengths that are not a power of 2
+  const unsigned randomMaxLength = 300;
+  for (unsigned i = 0; i < 4; ++i) {
+    returnCode |= randomTestingFFTAnyLength(randomMaxLength);
+  }
+
+  // Batches of strided vectors, with power of 2 and mixed-radix plans
+  returnCode |= randomTestingFFTBatch(64, 5);
+  returnCode |= randomTestingFFTBatch(128, 3);
+  returnCode |= randomTestingFFTBatch(60, 7);
 
   const unsigned length = 4;
   fft_real FFTinputReals[] = {8, 4, 8, 0};
@@ -0,0 +1,165 @@
+#include <1chipml.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static int compareMatrices(const unsigned size, const fft_real* reals1,
+                           const fft_real* imgs1, const fft_real* reals2,
+                           const fft_real* imgs2) {
+
+  const fft_real epsilon = 1e-9;
+
+  for (unsigned i = 0; i < size; ++i) {
+    if (fabs(reals1[i] - reals2[i]) > epsilon ||
+        fabs(imgs1[i] - imgs2[i]) > epsilon) {
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Computes the 2D DFT of a row-major matrix, one row and one column at
+ * a time
+ */
+static void DFT2D(const unsigned height, const unsigned width, fft_real* reals,
+                  fft_real* imgs) {
+
+  for (unsigned i = 0; i < height; ++i) {
+    DFT(width, reals + i * width, imgs + i * width, 1);
+  }
+
+  fft_real columnReals[height];
+  fft_real columnImgs[height];
+  for (unsigned j = 0; j < width; ++j) {
+    for (unsigned i = 0; i < height; ++i) {
+      columnReals[i] = reals[i * width + j];
+      columnImgs[i] = imgs[i * width + j];
+    }
+    DFT(height, columnReals, columnImgs, 1);
+    for (unsigned i = 0; i < height; ++i) {
+      reals[i * width + j] = columnReals[i];
+      imgs[i * width + j] = columnImgs[i];
+    }
+  }
+}
+
+static int randomTestingFFT2D(const unsigned height, const unsigned width) {
+
+  const unsigned size = height * width;
+  fft_real reals[size];
+  fft_real imgs[size];
+  fft_real fftReals[size];
+  fft_real fftImgs[size];
+  fft_real dftReals[size];
+  fft_real dftImgs[size];
+
+  for (unsigned i = 0; i < size; ++i) {
+    reals[i] = linear_congruential_random_generator();
+    imgs[i] = linear_congruential_random_generator();
+    fftReals[i] = reals[i];
+    fftImgs[i] = imgs[i];
+    dftReals[i] = reals[i];
+    dftImgs[i] = imgs[i];
+  }
+
+  int returnCode = FFT2D(height, width, fftReals, fftImgs, 1);
+  DFT2D(height, width, dftReals, dftImgs);
+  int isSimilar = compareMatrices(size, fftReals, fftImgs, dftReals, dftImgs);
+
+  returnCode |= FFT2D(height, width, fftReals, fftImgs, -1);
+  isSimilar |= compareMatrices(size, fftReals, fftImgs, reals, imgs);
+
+  printf("Random testing FFT2D of size %ux%u: is the FFT2D working as "
+         "intended? ",
+         height, width);
+  if (isSimilar == 0 && returnCode == 0) {
+    printf("true\n");
+    returnCode = 0;
+  } else {
+    printf("false\n");
+    returnCode = 1;
+  }
+  return returnCode;
+}
+
+static int randomTestingConvolve2D(const unsigned imageHeight,
+                                   const unsigned imageWidth,
+                                   const unsigned kernelHeight,
+                                   const unsigned kernelWidth,
+                                   const unsigned tileSize) {
+
+  const unsigned imageSize = imageHeight * imageWidth;
+  fft_real image[imageSize];
+  fft_real kernel[kernelHeight * kernelWidth];
+  fft_real output[imageSize];
+  fft_real expected[imageSize];
+  fft_real zeros[imageSize];
+
+  for (unsigned i = 0; i < imageSize; ++i) {
+    image[i] = linear_congruential_random_generator();
+    zeros[i] = 0.0;
+  }
+  for (unsigned i = 0; i < kernelHeight * kernelWidth; ++i) {
+    kernel[i] = linear_congruential_random_generator();
+  }
+
+  // Direct convolution, with the kernel centered on each pixel
+  const int centerRow = kernelHeight / 2;
+  const int centerColumn = kernelWidth / 2;
+  for (int i = 0; i < (int)imageHeight; ++i) {
+    for (int j = 0; j < (int)imageWidth; ++j) {
+      fft_real sum = 0.0;
+      for (int m = 0; m < (int)kernelHeight; ++m) {
+        for (int n = 0; n < (int)kernelWidth; ++n) {
+          const int row = i + centerRow - m;
+          const int column = j + centerColumn - n;
+          if (row >= 0 && row < (int)imageHeight && column >= 0 &&
+              column < (int)imageWidth) {
+            sum +=
+                kernel[m * kernelWidth + n] * image[row * imageWidth + column];
+          }
+        }
+      }
+      expected[i * imageWidth + j] = sum;
+    }
+  }
+
+  int returnCode = fftConvolve2D(imageHeight, imageWidth, image, kernelHeight,
+                                 kernelWidth, kernel, tileSize, output);
+  int isSimilar = compareMatrices(imageSize, output, zeros, expected, zeros);
+
+  printf("Random testing fftConvolve2D with tiles of %u: is the convolution "
+         "working as intended? ",
+         tileSize);
+  if (isSimilar == 0 && returnCode == 0) {
+    printf("true\n");
+    returnCode = 0;
+  } else {
+    printf("false\n");
+    returnCode = 1;
+  }
+  return returnCode;
+}
+
+int main() {
+
+  int seed = time(NULL);
+  printf("seed used : %d\n", seed);
+  set_linear_congruential_generator_seed(seed);
+
+  int returnCode = 0;
+
+  returnCode |= randomTestingFFT2D(16, 32);
+  returnCode |= randomTestingFFT2D(45, 37);
+  returnCode |= randomTestingFFT2D(1, 8);
+
+  // Whole image, then tiles that do not divide the image
+  returnCode |= randomTestingConvolve2D(23, 31, 5, 4, 0);
+  returnCode |= randomTestingConvolve2D(23, 31, 5, 4, 7);
+  returnCode |= randomTestingConvolve2D(40, 40, 9, 9, 16);
+
+  return returnCode;
+}
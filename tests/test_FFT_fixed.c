@@ -0,0 +1,172 @@
+#include <1chipml.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Minimal signal-to-noise ratios, in dB, of the fixed-point FFTs against the
+// double FFT
+#define MIN_SNR_Q15 55.0
+#define MIN_SNR_Q31 120.0
+
+/**
+ * @brief Computes the signal-to-noise ratio of a result against the expected
+ * one, in dB
+ */
+static double computeSNR(const unsigned length, const fft_real* expectedReals,
+                         const fft_real* expectedImgs, const fft_real* reals,
+                         const fft_real* imgs) {
+  double signal = 0.0;
+  double noise = 0.0;
+  for (unsigned i = 0; i < length; ++i) {
+    const double realError = reals[i] - expectedReals[i];
+    const double imaginaryError = imgs[i] - expectedImgs[i];
+    signal += expectedReals[i] * expectedReals[i] +
+              expectedImgs[i] * expectedImgs[i];
+    noise += realError * realError + imaginaryError * imaginaryError;
+  }
+  return noise > 0.0 ? 10.0 * log10(signal / noise) : INFINITY;
+}
+
+static int randomTestingFFTQ15(const unsigned length) {
+
+  fft_q15 reals[length];
+  fft_q15 imgs[length];
+  fft_q15 twiddleReals[length / 2];
+  fft_q15 twiddleImgs[length / 2];
+  fft_real expectedReals[length];
+  fft_real expectedImgs[length];
+  fft_real resultReals[length];
+  fft_real resultImgs[length];
+
+  // Random values in [-0.5, 0.5), whose exact values are given to the FFT
+  for (unsigned i = 0; i < length; ++i) {
+    reals[i] =
+        (fft_q15)((linear_congruential_random_generator() - 0.5) * 32768.0);
+    imgs[i] =
+        (fft_q15)((linear_congruential_random_generator() - 0.5) * 32768.0);
+    expectedReals[i] = ldexp(reals[i], -15);
+    expectedImgs[i] = ldexp(imgs[i], -15);
+  }
+
+  int exponent = 0;
+  int returnCode = fftQ15Twiddles(length, twiddleReals, twiddleImgs);
+  returnCode |= fftQ15(length, reals, imgs, twiddleReals, twiddleImgs, 1,
+                       &exponent);
+  FFT(length, expectedReals, expectedImgs, 1);
+
+  for (unsigned i = 0; i < length; ++i) {
+    resultReals[i] = ldexp(reals[i], exponent - 15);
+    resultImgs[i] = ldexp(imgs[i], exponent - 15);
+  }
+  const double snr =
+      computeSNR(length, expectedReals, expectedImgs, resultReals, resultImgs);
+
+  printf("Random testing Q15 FFT of length %u: SNR of %.1f dB, exponent %d. "
+         "Is the FFT working as intended? ",
+         length, snr, exponent);
+  if (snr >= MIN_SNR_Q15 && returnCode == 0) {
+    printf("true\n");
+    returnCode = 0;
+  } else {
+    printf("false\n");
+    returnCode = 1;
+  }
+  return returnCode;
+}
+
+static int randomTestingFFTQ31(const unsigned length) {
+
+  fft_q31 reals[length];
+  fft_q31 imgs[length];
+  fft_q31 twiddleReals[length / 2];
+  fft_q31 twiddleImgs[length / 2];
+  fft_real expectedReals[length];
+  fft_real expectedImgs[length];
+  fft_real resultReals[length];
+  fft_real resultImgs[length];
+
+  // Random values in [-0.5, 0.5), whose exact values are given to the FFT
+  for (unsigned i = 0; i < length; ++i) {
+    reals[i] = (fft_q31)ldexp(linear_congruential_random_generator() - 0.5, 31);
+    imgs[i] = (fft_q31)ldexp(linear_congruential_random_generator() - 0.5, 31);
+    expectedReals[i] = ldexp(reals[i], -31);
+    expectedImgs[i] = ldexp(imgs[i], -31);
+  }
+
+  int exponent = 0;
+  int returnCode = fftQ31Twiddles(length, twiddleReals, twiddleImgs);
+  returnCode |= fftQ31(length, reals, imgs, twiddleReals, twiddleImgs, 1,
+                       &exponent);
+  FFT(length, expectedReals, expectedImgs, 1);
+
+  for (unsigned i = 0; i < length; ++i) {
+    resultReals[i] = ldexp(reals[i], exponent - 31);
+    resultImgs[i] = ldexp(imgs[i], exponent - 31);
+  }
+  const double snr =
+      computeSNR(length, expectedReals, expectedImgs, resultReals, resultImgs);
+
+  printf("Random testing Q31 FFT of length %u: SNR of %.1f dB, exponent %d. "
+         "Is the FFT working as intended? ",
+         length, snr, exponent);
+  if (snr >= MIN_SNR_Q31 && returnCode == 0) {
+    printf("true\n");
+    returnCode = 0;
+  } else {
+    printf("false\n");
+    returnCode = 1;
+  }
+  return returnCode;
+}
+
+static int knownTestingFFTQ15() {
+
+  // The inverse FFT of {20, 0, 12, 0} + i * {0, -4, 0, 4} is {8, 4, 8, 0}
+  const unsigned length = 4;
+  fft_q15 reals[] = {20 << 8, 0, 12 << 8, 0};
+  fft_q15 imgs[] = {0, -(4 << 8), 0, 4 << 8};
+  const fft_real expectedReals[] = {8, 4, 8, 0};
+  fft_q15 twiddleReals[2];
+  fft_q15 twiddleImgs[2];
+
+  int exponent = 0;
+  int returnCode = fftQ15Twiddles(length, twiddleReals, twiddleImgs);
+  returnCode |= fftQ15(length, reals, imgs, twiddleReals, twiddleImgs, -1,
+                       &exponent);
+
+  int isSimilar = 0;
+  for (unsigned i = 0; i < length; ++i) {
+    if (fabs(ldexp(reals[i], exponent - 8) - expectedReals[i]) > 1e-2 ||
+        fabs(ldexp(imgs[i], exponent - 8)) > 1e-2) {
+      isSimilar = 1;
+    }
+  }
+
+  printf("Known testing inverse Q15 FFT: is the FFT working as intended? ");
+  if (isSimilar == 0 && returnCode == 0) {
+    printf("true\n");
+    returnCode = 0;
+  } else {
+    printf("false\n");
+    returnCode = 1;
+  }
+  return returnCode;
+}
+
+int main() {
+
+  int seed = time(NULL);
+  printf("seed used : %d\n", seed);
+  set_linear_congruential_generator_seed(seed);
+
+  int returnCode = 0;
+
+  for (unsigned length = 16; length <= 1024; length <<= 2) {
+    returnCode |= randomTestingFFTQ15(length);
+    returnCode |= randomTestingFFTQ31(length);
+  }
+  returnCode |= knownTestingFFTQ15();
+
+  return returnCode;
+}
@@ -0,0 +1,148 @@
+#include <1chipml.h>
+#include <math.h>
+#include <stdio.h>
+
+#define NB_SAMPLES 200000
+
+// Max errors allowed for degrees 1, 2, 3, 5 and 7. About twice the measured
+// ones.
+static const int degrees[] = {1, 2, 3, 5, 7};
+static const double maxExpErrors[] = {1.5e-5, 1.5e-8, 1.5e-4, 1.5e-7, 1e-10};
+static const double maxLogErrors[] = {6e-5, 3e-7, 8e-6, 4e-8, 3e-10};
+static const double maxSqrtErrors[] = {2e-3, 2e-3, 3e-6, 4e-12, 1e-15};
+static const double maxAtan2Errors[] = {3e-4, 3e-4, 3e-4, 8e-6, 3e-7};
+
+/**
+ * @brief Prints the result of a test
+ * @return 1 if the error is above the max error, 0 otherwise
+ */
+static int printResult(const char* title, const int degree, const double error,
+                       const double maxError) {
+  printf("Testing %s with degree %d: max error of %.2e. Is the error "
+         "expected? ",
+         title, degree, error);
+  if (error <= maxError) {
+    printf("true\n");
+    return 0;
+  }
+  printf("false\n");
+  return 1;
+}
+
+/**
+ * @brief Max relative error of fastExp on [-700, 700]
+ */
+static double getExpError(const int degree) {
+  double maxError = 0.0;
+  for (int i = 0; i <= NB_SAMPLES; ++i) {
+    const double x = -700.0 + 1400.0 * i / NB_SAMPLES;
+    const double expected = exp(x);
+    maxError = fmax(maxError, fabs(fastExp(x, degree) - expected) / expected);
+  }
+  return maxError;
+}
+
+/**
+ * @brief Max absolute error of fastLog, on values from 1e-30 to 1e30, and max
+ * error of fastLog10 scaled by ln(10)
+ */
+static double getLogError(const int degree) {
+  double maxError = 0.0;
+  for (int i = 0; i <= NB_SAMPLES; ++i) {
+    const double x = pow(10.0, -30.0 + 60.0 * i / NB_SAMPLES);
+    maxError = fmax(maxError, fabs(fastLog(x, degree) - log(x)));
+    maxError =
+        fmax(maxError, fabs(fastLog10(x, degree) - log10(x)) * log(10.0));
+  }
+  return maxError;
+}
+
+/**
+ * @brief Max relative error of fastSqrt, on values from 1e-30 to 1e30
+ */
+static double getSqrtError(const int degree) {
+  double maxError = 0.0;
+  for (int i = 0; i <= NB_SAMPLES; ++i) {
+    const double x = pow(10.0, -30.0 + 60.0 * i / NB_SAMPLES);
+    const double expected = sqrt(x);
+    maxError = fmax(maxError, fabs(fastSqrt(x, degree) - expected) / expected);
+  }
+  return maxError;
+}
+
+/**
+ * @brief Max absolute error of fastAtan2, on points around the origin in every
+ * quadrant
+ */
+static double getAtan2Error(const int degree) {
+  double maxError = 0.0;
+  for (int i = 0; i <= NB_SAMPLES; ++i) {
+    const double angle = -M_PI + 2.0 * M_PI * i / NB_SAMPLES;
+    const double radius = 1e-3 + i % 100;
+    const double x = radius * cos(angle);
+    const double y = radius * sin(angle);
+    maxError = fmax(maxError, fabs(fastAtan2(y, x, degree) - atan2(y, x)));
+  }
+  return maxError;
+}
+
+/**
+ * @brief Checks fastPow against pow, with the error bound given by the errors
+ * of fastExp and fastLog
+ */
+static int testPow() {
+  int returnCode = 0;
+  for (unsigned d = 0; d < sizeof(degrees) / sizeof(degrees[0]); ++d) {
+    double maxError = 0.0;
+    for (int i = 1; i <= 1000; ++i) {
+      const double x = 0.05 * i;
+      const double y = -3.0 + 0.0061 * i;
+      const double expected = pow(x, y);
+      const double bound = maxExpErrors[d] + fabs(y) * maxLogErrors[d];
+      maxError = fmax(maxError,
+                      fabs(fastPow(x, y, degrees[d]) - expected) / expected /
+                          bound);
+    }
+    returnCode |= printResult("fastPow (error over bound)", degrees[d],
+                              maxError, 1.0);
+  }
+
+  // Negative bases go through libm
+  printf("Testing fastPow with a negative base: is the result expected? ");
+  if (fastPow(-2.0, 3.0, 7) == -8.0) {
+    printf("true\n");
+  } else {
+    printf("false\n");
+    returnCode = 1;
+  }
+  return returnCode;
+}
+
+int main() {
+
+  int returnCode = 0;
+  for (unsigned d = 0; d < sizeof(degrees) / sizeof(degrees[0]); ++d) {
+    const int degree = degrees[d];
+    returnCode |= printResult("fastExp (relative)", degree,
+                              getExpError(degree), maxExpErrors[d]);
+    returnCode |= printResult("fastLog and fastLog10", degree,
+                              getLogError(degree), maxLogErrors[d]);
+    returnCode |= printResult("fastSqrt (relative)", degree,
+                              getSqrtError(degree), maxSqrtErrors[d]);
+    returnCode |= printResult("fastAtan2", degree, getAtan2Error(degree),
+                              maxAtan2Errors[d]);
+  }
+  returnCode |= testPow();
+
+  // Limits
+  printf("Testing the limits of fastExp: are the results expected? ");
+  if (fastExp(1e6, 7) == INFINITY && fastExp(-1e6, 7) == 0.0 &&
+      fastExp(1e6, 1) == INFINITY && fastExp(-1e6, 1) == 0.0) {
+    printf("true\n");
+  } else {
+    printf("false\n");
+    returnCode = 1;
+  }
+
+  return returnCode;
+}
@@ -1,5 +1,14 @@
 #include <1chipml.h>
 
+// Average errors expected from the lookup table, from the angle between two
+// elements and the resolution of the elements. The nearest element is off by
+// a quarter of a step on average, times the mean slope 2 / pi, and the linear
+// interpolation by step^2 / 8 at most.
+#define TABLE_STEP (M_PI / 2.0 / FAST_SINCOS_QUADRANT_SIZE)
+#define TABLE_RESOLUTION ldexp(1.0, -FAST_SINCOS_TABLE_BITS)
+#define LOOKUP_ERROR (TABLE_STEP / 4.0 + TABLE_RESOLUTION)
+#define INTERPOLATION_ERROR (TABLE_STEP * TABLE_STEP / 8.0 + TABLE_RESOLUTION)
+
 static double getFastSinError(int lowerBound, int upperBound, int step,
                               double multFactor, int degree, int verbose);
 static double getFastCosError(int lowerBound, int upperBound, int step,
@@ -12,6 +21,13 @@ getGenericError(int lowerBound, int upperBound, int step, double multFactor,
 static double getFixedError(char* title, double (*actualFunc)(double),
                             fast_sincos_real (*approxFunc)(uint32_t),
                             int verbose);
+static double getArrayError(int lowerBound, int upperBound, double multFactor,
+                            int degree, int verbose);
+static int isSinCosSame(int lowerBound, int upperBound, double multFactor,
+                        int degree);
+static int isFixedSinCosSame();
+static double getFixedQError(int verbose);
+static int isFixedQSinCosSame();
 
 int main() {
   const int verbose = 0;
@@ -19,9 +35,16 @@ int main() {
   int isErrorExpected = 1;
 
   printf("Fixed point: \n");
-  isErrorExpected &= getFixedError("sine", sin, fastFixedSin, verbose) < 9e-05;
   isErrorExpected &=
-      getFixedError("cosine", cos, fastFixedCos, verbose) < 9e-05;
+      getFixedError("sine", sin, fastFixedSin, verbose) < INTERPOLATION_ERROR;
+  isErrorExpected &=
+      getFixedError("cosine", cos, fastFixedCos, verbose) < INTERPOLATION_ERROR;
+  printf("Is error expected? %d\n", isErrorExpected);
+
+  // The Q1.15 and Q1.31 results are within a unit of the real ones, in
+  // their own resolution
+  printf("Fixed point to Q1.15 and Q1.31: \n");
+  isErrorExpected &= getFixedQError(verbose) < 1e-15;
   printf("Is error expected? %d\n", isErrorExpected);
 
   int lowerBound = -100;
@@ -33,9 +56,9 @@ int main() {
   printf("Floating point: \n");
   printf("Sine \n");
   isErrorExpected &= getFastSinError(lowerBound, upperBound, step, multFactor,
-                                     1, verbose) < 9e-03;
+                                     1, verbose) < LOOKUP_ERROR;
   isErrorExpected &= getFastSinError(lowerBound, upperBound, step, multFactor,
-                                     2, verbose) < 9e-05;
+                                     2, verbose) < INTERPOLATION_ERROR;
   isErrorExpected &= getFastSinError(lowerBound, upperBound, step, multFactor,
                                      3, verbose) < 9e-05;
   isErrorExpected &= getFastSinError(lowerBound, upperBound, step, multFactor,
@@ -45,9 +68,9 @@ int main() {
   printf("Is error expected? %d\n", isErrorExpected);
   printf("Cosine \n");
   isErrorExpected &= getFastCosError(lowerBound, upperBound, step, multFactor,
-                                     1, verbose) < 9e-03;
+                                     1, verbose) < LOOKUP_ERROR;
   isErrorExpected &= getFastCosError(lowerBound, upperBound, step, multFactor,
-                                     2, verbose) < 9e-05;
+                                     2, verbose) < INTERPOLATION_ERROR;
   isErrorExpected &= getFastCosError(lowerBound, upperBound, step, multFactor,
                                      3, verbose) < 9e-05;
   isErrorExpected &= getFastCosError(lowerBound, upperBound, step, multFactor,
@@ -55,8 +78,34 @@ int main() {
   isErrorExpected &= getFastCosError(lowerBound, upperBound, step, multFactor,
                                      7, verbose) < 9e-08;
   printf("Is error expected? %d\n", isErrorExpected);
+  printf("Arrays \n");
+  isErrorExpected &=
+      getArrayError(lowerBound, upperBound, multFactor, 1, verbose) <
+      LOOKUP_ERROR;
+  isErrorExpected &=
+      getArrayError(lowerBound, upperBound, multFactor, 2, verbose) <
+      INTERPOLATION_ERROR;
+  isErrorExpected &=
+      getArrayError(lowerBound, upperBound, multFactor, 3, verbose) < 9e-05;
+  isErrorExpected &=
+      getArrayError(lowerBound, upperBound, multFactor, 5, verbose) < 9e-07;
+  isErrorExpected &=
+      getArrayError(lowerBound, upperBound, multFactor, 7, verbose) < 9e-08;
+
+  // Large angles, far from the first quadrant
+  isErrorExpected &= getArrayError(-50000, 50000, 7.3, 7, verbose) < 9e-08;
+  printf("Is error expected? %d\n", isErrorExpected);
+
+  // The fused functions must give the same results as the separate ones
+  int isSame = isFixedSinCosSame() && isFixedQSinCosSame();
+  for (int degree = 1; degree <= 7; ++degree) {
+    isSame &= isSinCosSame(-1000, 1000, 0.0123, degree);
+  }
+  printf("Are fastSinCos and fastFixedSinCos the same as the separate "
+         "functions? %d\n",
+         isSame);
 
-  return isErrorExpected ? 0 : 1;
+  return isErrorExpected && isSame ? 0 : 1;
 }
 
 static double getFastSinError(int lowerBound, int upperBound, int step,
@@ -129,9 +178,10 @@ static double getFixedError(char* title, double (*actualFunc)(double),
 
   double maxAbsoluteError = 0.0;
   double avgAbsoluteError = 0.0;
+  unsigned nbAngles = 0;
 
   const uint32_t upperBound = FIXED_2_PI;
-  for (uint32_t i = 0; i < upperBound; i += 20) {
+  for (uint32_t i = 0; i < upperBound; i += 20, ++nbAngles) {
     double actualInput = (double)i * (2.0 * M_PI) / FIXED_2_PI;
 
     double actual = actualFunc(actualInput);
@@ -142,7 +192,7 @@ static double getFixedError(char* title, double (*actualFunc)(double),
     maxAbsoluteError = fmax(maxAbsoluteError, absoluteError);
   }
 
-  avgAbsoluteError /= (double)upperBound;
+  avgAbsoluteError /= nbAngles;
 
   if (verbose) {
     printf("Fixed %s error:\n", title);
@@ -152,3 +202,130 @@ static double getFixedError(char* title, double (*actualFunc)(double),
 
   return avgAbsoluteError;
 }
+
+static double getArrayError(int lowerBound, int upperBound, double multFactor,
+                            int degree, int verbose) {
+
+  // An odd number of angles, to go through the end of the vectorized loops
+  const unsigned length = upperBound - lowerBound + 1;
+  fast_sincos_real* angles = malloc(length * sizeof(fast_sincos_real));
+  fast_sincos_real* sines = malloc(length * sizeof(fast_sincos_real));
+  fast_sincos_real* cosines = malloc(length * sizeof(fast_sincos_real));
+  fast_sincos_real* sinesOnly = malloc(length * sizeof(fast_sincos_real));
+  fast_sincos_real* cosinesOnly = malloc(length * sizeof(fast_sincos_real));
+  if (angles == NULL || sines == NULL || cosines == NULL ||
+      sinesOnly == NULL || cosinesOnly == NULL) {
+    free(angles);
+    free(sines);
+    free(cosines);
+    free(sinesOnly);
+    free(cosinesOnly);
+    return INFINITY;
+  }
+
+  for (unsigned i = 0; i < length; ++i) {
+    angles[i] = (lowerBound + (int)i) * multFactor;
+  }
+  fastSinCosArray(length, angles, sines, cosines, degree);
+  fastSinArray(length, angles, sinesOnly, degree);
+  fastCosArray(length, angles, cosinesOnly, degree);
+
+  double maxAbsoluteError = 0.0;
+  double avgAbsoluteError = 0.0;
+  int isSame = 1;
+  for (unsigned i = 0; i < length; ++i) {
+    const double sineError = fabs(sin(angles[i]) - sines[i]);
+    const double cosineError = fabs(cos(angles[i]) - cosines[i]);
+    avgAbsoluteError += 0.5 * (sineError + cosineError);
+    maxAbsoluteError = fmax(maxAbsoluteError, fmax(sineError, cosineError));
+    isSame &= sines[i] == sinesOnly[i] && cosines[i] == cosinesOnly[i];
+  }
+  avgAbsoluteError /= length;
+
+  if (verbose) {
+    printf("ARRAY: Error with degree %d\n", degree);
+    printf("Average absolute error = %.10e\n", avgAbsoluteError);
+    printf("Max absolute error = %.10e\n", maxAbsoluteError);
+  }
+
+  free(angles);
+  free(sines);
+  free(cosines);
+  free(sinesOnly);
+  free(cosinesOnly);
+
+  // The sine and cosine arrays must match the combined array
+  return isSame ? avgAbsoluteError : INFINITY;
+}
+
+static int isSinCosSame(int lowerBound, int upperBound, double multFactor,
+                        int degree) {
+  for (int i = lowerBound; i < upperBound; ++i) {
+    fast_sincos_real angle = i * multFactor;
+    fast_sincos_real sine;
+    fast_sincos_real cosine;
+    fastSinCos(angle, degree, &sine, &cosine);
+    if (sine != fastSin(angle, degree) || cosine != fastCos(angle, degree)) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+static int isFixedSinCosSame() {
+  for (uint32_t i = 0; i < FIXED_2_PI; i += 97) {
+    fast_sincos_real sine;
+    fast_sincos_real cosine;
+    fastFixedSinCos(i, &sine, &cosine);
+    if (sine != fastFixedSin(i) || cosine != fastFixedCos(i)) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+static double getFixedQError(int verbose) {
+
+  // Excess of the differences with fastFixedSin and fastFixedCos over the
+  // resolution of each format
+  double maxExcess = 0.0;
+  double maxQ15Difference = 0.0;
+  double maxQ31Difference = 0.0;
+  for (uint32_t i = 0; i < FIXED_2_PI; i += 97) {
+    const double sine = fastFixedSin(i);
+    const double cosine = fastFixedCos(i);
+    const double q15Difference =
+        fmax(fabs(fastFixedSinQ15(i) / 32768.0 - sine),
+             fabs(fastFixedCosQ15(i) / 32768.0 - cosine));
+    const double q31Difference =
+        fmax(fabs(fastFixedSinQ31(i) / 2147483648.0 - sine),
+             fabs(fastFixedCosQ31(i) / 2147483648.0 - cosine));
+    maxQ15Difference = fmax(maxQ15Difference, q15Difference);
+    maxQ31Difference = fmax(maxQ31Difference, q31Difference);
+    maxExcess = fmax(maxExcess, q15Difference - 1.0 / 32768.0);
+    maxExcess = fmax(maxExcess, q31Difference - 1.0 / 2147483648.0);
+  }
+
+  if (verbose) {
+    printf("Max difference of Q1.15 with fixed = %.10e\n", maxQ15Difference);
+    printf("Max difference of Q1.31 with fixed = %.10e\n", maxQ31Difference);
+  }
+
+  return maxExcess;
+}
+
+static int isFixedQSinCosSame() {
+  for (uint32_t i = 0; i < FIXED_2_PI; i += 97) {
+    int16_t sineQ15;
+    int16_t cosineQ15;
+    int32_t sineQ31;
+    int32_t cosineQ31;
+    fastFixedSinCosQ15(i, &sineQ15, &cosineQ15);
+    fastFixedSinCosQ31(i, &sineQ31, &cosineQ31);
+    if (sineQ15 != fastFixedSinQ15(i) || cosineQ15 != fastFixedCosQ15(i) ||
+        sineQ31 != fastFixedSinQ31(i) || cosineQ31 != fastFixedCosQ31(i)) {
+      return 0;
+    }
+  }
+  return 1;
+}
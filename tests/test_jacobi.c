@@ -63,6 +63,136 @@ int testJacobi(real_number* input, real_number* expectedEigenValues,
   return 0;
 }
 
+// A variant of the Jacobi method, run until convergence
+typedef void (*jacobi_variant)(real_number* matrix, vec_size size,
+                               real_number* eigenVectors);
+
+static void classicalJacobi(real_number* matrix, vec_size size,
+                            real_number* eigenVectors) {
+  jacobi(matrix, size, eigenVectors, -1, 0);
+}
+
+static void cyclicJacobi(real_number* matrix, vec_size size,
+                         real_number* eigenVectors) {
+  jacobi(matrix, size, eigenVectors, -1, 1);
+}
+
+static void parallelJacobi(real_number* matrix, vec_size size,
+                           real_number* eigenVectors) {
+  jacobiParallel(matrix, size, eigenVectors, -1);
+}
+
+/**
+ * Runs a jacobi variant on a random symmetric matrix, and checks that the
+ * eigenvector matrix V is orthogonal and that V x A' x transpose(V) gives back
+ * the input matrix, A' being the matrix after the rotations.
+ */
+int testJacobiReconstruction(vec_size size, jacobi_variant variant,
+                             const char* name) {
+
+  vec_size squaredSize = size * size;
+  real_number input[squaredSize];
+  for (vec_size i = 0; i < size; ++i) {
+    for (vec_size j = 0; j <= i; ++j) {
+      input[i * size + j] = 2.0 * rand() / RAND_MAX - 1.0;
+      input[j * size + i] = input[i * size + j];
+    }
+  }
+
+  real_number mat1[squaredSize];
+  memcpy(mat1, input, sizeof(real_number) * squaredSize);
+  real_number output[squaredSize];
+  variant(mat1, size, output);
+
+  real_number offDiagonalSum = 0.0;
+  real_number maxError = 0.0;
+  for (vec_size i = 0; i < size; ++i) {
+    for (vec_size j = 0; j < size; ++j) {
+      if (i != j) {
+        offDiagonalSum += fabs(mat1[i * size + j]);
+      }
+
+      real_number dotProduct = 0.0;
+      real_number reconstructed = 0.0;
+      for (vec_size k = 0; k < size; ++k) {
+        dotProduct += output[k * size + i] * output[k * size + j];
+        for (vec_size l = 0; l < size; ++l) {
+          reconstructed +=
+              output[i * size + k] * mat1[k * size + l] * output[j * size + l];
+        }
+      }
+      maxError = fmax(maxError, fabs(dotProduct - (i == j ? 1.0 : 0.0)));
+      maxError = fmax(maxError, fabs(reconstructed - input[i * size + j]));
+    }
+  }
+
+  if (offDiagonalSum > EPSILON || maxError > 1e-10) {
+    printf("Fail : Test %s jacobi reconstruction of size %d. Off diagonal "
+           "sum is %e and error is %e\n",
+           name, size, offDiagonalSum, maxError);
+    return 1;
+  }
+
+  printf("Success : Test %s jacobi reconstruction of size %d\n", name, size);
+  return 0;
+}
+
+/**
+ * jacobiParallel must give the same eigenpairs as jacobi. They can be in
+ * another order, and the eigenvectors can have the opposite sign, so each
+ * eigenvalue of jacobiParallel is matched with the closest one of jacobi.
+ */
+int testJacobiParallel(vec_size size) {
+
+  vec_size squaredSize = size * size;
+  real_number serial[squaredSize];
+  real_number parallel[squaredSize];
+  for (vec_size i = 0; i < size; ++i) {
+    for (vec_size j = 0; j <= i; ++j) {
+      serial[i * size + j] = 2.0 * rand() / RAND_MAX - 1.0;
+      serial[j * size + i] = serial[i * size + j];
+    }
+  }
+  memcpy(parallel, serial, sizeof(real_number) * squaredSize);
+
+  real_number serialVectors[squaredSize];
+  real_number parallelVectors[squaredSize];
+  jacobi(serial, size, serialVectors, -1, 0);
+  jacobiParallel(parallel, size, parallelVectors, -1);
+
+  real_number maxValueError = 0.0;
+  real_number maxVectorError = 0.0;
+  for (vec_size j = 0; j < size; ++j) {
+    real_number eigenValue = parallel[j * size + j];
+    vec_size closest = 0;
+    for (vec_size k = 1; k < size; ++k) {
+      if (fabs(serial[k * size + k] - eigenValue) <
+          fabs(serial[closest * size + closest] - eigenValue)) {
+        closest = k;
+      }
+    }
+
+    real_number dotProduct = 0.0;
+    for (vec_size i = 0; i < size; ++i) {
+      dotProduct += parallelVectors[i * size + j] *
+                    serialVectors[i * size + closest];
+    }
+    maxValueError = fmax(maxValueError,
+                         fabs(serial[closest * size + closest] - eigenValue));
+    maxVectorError = fmax(maxVectorError, 1.0 - fabs(dotProduct));
+  }
+
+  if (maxValueError > EPSILON || maxVectorError > EPSILON) {
+    printf("Fail : Test jacobi parallel of size %d. Eigenvalue error is %e "
+           "and eigenvector error is %e\n",
+           size, maxValueError, maxVectorError);
+    return 1;
+  }
+
+  printf("Success : Test jacobi parallel of size %d\n", size);
+  return 0;
+}
+
 int main() {
 
   //////////////////////////////////////////////////
@@ -90,15 +220,33 @@ int main() {
                                          -0.541774, 0.454401,  0.707107};
 
   // The numbers are different in the cyclic version since depending on the
-  // jacobi rotations, the eigenvectors can be inverted or not.
-  real_number expectedEigenVectorsCyclic[9] = {-0.541774, -0.454401, 0.707107,
-                                               -0.642621, 0.766185,  0.0000000,
-                                               -0.541774, -0.454401, -0.707107};
-
-  fail |= testJacobi(matTestJacobi, expectedEigenValues,
-                     expectedEigenVectorsCyclic, 3, 10, 1, EPSILON_CMP);
+  // jacobi rotations, the eigenvalues can be in another order and the
+  // eigenvectors can be inverted or not. It stops as soon as the off diagonal
+  // sum is below EPSILON, which leaves larger off diagonal elements here.
+  real_number expectedEigenValuesCyclic[9] = {-1.372281, 0.000000, 0.000000,
+                                              0.000000,  4.372281, 0.000000,
+                                              0.000000,  0.000000, 0.000000};
+
+  real_number expectedEigenVectorsCyclic[9] = {0.454401,  0.541774, -0.707107,
+                                               -0.766185, 0.642621, 0.0000000,
+                                               0.454401,  0.541774, 0.707107};
+
+  fail |= testJacobi(matTestJacobi, expectedEigenValuesCyclic,
+                     expectedEigenVectorsCyclic, 3, 10, 1, EPSILON);
   fail |= testJacobi(matTestJacobi, expectedEigenValues, expectedEigenVectors,
                      3, 10, 0, EPSILON_CMP);
 
+  fail |= testJacobiReconstruction(2, classicalJacobi, "classical");
+  fail |= testJacobiReconstruction(17, classicalJacobi, "classical");
+  fail |= testJacobiReconstruction(17, cyclicJacobi, "cyclic");
+  fail |= testJacobiReconstruction(40, classicalJacobi, "classical");
+  fail |= testJacobiReconstruction(40, cyclicJacobi, "cyclic");
+  fail |= testJacobiReconstruction(1, parallelJacobi, "parallel");
+  fail |= testJacobiReconstruction(2, parallelJacobi, "parallel");
+  fail |= testJacobiReconstruction(17, parallelJacobi, "parallel");
+  fail |= testJacobiReconstruction(40, parallelJacobi, "parallel");
+  fail |= testJacobiParallel(9);
+  fail |= testJacobiParallel(32);
+
   return fail;
 }
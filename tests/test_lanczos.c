@@ -1,6 +1,9 @@
 #include "matrix.h"
+#include "sparse_matrix.h"
 #include <lanczos.h>
+#include <math.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #define size 3
@@ -70,6 +73,169 @@ int testLanczos(double* initialMatrix, double* tMatrix, double* vMatrix,
   return 0;
 }
 
+/**
+ * lanczosPacked must give the same T and V matrices as lanczos
+ */
+int testLanczosPacked() {
+  double matrix[size][size] = {
+      {4.0, 1.0, 2.0}, {1.0, 3.0, 0.5}, {2.0, 0.5, 5.0}};
+  double packed[size * (size + 1) / 2];
+  symmetricPack(matrix[0], size, packed);
+
+  double initialVector[size] = {1.0, 2.0, 3.0};
+  double packedInitialVector[size] = {1.0, 2.0, 3.0};
+  double tMatrix[nbIter * nbIter] = {0.0};
+  double packedTMatrix[nbIter * nbIter] = {0.0};
+  double vMatrix[size * nbIter];
+  double packedVMatrix[size * nbIter];
+  lanczos(matrix[0], size, nbIter, initialVector, tMatrix, vMatrix);
+  lanczosPacked(packed, size, nbIter, packedInitialVector, packedTMatrix,
+                packedVMatrix);
+
+  for (int i = 0; i < nbIter * nbIter; ++i) {
+    double diff = tMatrix[i] - packedTMatrix[i];
+    if (isAlmostZero(&diff) != 0) {
+      printf("Fail : %s(), expected %f == %f\n", __func__, tMatrix[i],
+             packedTMatrix[i]);
+      return 1;
+    }
+  }
+  for (int i = 0; i < size * nbIter; ++i) {
+    double diff = vMatrix[i] - packedVMatrix[i];
+    if (isAlmostZero(&diff) != 0) {
+      printf("Fail : %s(), expected %f == %f\n", __func__, vMatrix[i],
+             packedVMatrix[i]);
+      return 1;
+    }
+  }
+  printf("Success : %s()\n", __func__);
+  return 0;
+}
+
+/**
+ * lanczosSparse must give the same T and V matrices as lanczos
+ */
+int testLanczosSparse() {
+  double matrix[size][size] = {
+      {4.0, 0.0, 2.0}, {0.0, 3.0, 0.5}, {2.0, 0.5, 0.0}};
+  sparse_matrix* sparse = sparseMatrixCreateFromDense(matrix[0], size, size);
+  if (sparse == NULL) {
+    printf("Fail : %s(), could not create the sparse matrix\n", __func__);
+    return 1;
+  }
+
+  double initialVector[size] = {1.0, 2.0, 3.0};
+  double sparseInitialVector[size] = {1.0, 2.0, 3.0};
+  double tMatrix[nbIter * nbIter] = {0.0};
+  double sparseTMatrix[nbIter * nbIter] = {0.0};
+  double vMatrix[size * nbIter];
+  double sparseVMatrix[size * nbIter];
+  lanczos(matrix[0], size, nbIter, initialVector, tMatrix, vMatrix);
+  int returnCode = lanczosSparse(sparse, nbIter, sparseInitialVector,
+                                 sparseTMatrix, sparseVMatrix);
+  sparseMatrixDestroy(sparse);
+  if (returnCode != 0) {
+    printf("Fail : %s(), lanczosSparse returned %d\n", __func__, returnCode);
+    return 1;
+  }
+
+  for (int i = 0; i < nbIter * nbIter; ++i) {
+    double diff = tMatrix[i] - sparseTMatrix[i];
+    if (isAlmostZero(&diff) != 0) {
+      printf("Fail : %s(), expected %f == %f\n", __func__, tMatrix[i],
+             sparseTMatrix[i]);
+      return 1;
+    }
+  }
+  for (int i = 0; i < size * nbIter; ++i) {
+    double diff = vMatrix[i] - sparseVMatrix[i];
+    if (isAlmostZero(&diff) != 0) {
+      printf("Fail : %s(), expected %f == %f\n", __func__, vMatrix[i],
+             sparseVMatrix[i]);
+      return 1;
+    }
+  }
+  printf("Success : %s()\n", __func__);
+  return 0;
+}
+
+/**
+ * The 1D Laplacian, tridiagonal with 2 on the diagonal and -1 next to it,
+ * which is never stored. The context counts the products.
+ */
+static void laplacianMultiply(void* context, const lanczos_real* vector,
+                              size_t dim, lanczos_real* output) {
+  for (size_t i = 0; i < dim; ++i) {
+    output[i] = 2.0 * vector[i];
+    if (i > 0) {
+      output[i] -= vector[i - 1];
+    }
+    if (i + 1 < dim) {
+      output[i] -= vector[i + 1];
+    }
+  }
+  ++*(size_t*)context;
+}
+
+/**
+ * lanczosOperator on an operator larger than 255. Each column of V, except
+ * the last one, must satisfy the three term recurrence
+ * A * v(j) = beta(j-1) * v(j-1) + alpha(j) * v(j) + beta(j) * v(j+1)
+ */
+int testLanczosOperator() {
+  const size_t dim = 1000;
+  const size_t iterations = 300;
+  lanczos_real* tMatrix = calloc(iterations * iterations, sizeof(lanczos_real));
+  lanczos_real* vMatrix = malloc(dim * iterations * sizeof(lanczos_real));
+  lanczos_real* column = malloc(3 * dim * sizeof(lanczos_real));
+  int returnCode = 1;
+  if (tMatrix == NULL || vMatrix == NULL || column == NULL) {
+    printf("Fail : %s(), could not allocate the matrices\n", __func__);
+  } else {
+    size_t nbProducts = 0;
+    returnCode = lanczosOperator(laplacianMultiply, &nbProducts, dim,
+                                 iterations, NULL, tMatrix, vMatrix);
+    if (returnCode != 0 || nbProducts != iterations) {
+      printf("Fail : %s(), returned %d after %zu products\n", __func__,
+             returnCode, nbProducts);
+      returnCode = 1;
+    }
+
+    lanczos_real* product = column + dim;
+    lanczos_real* recurrence = product + dim;
+    lanczos_real maxError = 0.0;
+    for (size_t j = 0; j + 1 < iterations && returnCode == 0; ++j) {
+      for (size_t i = 0; i < dim; ++i) {
+        column[i] = vMatrix[i * iterations + j];
+        recurrence[i] = 0.0;
+      }
+      laplacianMultiply(&nbProducts, column, dim, product);
+      for (size_t k = j > 0 ? j - 1 : 0; k <= j + 1; ++k) {
+        for (size_t i = 0; i < dim; ++i) {
+          recurrence[i] +=
+              tMatrix[k * iterations + j] * vMatrix[i * iterations + k];
+        }
+      }
+      for (size_t i = 0; i < dim; ++i) {
+        maxError = fmax(maxError, fabs(product[i] - recurrence[i]));
+      }
+    }
+    if (returnCode == 0 && maxError > 1e-8) {
+      printf("Fail : %s(), the recurrence has an error of %e\n", __func__,
+             maxError);
+      returnCode = 1;
+    }
+  }
+
+  free(tMatrix);
+  free(vMatrix);
+  free(column);
+  if (returnCode == 0) {
+    printf("Success : %s()\n", __func__);
+  }
+  return returnCode;
+}
+
 int main() {
   double initialMatrix[size][size] = {
       {1.0, 1.0, 1.0}, {1.0, 1.0, 1.0}, {1.0, 1.0, 1.0}};
@@ -78,6 +244,10 @@ int main() {
   double initialVector[size] = {1.0, 2.0, 3.0};
   const double expectedEigenValue = 3.0;
 
-  return testLanczos(initialMatrix[0], tMatrix[0], vMatrix[0], initialVector,
-                     expectedEigenValue);
+  int returnCode = testLanczos(initialMatrix[0], tMatrix[0], vMatrix[0],
+                               initialVector, expectedEigenValue);
+  returnCode |= testLanczosPacked();
+  returnCode |= testLanczosSparse();
+  returnCode |= testLanczosOperator();
+  return returnCode;
 }
@@ -0,0 +1,140 @@
+#include "lanczos_top_eigen.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * Diagonal operator whose eigenvalues 1, 1/2, 1/3, ... decay like the
+ * variances of a PCA, in a shuffled order: the element (i * 7) % dim is
+ * 1 / (i + 1). dim must not be a multiple of 7. The context counts the
+ * products.
+ */
+static void decayingMultiply(void* context, const lanczos_real* vector,
+                             size_t dim, lanczos_real* output) {
+  for (size_t i = 0; i < dim; ++i) {
+    const size_t index = (i * 7) % dim;
+    output[index] = vector[index] / (i + 1);
+  }
+  ++*(size_t*)context;
+}
+
+/**
+ * lanczosTopEigen must find the largest eigenpairs of decayingMultiply, with
+ * orthonormal eigenvectors, and with fewer products than dim when the basis
+ * is smaller than dim
+ */
+int testLanczosTopEigen(size_t dim, size_t nbWanted, size_t basisSize) {
+  lanczos_real* eigenVectors = malloc(dim * nbWanted * sizeof(lanczos_real));
+  lanczos_real* column = malloc(2 * dim * sizeof(lanczos_real));
+  lanczos_real eigenValues[nbWanted];
+  int returnCode = 1;
+  size_t nbProducts = 0;
+  if (eigenVectors == NULL || column == NULL) {
+    printf("Fail : %s(), could not allocate the matrices\n", __func__);
+  } else {
+    returnCode =
+        lanczosTopEigen(decayingMultiply, &nbProducts, dim, nbWanted,
+                        basisSize, 100, 1e-10, NULL, eigenValues, eigenVectors);
+    if (returnCode != 0) {
+      printf("Fail : %s(), returned %d after %zu products\n", __func__,
+             returnCode, nbProducts);
+    }
+
+    lanczos_real* product = column + dim;
+    for (size_t c = 0; c < nbWanted && returnCode == 0; ++c) {
+      if (fabs(eigenValues[c] - 1.0 / (c + 1)) > 1e-9) {
+        printf("Fail : %s(), expected eigenvalue %f but got %f\n", __func__,
+               1.0 / (c + 1), eigenValues[c]);
+        returnCode = 1;
+      }
+      for (size_t i = 0; i < dim; ++i) {
+        column[i] = eigenVectors[i * nbWanted + c];
+      }
+      size_t unused = 0;
+      decayingMultiply(&unused, column, dim, product);
+      lanczos_real maxError = 0.0;
+      for (size_t i = 0; i < dim; ++i) {
+        maxError =
+            fmax(maxError, fabs(product[i] - eigenValues[c] * column[i]));
+      }
+      for (size_t k = 0; k < nbWanted; ++k) {
+        lanczos_real dot = 0.0;
+        for (size_t i = 0; i < dim; ++i) {
+          dot += column[i] * eigenVectors[i * nbWanted + k];
+        }
+        maxError = fmax(maxError, fabs(dot - (k == c)));
+      }
+      if (maxError > 1e-8) {
+        printf("Fail : %s(), eigenpair %zu has an error of %e\n", __func__, c,
+               maxError);
+        returnCode = 1;
+      }
+    }
+    if (returnCode == 0 && basisSize < dim && nbProducts >= dim) {
+      printf("Fail : %s(), %zu products for a size of %zu\n", __func__,
+             nbProducts, dim);
+      returnCode = 1;
+    }
+  }
+
+  free(eigenVectors);
+  free(column);
+  if (returnCode == 0) {
+    printf("Success : %s(), %zu eigenpairs of %zu in %zu products\n", __func__,
+           nbWanted, dim, nbProducts);
+  }
+  return returnCode;
+}
+
+static void nanMultiply(void* context, const lanczos_real* vector,
+                        size_t dim, lanczos_real* output) {
+  (void)context;
+  (void)vector;
+  for (size_t i = 0; i < dim; ++i) {
+    output[i] = NAN;
+  }
+}
+
+/**
+ * When the eigenvalues of the projected matrix cannot be computed,
+ * lanczosTopEigen must fail without writing the outputs
+ */
+int testLanczosTopEigenFailure() {
+  const size_t dim = 8;
+  const size_t nbWanted = 2;
+  lanczos_real eigenValues[nbWanted];
+  lanczos_real eigenVectors[dim * nbWanted];
+  for (size_t i = 0; i < nbWanted; ++i) {
+    eigenValues[i] = -1.0;
+  }
+  for (size_t i = 0; i < dim * nbWanted; ++i) {
+    eigenVectors[i] = -1.0;
+  }
+
+  if (lanczosTopEigen(nanMultiply, NULL, dim, nbWanted, 4, 10, 1e-10, NULL,
+                      eigenValues, eigenVectors) == 0) {
+    printf("Fail : %s(), returned 0 for a NaN operator\n", __func__);
+    return 1;
+  }
+  int isUnchanged = 1;
+  for (size_t i = 0; i < nbWanted; ++i) {
+    isUnchanged &= eigenValues[i] == -1.0;
+  }
+  for (size_t i = 0; i < dim * nbWanted; ++i) {
+    isUnchanged &= eigenVectors[i] == -1.0;
+  }
+  if (!isUnchanged) {
+    printf("Fail : %s(), the outputs were written\n", __func__);
+    return 1;
+  }
+  printf("Success : %s()\n", __func__);
+  return 0;
+}
+
+int main() {
+  int returnCode = testLanczosTopEigen(1000, 2, 6);
+  returnCode |= testLanczosTopEigen(5000, 10, 25);
+  returnCode |= testLanczosTopEigen(20, 20, 20);
+  returnCode |= testLanczosTopEigenFailure();
+  return returnCode;
+}
@@ -0,0 +1,201 @@
+#include <1chipml.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * @brief Reference product, with the textbook triple loop
+ */
+static void referenceMultiply(const matrix_real_number* firstMatrix,
+                              const matrix_real_number* secondMatrix,
+                              const matrix_size m, const matrix_size n,
+                              const matrix_size p, matrix_real_number* output,
+                              const int transposeFirstMatrix) {
+  for (matrix_size i = 0; i < m; ++i) {
+    for (matrix_size j = 0; j < p; ++j) {
+      matrix_real_number sum = 0.0;
+      for (matrix_size k = 0; k < n; ++k) {
+        sum += (transposeFirstMatrix ? firstMatrix[k * m + i]
+                                     : firstMatrix[i * n + k]) *
+               secondMatrix[k * p + j];
+      }
+      output[i * p + j] = sum;
+    }
+  }
+}
+
+/**
+ * @brief Compares matrixMultiply with the reference product on random
+ * matrices
+ * @return 1 if the products differ, 0 otherwise
+ */
+static int testMultiply(const matrix_size m, const matrix_size n,
+                        const matrix_size p, const int transposeFirstMatrix) {
+  matrix_real_number* first = malloc(m * n * sizeof(matrix_real_number));
+  matrix_real_number* second = malloc(n * p * sizeof(matrix_real_number));
+  matrix_real_number* output = malloc(m * p * sizeof(matrix_real_number));
+  matrix_real_number* expected = malloc(m * p * sizeof(matrix_real_number));
+  int returnCode = 1;
+  if (first != NULL && second != NULL && output != NULL && expected != NULL) {
+    for (matrix_size i = 0; i < m * n; ++i) {
+      first[i] = 2 * linear_congruential_random_generator() - 1;
+    }
+    for (matrix_size i = 0; i < n * p; ++i) {
+      second[i] = 2 * linear_congruential_random_generator() - 1;
+    }
+
+    const matrix_size size[3] = {m, n, p};
+    matrixMultiply(first, second, size, output, transposeFirstMatrix);
+    referenceMultiply(first, second, m, n, p, expected, transposeFirstMatrix);
+
+    // The sums are reordered by the blocks, the error grows with n
+    const matrix_real_number epsilon = 1e-13 * n;
+    returnCode = 0;
+    for (matrix_size i = 0; i < m * p; ++i) {
+      if (fabs(output[i] - expected[i]) > epsilon) {
+        returnCode = 1;
+      }
+    }
+  }
+  free(first);
+  free(second);
+  free(output);
+  free(expected);
+
+  printf("Testing matrixMultiply of %u x %u by %u x %u%s: is the product "
+         "expected? ",
+         m, n, n, p, transposeFirstMatrix ? ", transposed" : "");
+  printf(returnCode == 0 ? "true\n" : "false\n");
+  return returnCode;
+}
+
+/**
+ * @brief Checks vectorDot, vectorAxpy and vectorAxpby against direct
+ * computations
+ * @return 1 if a result differs, 0 otherwise
+ */
+static int testVectorPrimitives(const matrix_size nbElements) {
+  matrix_real_number vector1[nbElements];
+  matrix_real_number vector2[nbElements];
+  matrix_real_number axpy[nbElements];
+  matrix_real_number axpby[nbElements];
+  matrix_real_number expectedDot = 0.0;
+  for (matrix_size i = 0; i < nbElements; ++i) {
+    vector1[i] = 2 * linear_congruential_random_generator() - 1;
+    vector2[i] = 2 * linear_congruential_random_generator() - 1;
+    axpy[i] = vector2[i];
+    axpby[i] = vector2[i];
+    expectedDot += vector1[i] * vector2[i];
+  }
+
+  const matrix_real_number epsilon = 1e-13 * nbElements;
+  int returnCode = fabs(vectorDot(vector1, vector2, nbElements) -
+                        expectedDot) > epsilon;
+  vectorAxpy(axpy, vector1, nbElements, 0.75);
+  vectorAxpby(axpby, vector1, nbElements, -2.0, 0.5);
+  for (matrix_size i = 0; i < nbElements; ++i) {
+    returnCode |= fabs(axpy[i] - (vector2[i] + 0.75 * vector1[i])) > epsilon;
+    returnCode |=
+        fabs(axpby[i] - (0.5 * vector2[i] - 2.0 * vector1[i])) > epsilon;
+  }
+
+  printf("Testing vectorDot, vectorAxpy and vectorAxpby with %u elements: "
+         "are the results expected? ",
+         nbElements);
+  printf(returnCode == 0 ? "true\n" : "false\n");
+  return returnCode;
+}
+
+/**
+ * @brief Checks the packed storage and the symmetric kernels against the
+ * dense matrix
+ * @return 1 if a result differs, 0 otherwise
+ */
+static int testSymmetric(const matrix_size size) {
+  matrix_real_number matrix[size * size];
+  matrix_real_number unpacked[size * size];
+  matrix_real_number packed[symmetricPackedSize(size)];
+  matrix_real_number vector1[size];
+  matrix_real_number vector2[size];
+  matrix_real_number output[size];
+  matrix_real_number expected[size];
+  for (matrix_size i = 0; i < size; ++i) {
+    vector1[i] = 2 * linear_congruential_random_generator() - 1;
+    vector2[i] = 2 * linear_congruential_random_generator() - 1;
+    for (matrix_size j = 0; j <= i; ++j) {
+      matrix[coordToIndex(i, j, size)] =
+          2 * linear_congruential_random_generator() - 1;
+      matrix[coordToIndex(j, i, size)] = matrix[coordToIndex(i, j, size)];
+    }
+  }
+
+  const matrix_real_number epsilon = 1e-13 * size;
+  symmetricPack(matrix, size, packed);
+  symmetricUnpack(packed, size, unpacked);
+  int returnCode = 0;
+  for (matrix_size i = 0; i < size; ++i) {
+    for (matrix_size j = 0; j < size; ++j) {
+      returnCode |= unpacked[coordToIndex(i, j, size)] !=
+                    packed[coordToPackedIndex(i, j, size)];
+      returnCode |= unpacked[coordToIndex(i, j, size)] !=
+                    matrix[coordToIndex(i, j, size)];
+    }
+  }
+
+  symmetricMatrixVectorMultiply(packed, vector1, size, output);
+  matrixVectorMultiply(matrix, vector1, size, size, expected, 0);
+  for (matrix_size i = 0; i < size; ++i) {
+    returnCode |= fabs(output[i] - expected[i]) > epsilon;
+  }
+
+  // matrix + 0.5 * vector1 x vector1 - 0.25 * (vector1 x vector2 + vector2 x
+  // vector1)
+  symmetricRank1Update(packed, size, 0.5, vector1);
+  symmetricRank2Update(packed, size, -0.25, vector1, vector2);
+  for (matrix_size i = 0; i < size; ++i) {
+    for (matrix_size j = 0; j < size; ++j) {
+      const matrix_real_number expectedElement =
+          matrix[coordToIndex(i, j, size)] + 0.5 * vector1[i] * vector1[j] -
+          0.25 * (vector1[i] * vector2[j] + vector2[i] * vector1[j]);
+      returnCode |= fabs(packed[coordToPackedIndex(i, j, size)] -
+                         expectedElement) > epsilon;
+    }
+  }
+
+  printf("Testing the packed symmetric kernels of size %u: are the results "
+         "expected? ",
+         size);
+  printf(returnCode == 0 ? "true\n" : "false\n");
+  return returnCode;
+}
+
+int main() {
+
+  int seed = time(NULL);
+  printf("seed used : %d\n", seed);
+  set_linear_congruential_generator_seed(seed);
+
+  // Sizes below and above the blocking threshold, with partial micro-kernel
+  // blocks and partial cache blocks in every dimension, and matrix-vector
+  // products with and without a partial group of 4 rows
+  const matrix_size sizes[][3] = {
+      {1, 7, 1},     {8, 8, 1},     {7, 13, 1},    {5, 5, 5},
+      {32, 32, 32},  {33, 17, 65},  {64, 64, 64},  {67, 300, 21},
+      {130, 257, 9}, {7, 30, 530}};
+
+  int returnCode = 0;
+  for (unsigned i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+    for (int transpose = 0; transpose <= 1; ++transpose) {
+      returnCode |=
+          testMultiply(sizes[i][0], sizes[i][1], sizes[i][2], transpose);
+    }
+  }
+
+  returnCode |= testVectorPrimitives(1);
+  returnCode |= testVectorPrimitives(37);
+  returnCode |= testSymmetric(1);
+  returnCode |= testSymmetric(23);
+
+  return returnCode;
+}
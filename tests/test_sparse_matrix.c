@@ -0,0 +1,261 @@
+#include <1chipml.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * @brief Prints the result of a test
+ * @return the return code
+ */
+static int printResult(const char* title, const int returnCode) {
+  printf("Testing %s: is the result expected? ", title);
+  printf(returnCode == 0 ? "true\n" : "false\n");
+  return returnCode;
+}
+
+/**
+ * @brief Fills a dense matrix with about density * nbRows * nbCols random
+ * non-zero elements, and gives them as shuffled coordinates, some of them
+ * split in two duplicate entries
+ * @return the number of entries
+ */
+static matrix_size createRandomEntries(matrix_real_number* dense,
+                                       const matrix_size nbRows,
+                                       const matrix_size nbCols,
+                                       const double density, matrix_size* rows,
+                                       matrix_size* cols,
+                                       matrix_real_number* values) {
+  matrix_size nbEntries = 0;
+  for (matrix_size i = 0; i < nbRows; ++i) {
+    for (matrix_size j = 0; j < nbCols; ++j) {
+      dense[coordToIndex(i, j, nbCols)] = 0.0;
+      if (linear_congruential_random_generator() >= density) {
+        continue;
+      }
+
+      const matrix_real_number element =
+          2 * linear_congruential_random_generator() - 1;
+      dense[coordToIndex(i, j, nbCols)] = element;
+      if (linear_congruential_random_generator() < 0.25) {
+        rows[nbEntries] = i;
+        cols[nbEntries] = j;
+        values[nbEntries++] = 0.5 * element;
+        rows[nbEntries] = i;
+        cols[nbEntries] = j;
+        values[nbEntries++] = 0.5 * element;
+      } else {
+        rows[nbEntries] = i;
+        cols[nbEntries] = j;
+        values[nbEntries++] = element;
+      }
+    }
+  }
+
+  for (matrix_size e = nbEntries; e > 1; --e) {
+    const matrix_size swap =
+        (matrix_size)(linear_congruential_random_generator() * e) % e;
+    const matrix_size row = rows[e - 1];
+    const matrix_size col = cols[e - 1];
+    const matrix_real_number value = values[e - 1];
+    rows[e - 1] = rows[swap];
+    cols[e - 1] = cols[swap];
+    values[e - 1] = values[swap];
+    rows[swap] = row;
+    cols[swap] = col;
+    values[swap] = value;
+  }
+  return nbEntries;
+}
+
+/**
+ * @brief Builds a random matrix from coordinates and from a dense matrix, and
+ * checks both storages and their products against the dense products
+ * @return 1 if a result differs, 0 otherwise
+ */
+static int testCreateAndMultiply(const matrix_size nbRows,
+                                 const matrix_size nbCols,
+                                 const double density) {
+  matrix_real_number dense[nbRows * nbCols];
+  matrix_size rows[2 * nbRows * nbCols + 1];
+  matrix_size cols[2 * nbRows * nbCols + 1];
+  matrix_real_number values[2 * nbRows * nbCols + 1];
+  const matrix_size nbEntries = createRandomEntries(
+      dense, nbRows, nbCols, density, rows, cols, values);
+
+  sparse_matrix* matrix =
+      sparseMatrixCreate(nbRows, nbCols, nbEntries, rows, cols, values);
+  sparse_matrix* fromDense = sparseMatrixCreateFromDense(dense, nbRows, nbCols);
+  int returnCode = matrix == NULL || fromDense == NULL;
+  if (returnCode == 0) {
+    // Same storage, up to the rounding of the split duplicates
+    returnCode |= matrix->nbNonZeros != fromDense->nbNonZeros;
+    for (matrix_size i = 0; i <= nbRows && returnCode == 0; ++i) {
+      returnCode |= matrix->rowOffsets[i] != fromDense->rowOffsets[i];
+    }
+    for (matrix_size k = 0; k < matrix->nbNonZeros && returnCode == 0; ++k) {
+      returnCode |= matrix->columns[k] != fromDense->columns[k];
+      returnCode |= fabs(matrix->values[k] - fromDense->values[k]) > 1e-15;
+    }
+  }
+
+  if (returnCode == 0) {
+    matrix_real_number vector[nbRows + nbCols];
+    matrix_real_number output[nbRows + nbCols];
+    matrix_real_number expected[nbRows + nbCols];
+    for (matrix_size i = 0; i < nbRows + nbCols; ++i) {
+      vector[i] = 2 * linear_congruential_random_generator() - 1;
+    }
+    for (int transpose = 0; transpose <= 1; ++transpose) {
+      const matrix_size outputSize = transpose ? nbCols : nbRows;
+      sparseMatrixVectorMultiply(matrix, vector, output, transpose);
+      matrixVectorMultiply(dense, vector, nbRows, nbCols, expected, transpose);
+      for (matrix_size i = 0; i < outputSize; ++i) {
+        returnCode |= fabs(output[i] - expected[i]) > 1e-13 * nbCols;
+      }
+    }
+  }
+
+  sparseMatrixDestroy(matrix);
+  sparseMatrixDestroy(fromDense);
+
+  printf("Testing a sparse matrix of %u x %u with a density of %.2f: are the "
+         "storage and the products expected? ",
+         nbRows, nbCols, density);
+  printf(returnCode == 0 ? "true\n" : "false\n");
+  return returnCode;
+}
+
+/**
+ * @brief Solves random lower and upper triangular systems, stored together in
+ * one matrix, and checks the solutions by multiplying them back
+ * @return 1 if a solution is wrong, 0 otherwise
+ */
+static int testTriangularSolve(const matrix_size size) {
+  matrix_real_number dense[size * size];
+  matrix_real_number lower[size * size];
+  matrix_real_number upper[size * size];
+  for (matrix_size i = 0; i < size; ++i) {
+    for (matrix_size j = 0; j < size; ++j) {
+      const matrix_size index = coordToIndex(i, j, size);
+      dense[index] = 0.0;
+      if (i == j) {
+        dense[index] = 1 + linear_congruential_random_generator();
+      } else if (linear_congruential_random_generator() < 0.3) {
+        dense[index] = 2 * linear_congruential_random_generator() - 1;
+      }
+      lower[index] = j <= i ? dense[index] : 0.0;
+      upper[index] = j >= i ? dense[index] : 0.0;
+    }
+  }
+
+  sparse_matrix* matrix = sparseMatrixCreateFromDense(dense, size, size);
+  if (matrix == NULL) {
+    return printResult("sparseTriangularSolve", 1);
+  }
+
+  matrix_real_number vector[size];
+  matrix_real_number solution[size];
+  matrix_real_number product[size];
+  for (matrix_size i = 0; i < size; ++i) {
+    vector[i] = 2 * linear_congruential_random_generator() - 1;
+  }
+
+  int returnCode = 0;
+  for (int isUpper = 0; isUpper <= 1; ++isUpper) {
+    returnCode |= sparseTriangularSolve(matrix, vector, solution, isUpper);
+    matrixVectorMultiply(isUpper ? upper : lower, solution, size, size,
+                         product, 0);
+    for (matrix_size i = 0; i < size; ++i) {
+      returnCode |= fabs(product[i] - vector[i]) > 1e-10;
+    }
+  }
+
+  // In place, then with a missing diagonal element
+  for (matrix_size i = 0; i < size; ++i) {
+    solution[i] = vector[i];
+  }
+  returnCode |= sparseTriangularSolve(matrix, solution, solution, 0);
+  matrixVectorMultiply(lower, solution, size, size, product, 0);
+  for (matrix_size i = 0; i < size; ++i) {
+    returnCode |= fabs(product[i] - vector[i]) > 1e-10;
+  }
+  dense[coordToIndex(size - 1, size - 1, size)] = 0.0;
+  sparse_matrix* singular = sparseMatrixCreateFromDense(dense, size, size);
+  returnCode |= singular == NULL ||
+                sparseTriangularSolve(singular, vector, solution, 0) != 1;
+
+  sparseMatrixDestroy(matrix);
+  sparseMatrixDestroy(singular);
+  return printResult("sparseTriangularSolve", returnCode);
+}
+
+/**
+ * @brief Solves a 1D Poisson problem, whose matrix is the tridiagonal
+ * (-1, 2, -1), with the conjugate gradient
+ * @return 1 if the solution is wrong, 0 otherwise
+ */
+static int testConjugateGradient(const matrix_size size) {
+  matrix_size rows[3 * size];
+  matrix_size cols[3 * size];
+  matrix_real_number values[3 * size];
+  matrix_size nbEntries = 0;
+  for (matrix_size i = 0; i < size; ++i) {
+    for (matrix_size j = i > 0 ? i - 1 : 0; j <= i + 1 && j < size; ++j) {
+      rows[nbEntries] = i;
+      cols[nbEntries] = j;
+      values[nbEntries++] = i == j ? 2.0 : -1.0;
+    }
+  }
+  sparse_matrix* matrix =
+      sparseMatrixCreate(size, size, nbEntries, rows, cols, values);
+  if (matrix == NULL) {
+    return printResult("sparseConjugateGradient", 1);
+  }
+
+  matrix_real_number expected[size];
+  matrix_real_number vector[size];
+  matrix_real_number solution[size];
+  for (matrix_size i = 0; i < size; ++i) {
+    expected[i] = 2 * linear_congruential_random_generator() - 1;
+    solution[i] = 0.0;
+  }
+  sparseMatrixVectorMultiply(matrix, expected, vector, 0);
+
+  // Converges in size iterations in exact arithmetic
+  int returnCode =
+      sparseConjugateGradient(matrix, vector, solution, 2 * size, 1e-12);
+  for (matrix_size i = 0; i < size; ++i) {
+    returnCode |= fabs(solution[i] - expected[i]) > 1e-6;
+  }
+
+  sparseMatrixDestroy(matrix);
+  return printResult("sparseConjugateGradient", returnCode);
+}
+
+int main() {
+
+  int seed = time(NULL);
+  printf("seed used : %d\n", seed);
+  set_linear_congruential_generator_seed(seed);
+
+  int returnCode = 0;
+  returnCode |= testCreateAndMultiply(1, 1, 1.0);
+  returnCode |= testCreateAndMultiply(17, 9, 0.0);
+  returnCode |= testCreateAndMultiply(23, 31, 0.1);
+  returnCode |= testCreateAndMultiply(40, 40, 0.5);
+
+  // A coordinate outside of the matrix
+  const matrix_size rows[] = {0, 3};
+  const matrix_size cols[] = {1, 2};
+  const matrix_real_number values[] = {1.0, 2.0};
+  returnCode |= printResult("sparseMatrixCreate with an invalid coordinate",
+                            sparseMatrixCreate(3, 3, 2, rows, cols, values) !=
+                                NULL);
+
+  returnCode |= testTriangularSolve(1);
+  returnCode |= testTriangularSolve(30);
+  returnCode |= testConjugateGradient(100);
+
+  return returnCode;
+}
@@ -0,0 +1,106 @@
+#include <1chipml.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define SIGNAL_LENGTH 1000
+#define FRAME_LENGTH 64
+
+/**
+ * Data shared with the callback, to check each frame against the real FFT of
+ * the same windowed samples.
+ */
+typedef struct {
+  const fft_real* signal;
+  const fft_real* window;
+  unsigned hop;
+  unsigned nbFrames;
+  int returnCode;
+} stft_test_context;
+
+static void checkFrame(const fft_real* binReals, const fft_real* binImgs,
+                       const unsigned nbBins, const unsigned frameIndex,
+                       void* context) {
+
+  stft_test_context* test = context;
+  const fft_real epsilon = 1e-10;
+
+  fft_real frame[FRAME_LENGTH];
+  fft_real expectedReals[FRAME_LENGTH / 2 + 1];
+  fft_real expectedImgs[FRAME_LENGTH / 2 + 1];
+  for (unsigned i = 0; i < FRAME_LENGTH; ++i) {
+    frame[i] = test->window[i] * test->signal[frameIndex * test->hop + i];
+  }
+  RFFT(FRAME_LENGTH, frame, expectedReals, expectedImgs);
+
+  if (nbBins != FRAME_LENGTH / 2 + 1 || frameIndex != test->nbFrames) {
+    test->returnCode = 1;
+  }
+  for (unsigned k = 0; k < FRAME_LENGTH / 2 + 1; ++k) {
+    if (fabs(binReals[k] - expectedReals[k]) > epsilon ||
+        fabs(binImgs[k] - expectedImgs[k]) > epsilon) {
+      test->returnCode = 1;
+    }
+  }
+  ++test->nbFrames;
+}
+
+static int randomTestingSTFT(const unsigned hop, const unsigned maxChunk) {
+
+  fft_real signal[SIGNAL_LENGTH];
+  fft_real window[FRAME_LENGTH];
+  for (unsigned i = 0; i < SIGNAL_LENGTH; ++i) {
+    signal[i] = linear_congruential_random_generator();
+  }
+  stftHannWindow(FRAME_LENGTH, window);
+
+  stft_test_context test = {signal, window, hop, 0, 0};
+  stft* transform = stftCreate(FRAME_LENGTH, hop, window, checkFrame, &test);
+  int returnCode = transform == NULL;
+
+  // Chunks of random sizes, including empty ones
+  unsigned pushed = 0;
+  while (returnCode == 0 && pushed < SIGNAL_LENGTH) {
+    unsigned chunk =
+        (unsigned)(linear_congruential_random_generator() * (maxChunk + 1));
+    if (chunk > SIGNAL_LENGTH - pushed) {
+      chunk = SIGNAL_LENGTH - pushed;
+    }
+    returnCode |= stftPush(transform, signal + pushed, chunk);
+    pushed += chunk;
+  }
+  stftDestroy(transform);
+
+  const unsigned expectedFrames = (SIGNAL_LENGTH - FRAME_LENGTH) / hop + 1;
+  returnCode |= test.returnCode || test.nbFrames != expectedFrames;
+
+  printf("Random testing STFT with a hop of %u: is the STFT working as "
+         "intended? ",
+         hop);
+  if (returnCode == 0) {
+    printf("true\n");
+  } else {
+    printf("false\n");
+    returnCode = 1;
+  }
+  return returnCode;
+}
+
+int main() {
+
+  int seed = time(NULL);
+  printf("seed used : %d\n", seed);
+  set_linear_congruential_generator_seed(seed);
+
+  int returnCode = 0;
+
+  // Overlapping frames, pushed in small and large chunks
+  returnCode |= randomTestingSTFT(16, 5);
+  returnCode |= randomTestingSTFT(32, 200);
+
+  // Frames separated by skipped samples
+  returnCode |= randomTestingSTFT(80, 50);
+
+  return returnCode;
+}
@@ -0,0 +1,206 @@
+#include <1chipml.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/**
+ * @brief Prints the result of a test
+ * @return the return code
+ */
+static int printResult(const char* title, const int returnCode) {
+  printf("Testing %s: is the result expected? ", title);
+  printf(returnCode == 0 ? "true\n" : "false\n");
+  return returnCode;
+}
+
+/**
+ * @brief Checks eigenpairs of a symmetric matrix: the eigenvalues must be in
+ * increasing order, the eigenvectors, in columns, must be orthonormal, and
+ * matrix x eigenVectors must equal eigenVectors x diag(eigenValues)
+ * @return 1 if a check fails, 0 otherwise
+ */
+static int checkEigenPairs(const matrix_real_number* matrix,
+                           const matrix_size size,
+                           const matrix_real_number* eigenValues,
+                           const matrix_real_number* eigenVectors,
+                           const matrix_real_number tolerance) {
+  int returnCode = 0;
+  for (matrix_size j = 0; j + 1 < size; ++j) {
+    returnCode |= eigenValues[j] > eigenValues[j + 1];
+  }
+
+  for (matrix_size j = 0; j < size; ++j) {
+    for (matrix_size k = 0; k < size; ++k) {
+      matrix_real_number dot = 0.0;
+      for (matrix_size i = 0; i < size; ++i) {
+        dot += eigenVectors[coordToIndex(i, j, size)] *
+               eigenVectors[coordToIndex(i, k, size)];
+      }
+      returnCode |= fabs(dot - (j == k)) > tolerance;
+    }
+
+    for (matrix_size i = 0; i < size; ++i) {
+      matrix_real_number product = 0.0;
+      for (matrix_size k = 0; k < size; ++k) {
+        product += matrix[coordToIndex(i, k, size)] *
+                   eigenVectors[coordToIndex(k, j, size)];
+      }
+      returnCode |= fabs(product - eigenValues[j] *
+                                       eigenVectors[coordToIndex(i, j, size)]) >
+                    tolerance;
+    }
+  }
+  return returnCode;
+}
+
+/**
+ * @brief Computes the eigenpairs of a random symmetric matrix with
+ * symmetricEigen, and of its tridiagonal form with tridiagonalEigen
+ * @return 1 if the eigenpairs are wrong, 0 otherwise
+ */
+static int testSymmetricEigen(const matrix_size size) {
+  matrix_real_number matrix[size * size];
+  matrix_real_number eigenVectors[size * size];
+  matrix_real_number eigenValues[size];
+  for (matrix_size i = 0; i < size; ++i) {
+    for (matrix_size j = 0; j <= i; ++j) {
+      matrix[coordToIndex(i, j, size)] =
+          2 * linear_congruential_random_generator() - 1;
+      matrix[coordToIndex(j, i, size)] = matrix[coordToIndex(i, j, size)];
+    }
+  }
+  for (matrix_size i = 0; i < size * size; ++i) {
+    eigenVectors[i] = matrix[i];
+  }
+
+  int returnCode = symmetricEigen(eigenVectors, size, eigenValues);
+  returnCode |= checkEigenPairs(matrix, size, eigenValues, eigenVectors, 1e-10);
+
+  // Same eigenvalues without the eigenvectors, from Q x T x transpose(Q)
+  matrix_real_number diagonal[size];
+  matrix_real_number offDiagonal[size];
+  for (matrix_size i = 0; i < size * size; ++i) {
+    eigenVectors[i] = matrix[i];
+  }
+  householderTridiagonalize(eigenVectors, size, diagonal, offDiagonal, 0);
+  returnCode |= tridiagonalQL(diagonal, offDiagonal, size, NULL);
+  for (matrix_size i = 0; i < size; ++i) {
+    returnCode |= fabs(diagonal[i] - eigenValues[i]) > 1e-10;
+  }
+
+  printf("Testing symmetricEigen on a random matrix of size %u: are the "
+         "eigenpairs expected? ",
+         size);
+  printf(returnCode == 0 ? "true\n" : "false\n");
+  return returnCode;
+}
+
+/**
+ * @brief Matrix of ones, whose eigenvalue 0 is repeated size - 1 times, and
+ * diagonal matrix, which is already tridiagonal
+ * @return 1 if the eigenpairs are wrong, 0 otherwise
+ */
+static int testSpecialMatrices(const matrix_size size) {
+  matrix_real_number matrix[size * size];
+  matrix_real_number eigenVectors[size * size];
+  matrix_real_number eigenValues[size];
+  for (matrix_size i = 0; i < size * size; ++i) {
+    matrix[i] = 1.0;
+    eigenVectors[i] = 1.0;
+  }
+  int returnCode = symmetricEigen(eigenVectors, size, eigenValues);
+  returnCode |= checkEigenPairs(matrix, size, eigenValues, eigenVectors, 1e-10);
+  returnCode |= fabs(eigenValues[size - 1] - size) > 1e-10;
+
+  for (matrix_size i = 0; i < size; ++i) {
+    for (matrix_size j = 0; j < size; ++j) {
+      matrix[coordToIndex(i, j, size)] = i == j ? (i % 3) - 1.0 : 0.0;
+      eigenVectors[coordToIndex(i, j, size)] = matrix[coordToIndex(i, j, size)];
+    }
+  }
+  returnCode |= symmetricEigen(eigenVectors, size, eigenValues);
+  returnCode |= checkEigenPairs(matrix, size, eigenValues, eigenVectors, 1e-12);
+  returnCode |= eigenValues[0] != -1.0 || eigenValues[size - 1] != 1.0;
+
+  return printResult("symmetricEigen with repeated eigenvalues", returnCode);
+}
+
+/**
+ * @brief Eigenvalues of the 1D Laplacian, the tridiagonal (-1, 2, -1), which
+ * are 2 - 2 * cos(k * pi / (size + 1))
+ * @return 1 if the eigenpairs are wrong, 0 otherwise
+ */
+static int testTridiagonalEigen(const matrix_size size) {
+  matrix_real_number tMatrix[size * size];
+  matrix_real_number eigenVectors[size * size];
+  matrix_real_number eigenValues[size];
+  for (matrix_size i = 0; i < size; ++i) {
+    for (matrix_size j = 0; j < size; ++j) {
+      tMatrix[coordToIndex(i, j, size)] =
+          i == j ? 2.0 : (i == j + 1 || j == i + 1 ? -1.0 : 0.0);
+    }
+  }
+
+  int returnCode = tridiagonalEigen(tMatrix, size, eigenValues, eigenVectors);
+  returnCode |=
+      checkEigenPairs(tMatrix, size, eigenValues, eigenVectors, 1e-10);
+  for (matrix_size k = 0; k < size; ++k) {
+    const matrix_real_number expected =
+        2.0 - 2.0 * cos((k + 1) * M_PI / (size + 1));
+    returnCode |= fabs(eigenValues[k] - expected) > 1e-12;
+  }
+  return printResult("tridiagonalEigen", returnCode);
+}
+
+/**
+ * @brief Finishes lanczos with tridiagonalEigen: after dim iterations, the
+ * eigenvalues of T are those of the matrix, and V x eigenVectors gives its
+ * eigenvectors
+ * @return 1 if the eigenpairs are wrong, 0 otherwise
+ */
+static int testLanczosRitz(const matrix_size size) {
+  matrix_real_number matrix[size * size];
+  matrix_real_number tMatrix[size * size];
+  matrix_real_number vMatrix[size * size];
+  matrix_real_number eigenVectors[size * size];
+  matrix_real_number ritzVectors[size * size];
+  matrix_real_number eigenValues[size];
+  for (matrix_size i = 0; i < size; ++i) {
+    for (matrix_size j = 0; j <= i; ++j) {
+      matrix[coordToIndex(i, j, size)] =
+          2 * linear_congruential_random_generator() - 1;
+      matrix[coordToIndex(j, i, size)] = matrix[coordToIndex(i, j, size)];
+    }
+  }
+
+  int returnCode = lanczos(matrix, size, size, NULL, tMatrix, vMatrix);
+  returnCode |= tridiagonalEigen(tMatrix, size, eigenValues, eigenVectors);
+  const matrix_size dims[] = {size, size, size};
+  matrixMultiply(vMatrix, eigenVectors, dims, ritzVectors, 0);
+  returnCode |= checkEigenPairs(matrix, size, eigenValues, ritzVectors, 1e-8);
+  return printResult("tridiagonalEigen on the T matrix of lanczos",
+                     returnCode);
+}
+
+int main() {
+
+  int seed = time(NULL);
+  printf("seed used : %d\n", seed);
+  set_linear_congruential_generator_seed(seed);
+
+  int returnCode = 0;
+  returnCode |= testSymmetricEigen(1);
+  returnCode |= testSymmetricEigen(2);
+  returnCode |= testSymmetricEigen(7);
+  returnCode |= testSymmetricEigen(60);
+  returnCode |= testSpecialMatrices(9);
+  returnCode |= testTridiagonalEigen(50);
+  returnCode |= testLanczosRitz(20);
+
+  return returnCode;
+}
@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+"""Generates src/fast_sincos_table.h, the first quadrant sine tables of
+fast_sincos.c.
+
+One table is written for every quadrant size and element width supported by
+fast_sincos. The header selects the table matching FAST_SINCOS_QUADRANT_SIZE
+and FAST_SINCOS_TABLE_BITS, so that a target can pick the smallest table that
+meets its error budget without running this script.
+
+Usage: python3 tools/generate_sine_tables.py [output]
+"""
+
+import math
+import os
+import sys
+
+QUADRANT_SIZES = [64, 128, 256, 512, 1024, 2048, 4096]
+ELEMENT_BITS = [8, 16, 32]
+COLUMN_LIMIT = 80
+INDENT = "    "
+
+
+def sine_table(quadrant_size, bits):
+    """Returns the quadrant_size + 1 values of sin(x) * 2^bits, for x from 0 to
+    pi / 2. The last value is clamped to 2^bits - 1 to fit the elements."""
+    scale = 1 << bits
+    return [
+        min(round(math.sin(i * math.pi / (2 * quadrant_size)) * scale), scale - 1)
+        for i in range(quadrant_size + 1)
+    ]
+
+
+def format_values(values):
+    """Formats the values in aligned columns, within the column limit."""
+    width = len(str(max(values))) + 1
+    per_line = (COLUMN_LIMIT - len(INDENT)) // (width + 1)
+    lines = []
+    for start in range(0, len(values), per_line):
+        chunk = values[start:start + per_line]
+        items = [str(value) + "," for value in chunk]
+        line = " ".join(item.ljust(width) for item in items[:-1])
+        line = (line + " " if line else "") + items[-1]
+        lines.append(INDENT + line)
+    return "\n".join(lines)
+
+
+def generate():
+    output = []
+    output.append("""// Generated by tools/generate_sine_tables.py. Do not edit.
+#ifndef FAST_SINCOS_TABLE_H
+#define FAST_SINCOS_TABLE_H
+
+// The first quadrant of the sine, from 0 to pi / 2, in QUADRANT_SIZE + 1
+// elements of FAST_SINCOS_TABLE_BITS bits. The element i is
+// sin(i * pi / (2 * QUADRANT_SIZE)) * 2^FAST_SINCOS_TABLE_BITS, the last one
+// being clamped to 2^FAST_SINCOS_TABLE_BITS - 1.
+// PROGMEM must be defined before including this header.
+
+// clang-format off
+""")
+    first = True
+    for quadrant_size in QUADRANT_SIZES:
+        for bits in ELEMENT_BITS:
+            keyword = "#if" if first else "#elif"
+            first = False
+            output.append(
+                "%s QUADRANT_SIZE == %d && FAST_SINCOS_TABLE_BITS == %d\n"
+                % (keyword, quadrant_size, bits))
+            output.append(
+                "static const uint%d_t sineTable[%d] PROGMEM = {\n%s\n};\n"
+                % (bits, quadrant_size + 1,
+                   format_values(sine_table(quadrant_size, bits))))
+    output.append("""#else
+#error "No sine table for this QUADRANT_SIZE and FAST_SINCOS_TABLE_BITS"
+#endif
+// clang-format on
+
+#endif // FAST_SINCOS_TABLE_H
+""")
+    return "".join(output)
+
+
+def main():
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    path = sys.argv[1] if len(sys.argv) > 1 else os.path.join(
+        root, "src", "fast_sincos_table.h")
+    with open(path, "w") as header:
+        header.write(generate())
+
+
+if __name__ == "__main__":
+    main()